@@ -0,0 +1,193 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/extensions/algorithms/bulk.hpp>
+#include <boost/geometry/extensions/geometries/columnar.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/centroid.hpp>
+#include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/equals.hpp>
+#include <boost/geometry/algorithms/intersects.hpp>
+#include <boost/geometry/algorithms/length.hpp>
+#include <boost/geometry/algorithms/num_points.hpp>
+#include <boost/geometry/algorithms/within.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+
+
+template <typename Point>
+void test_multi_polygon()
+{
+    typedef bg::model::polygon<Point> polygon_type;
+    typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+    typedef bg::model::box<Point> box_type;
+
+    multi_polygon_type mp;
+    bg::read_wkt("MULTIPOLYGON(((0 0,0 4,4 4,4 0,0 0)),"
+                 "((10 0,10 4,14 4,14 0,10 0),(11 1,13 1,13 3,11 3,11 1)),"
+                 "((20 0,20 1,21 0,20 0)))", mp);
+
+    bg::columnar_multi_polygon<Point> columnar;
+    columnar.reserve(3, 4, 19);
+    for (auto const& polygon : mp)
+    {
+        columnar.push_back(polygon);
+    }
+
+    BOOST_CHECK_EQUAL(columnar.size(), 3u);
+    BOOST_CHECK_EQUAL(columnar.points().size(), 19u);
+    BOOST_CHECK_EQUAL(columnar.ring_offsets().size(), 5u);
+    BOOST_CHECK_EQUAL(columnar.polygon_offsets().size(), 4u);
+
+    // The existing algorithms work on the columnar container
+    BOOST_CHECK_EQUAL(bg::num_points(columnar), 19u);
+    BOOST_CHECK_CLOSE(bg::area(columnar), bg::area(mp), 0.0001);
+    BOOST_CHECK(bg::equals(columnar, mp));
+    BOOST_CHECK(bg::intersects(columnar, mp));
+    BOOST_CHECK_EQUAL(bg::to_wkt(columnar.at(1)),
+        "POLYGON((10 0,10 4,14 4,14 0,10 0),(11 1,13 1,13 3,11 3,11 1))");
+
+    std::vector<double> areas;
+    bg::bulk_area(columnar, std::back_inserter(areas));
+    BOOST_CHECK_EQUAL(areas.size(), 3u);
+    for (std::size_t i = 0; i < mp.size() && i < areas.size(); i++)
+    {
+        BOOST_CHECK_CLOSE(areas[i], bg::area(mp[i]), 0.0001);
+    }
+
+    std::vector<box_type> boxes;
+    bg::bulk_envelope<box_type>(columnar.view(), std::back_inserter(boxes));
+    BOOST_CHECK_EQUAL(boxes.size(), 3u);
+    BOOST_CHECK_EQUAL(bg::to_wkt(boxes[1]), "POLYGON((10 0,10 4,14 4,14 0,10 0))");
+
+    std::vector<Point> centroids;
+    bg::bulk_centroid<Point>(columnar, std::back_inserter(centroids));
+    BOOST_CHECK_EQUAL(centroids.size(), 3u);
+    for (std::size_t i = 0; i < mp.size() && i < centroids.size(); i++)
+    {
+        Point expected;
+        bg::centroid(mp[i], expected);
+        BOOST_CHECK_CLOSE(bg::get<0>(centroids[i]), bg::get<0>(expected), 0.0001);
+        BOOST_CHECK_CLOSE(bg::get<1>(centroids[i]), bg::get<1>(expected), 0.0001);
+    }
+
+    std::vector<Point> const points
+    {
+        Point(1, 1), Point(12, 2), Point(10.5, 2), Point(20.2, 0.2), Point(50, 50)
+    };
+    std::vector<std::size_t> const found = bg::bulk_within(points, columnar);
+    std::size_t const none = std::size_t(-1);
+    BOOST_CHECK(found == std::vector<std::size_t>({ 0, none, 1, 2, none }));
+
+    columnar.clear();
+    BOOST_CHECK(columnar.empty());
+    BOOST_CHECK_EQUAL(bg::area(columnar), 0.0);
+    BOOST_CHECK(bg::bulk_within(points, columnar) == std::vector<std::size_t>(5, none));
+}
+
+template <typename Point>
+void test_multi_linestring()
+{
+    bg::model::multi_linestring<bg::model::linestring<Point> > ml;
+    bg::read_wkt("MULTILINESTRING((0 0,3 4),(0 0,0 1,1 1),())", ml);
+
+    bg::columnar_multi_linestring<Point> columnar;
+    for (auto const& ls : ml)
+    {
+        columnar.push_back(ls);
+    }
+    BOOST_CHECK_EQUAL(columnar.size(), 3u);
+    BOOST_CHECK_CLOSE(bg::length(columnar), 7.0, 0.0001);
+
+    std::vector<double> lengths;
+    bg::bulk_length(columnar, std::back_inserter(lengths));
+    BOOST_CHECK(lengths == std::vector<double>({ 5.0, 2.0, 0.0 }));
+}
+
+template <typename Point, bool ClockWise, bool Closed, typename Strategy>
+void test_geographic_area(Strategy const& strategy)
+{
+    typedef bg::model::polygon<Point, ClockWise, Closed> polygon_type;
+    typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+
+    // Small parcels, a parcel with a hole, crossing the antimeridian, on the
+    // equator and around the poles, and an invalid ring with too few points
+    multi_polygon_type mp;
+    bg::read_wkt("MULTIPOLYGON(((10 50,10 50.01,10.01 50.01,10.01 50,10 50)),"
+                 "((0 0,0 1,1 1,1 0,0 0),(0.2 0.2,0.8 0.2,0.8 0.8,0.2 0.8,0.2 0.2)),"
+                 "((179.99 -10,179.99 -9.99,-179.99 -9.99,-179.99 -10,179.99 -10)),"
+                 "((0 0,5 0,5 -1,0 0)),"
+                 "((0 80,90 80,180 80,-90 80,0 80)),"
+                 "((0 -80,-90 -80,180 -80,90 -80,0 -80)),"
+                 "((1 1,2 2,1 1)))", mp);
+    bg::correct(mp);
+
+    // Many random small parcels
+    for (int i = 0; i < 600; i++)
+    {
+        double const x = -180 + (i * 37) % 360 + 0.5;
+        double const y = -85 + (i * 53) % 170 + 0.5;
+        double const d = 0.001 * (1 + i % 7);
+        polygon_type polygon;
+        bg::append(polygon, Point(x, y));
+        bg::append(polygon, Point(x, y + d));
+        bg::append(polygon, Point(x + 2 * d, y + d));
+        bg::append(polygon, Point(x + d, y - d));
+        bg::correct(polygon);
+        mp.push_back(polygon);
+    }
+
+    bg::columnar_multi_polygon<Point, ClockWise, Closed> columnar;
+    for (auto const& polygon : mp)
+    {
+        columnar.push_back(polygon);
+    }
+
+    std::vector<double> areas;
+    bg::bulk_area(columnar, std::back_inserter(areas), strategy);
+    BOOST_CHECK_EQUAL(areas.size(), mp.size());
+    for (std::size_t i = 0; i < mp.size() && i < areas.size(); i++)
+    {
+        double const expected = bg::area(mp[i], strategy);
+        BOOST_CHECK_MESSAGE(areas[i] == expected,
+                            i << " result: " << areas[i] << " expected: " << expected);
+    }
+    BOOST_CHECK_EQUAL(areas.back() > 0, true);
+    BOOST_CHECK_EQUAL(areas[6], 0.0);
+
+    // The same in threads
+    std::vector<double> parallel;
+    bg::bulk_area(columnar.view(), std::back_inserter(parallel), strategy, 3);
+    BOOST_CHECK(parallel == areas);
+}
+
+int test_main(int, char* [])
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+    test_multi_polygon<point_type>();
+    test_multi_linestring<point_type>();
+
+    typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > geo_point_type;
+    test_geographic_area<geo_point_type, true, true>(bg::strategy::area::geographic<>());
+    test_geographic_area<geo_point_type, false, false>(bg::strategy::area::geographic<>());
+    test_geographic_area<geo_point_type, true, true>(
+        bg::strategy::area::geographic<bg::strategy::vincenty>());
+    test_geographic_area<geo_point_type, true, true>(
+        bg::strategy::area::geographic<bg::strategy::karney>());
+
+    return 0;
+}
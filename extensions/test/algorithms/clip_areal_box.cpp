@@ -0,0 +1,171 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/extensions/algorithms/clip_areal_box.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/intersection.hpp>
+#include <boost/geometry/algorithms/is_valid.hpp>
+#include <boost/geometry/algorithms/num_interior_rings.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+// Compares the result of the clipper with the result of the overlay
+template <typename Polygon, typename MultiPolygon, typename Areal, typename Box>
+void test_clip(std::string const& caseid,
+               Areal const& areal, Box const& box,
+               bool expected_fast_path,
+               std::size_t expected_count, std::size_t expected_holes,
+               double expected_area)
+{
+    using strategy_type = typename bg::strategies::relate::services::default_strategy
+        <
+            Areal, Box
+        >::type;
+
+    strategy_type const strategy;
+
+    MultiPolygon clipped;
+    bg::clip_areal_box(areal, box, clipped);
+
+    MultiPolygon reference;
+    bg::detail::overlay::overlay
+        <
+            Areal, Box,
+            bg::point_order<Areal>::value == bg::counterclockwise, false,
+            bg::point_order<Polygon>::value == bg::counterclockwise,
+            Polygon, bg::overlay_intersection
+        >::apply(areal, box, bg::detail::no_rescale_policy(),
+                 std::back_inserter(reference), strategy);
+
+    BOOST_CHECK_MESSAGE(clipped.size() == expected_count,
+        caseid << " count: " << clipped.size() << " expected: " << expected_count);
+    BOOST_CHECK_MESSAGE(bg::num_interior_rings(clipped) == expected_holes,
+        caseid << " holes: " << bg::num_interior_rings(clipped)
+        << " expected: " << expected_holes);
+    BOOST_CHECK_CLOSE(bg::area(clipped), expected_area, 0.0001);
+    BOOST_CHECK_CLOSE(bg::area(reference), expected_area, 0.0001);
+
+    std::string message;
+    BOOST_CHECK_MESSAGE(bg::is_valid(clipped, message),
+        caseid << " invalid: " << message << " " << bg::wkt(clipped));
+
+    // Check if the clipper itself handled this case
+    std::vector<Polygon> direct;
+    auto out = std::back_inserter(direct);
+    bg::detail::intersection::areal_box_clipper<Polygon> clipper;
+    bool const fast_path = clipper.apply(areal, box, out, strategy);
+    BOOST_CHECK_MESSAGE(fast_path == expected_fast_path,
+        caseid << " fast path: " << fast_path << " expected: " << expected_fast_path);
+}
+
+template <typename Polygon, typename MultiPolygon, typename Box>
+void test_one(std::string const& caseid,
+              std::string const& wkt, std::string const& box_wkt,
+              bool expected_fast_path,
+              std::size_t expected_count, std::size_t expected_holes,
+              double expected_area)
+{
+    Polygon polygon;
+    bg::read_wkt(wkt, polygon);
+    bg::correct(polygon);
+    Box box;
+    bg::read_wkt(box_wkt, box);
+
+    test_clip<Polygon, MultiPolygon>(caseid, polygon, box, expected_fast_path,
+                                     expected_count, expected_holes, expected_area);
+}
+
+template <typename P, bool ClockWise, bool Closed>
+void test_areal()
+{
+    using polygon = bg::model::polygon<P, ClockWise, Closed>;
+    using multi_polygon = bg::model::multi_polygon<polygon>;
+    using box = bg::model::box<P>;
+
+    std::string const clip = "BOX(2 2,8 8)";
+
+    // Simple overlap
+    test_one<polygon, multi_polygon, box>("simple",
+        "POLYGON((0 0,0 5,5 5,5 0,0 0))", clip, true, 1, 0, 9.0);
+
+    // Polygon inside, box inside, disjoint
+    test_one<polygon, multi_polygon, box>("poly_inside",
+        "POLYGON((3 3,3 4,4 4,4 3,3 3))", clip, true, 1, 0, 1.0);
+    test_one<polygon, multi_polygon, box>("box_inside",
+        "POLYGON((0 0,0 10,10 10,10 0,0 0))", clip, true, 1, 0, 36.0);
+    test_one<polygon, multi_polygon, box>("disjoint",
+        "POLYGON((10 10,10 11,11 11,11 10,10 10))", clip, true, 0, 0, 0.0);
+
+    // U-shape crossing the box twice, resulting in two polygons
+    test_one<polygon, multi_polygon, box>("u_shape",
+        "POLYGON((0 0,0 9,3 9,3 1,7 1,7 9,10 9,10 0,0 0))", clip, true, 2, 0, 12.0);
+
+    // Notch entering and leaving the box at the same side
+    test_one<polygon, multi_polygon, box>("notch",
+        "POLYGON((1 1,1 9,9 9,9 1,7 1,7 7,3 7,3 1,1 1))", clip, true, 1, 0, 16.0);
+
+    // Holes: inside the box, crossing the box, around the box
+    test_one<polygon, multi_polygon, box>("hole_inside",
+        "POLYGON((0 0,0 10,10 10,10 0,0 0),(4 4,6 4,6 6,4 6,4 4))", clip,
+        true, 1, 1, 32.0);
+    test_one<polygon, multi_polygon, box>("hole_crossing",
+        "POLYGON((0 0,0 10,10 10,10 0,0 0),(1 4,6 4,6 6,1 6,1 4))", clip,
+        true, 1, 0, 28.0);
+    test_one<polygon, multi_polygon, box>("hole_around",
+        "POLYGON((0 0,0 10,10 10,10 0,0 0),(1 1,9 1,9 9,1 9,1 1))", clip,
+        true, 0, 0, 0.0);
+    test_one<polygon, multi_polygon, box>("hole_splitting",
+        "POLYGON((0 0,0 10,10 10,10 0,0 0),(1 4,9 4,9 6,1 6,1 4))", clip,
+        true, 2, 0, 24.0);
+    test_one<polygon, multi_polygon, box>("hole_in_part",
+        "POLYGON((0 0,0 9,3 9,3 1,7 1,7 9,10 9,10 0,0 0),(7.5 4,7.5 5,8.5 5,8.5 4,7.5 4))",
+        clip, true, 2, 0, 11.5);
+    test_one<polygon, multi_polygon, box>("hole_in_one_of_two",
+        "POLYGON((0 0,0 9,4 9,4 1,6 1,6 9,10 9,10 0,0 0),(2.5 4,2.5 5,3.5 5,3.5 4,2.5 4))",
+        clip, true, 2, 1, 23.0);
+
+    // Degenerate cases, handled by the overlay
+    test_one<polygon, multi_polygon, box>("vertex_on_border",
+        "POLYGON((0 0,0 5,2 5,5 5,5 0,0 0))", clip, false, 1, 0, 9.0);
+    test_one<polygon, multi_polygon, box>("along_border",
+        "POLYGON((0 2,0 5,5 5,5 2,0 2))", clip, false, 1, 0, 9.0);
+    test_one<polygon, multi_polygon, box>("through_corner",
+        "POLYGON((0 0,0 4,4 0,0 0))", clip, false, 0, 0, 0.0);
+
+    // Multi-polygon, partly handled by the overlay
+    multi_polygon mp;
+    bg::read_wkt("MULTIPOLYGON(((0 0,0 5,5 5,5 0,0 0)),((6 6,6 9,9 9,9 6,6 6)),"
+                 "((7 0,7 2,9 2,9 0,7 0)))", mp);
+    bg::correct(mp);
+    box b;
+    bg::read_wkt(clip, b);
+    multi_polygon clipped;
+    bg::clip_areal_box(mp, b, clipped);
+    BOOST_CHECK_EQUAL(clipped.size(), 2u);
+    BOOST_CHECK_CLOSE(bg::area(clipped), 13.0, 0.0001);
+}
+
+int test_main(int, char* [])
+{
+    using point = bg::model::d2::point_xy<double>;
+
+    test_areal<point, true, true>();
+    test_areal<point, false, true>();
+    test_areal<point, true, false>();
+    test_areal<point, false, false>();
+
+    return 0;
+}
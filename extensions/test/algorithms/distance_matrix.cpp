@@ -0,0 +1,105 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_real_distribution.hpp>
+
+#include <boost/geometry/extensions/algorithms/distance_matrix.hpp>
+
+#include <boost/geometry/algorithms/distance.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+
+
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_type;
+
+std::vector<point_type> random_points(std::size_t count, unsigned int seed)
+{
+    boost::random::mt19937 generator(seed);
+    boost::random::uniform_real_distribution<double> lon(-180, 180), lat(-90, 90);
+
+    std::vector<point_type> points;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        points.push_back(point_type(lon(generator), lat(generator)));
+    }
+    return points;
+}
+
+template <typename FormulaPolicy>
+void test_strategy(std::string const& name)
+{
+    typedef bg::strategy::distance::geographic<FormulaPolicy> strategy_type;
+    strategy_type const strategy;
+
+    std::vector<point_type> points1 = random_points(20, 1);
+    std::vector<point_type> points2 = random_points(300, 2);
+
+    // The same points, on the same meridians and at the poles
+    points1.push_back(point_type(10, 20));
+    points1.push_back(point_type(-30, 90));
+    points2.push_back(point_type(10, 20));
+    points2.push_back(point_type(10, -45));
+    points2.push_back(point_type(-170, 60));
+    points2.push_back(point_type(150, -90));
+
+    std::size_t const n1 = points1.size();
+    std::size_t const n2 = points2.size();
+
+    std::vector<double> matrix(n1 * n2);
+    bg::distance_matrix(points1, points2, matrix.data(), strategy);
+
+    for (std::size_t i = 0; i < n1; ++i)
+    {
+        for (std::size_t j = 0; j < n2; ++j)
+        {
+            double const expected = bg::distance(points1[i], points2[j], strategy);
+            double const result = matrix[i * n2 + j];
+            BOOST_CHECK_MESSAGE(std::abs(result - expected) <= 1e-6 + 1e-12 * expected,
+                                name << " " << i << " " << j
+                                     << " result: " << result << " expected: " << expected);
+        }
+    }
+
+    // The same in threads
+    std::vector<double> parallel(n1 * n2);
+    bg::distance_matrix(points1, points2, parallel.data(), strategy, 4);
+    BOOST_CHECK(parallel == matrix);
+
+    // One to many
+    std::vector<point_type> const origin(1, points1[3]);
+    std::vector<double> row(n2);
+    bg::distance_matrix(origin, points2, row.data(), strategy, 4);
+    BOOST_CHECK(std::equal(row.begin(), row.end(), matrix.begin() + 3 * n2));
+}
+
+int test_main(int, char* [])
+{
+    test_strategy<bg::strategy::andoyer>("andoyer");
+    test_strategy<bg::strategy::thomas>("thomas");
+    test_strategy<bg::strategy::vincenty>("vincenty");
+    test_strategy<bg::strategy::karney>("karney");
+
+    // The default strategy
+    std::vector<point_type> const points = random_points(10, 3);
+    std::vector<double> matrix(100);
+    bg::distance_matrix(points, points, matrix.data());
+    for (std::size_t i = 0; i < 10; ++i)
+    {
+        BOOST_CHECK_EQUAL(matrix[i * 10 + i], 0.0);
+        BOOST_CHECK_CLOSE(matrix[i * 10 + (i + 1) % 10],
+                          bg::distance(points[i], points[(i + 1) % 10]), 1e-9);
+    }
+
+    return 0;
+}
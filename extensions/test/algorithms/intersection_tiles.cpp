@@ -0,0 +1,162 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/extensions/algorithms/intersection_tiles.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/intersection.hpp>
+#include <boost/geometry/algorithms/length.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+
+
+template <typename Geometry, typename MultiOut, typename Measure>
+void check_tiles(Geometry const& geometry, std::size_t columns, std::size_t rows,
+                 Measure const& measure, std::string const& caseid)
+{
+    using point_type = typename bg::point_type<Geometry>::type;
+    using box_type = bg::model::box<point_type>;
+
+    box_type extent = bg::return_envelope<box_type>(geometry);
+    // Extend the grid such that there are tiles outside the geometry
+    bg::set<bg::min_corner, 0>(extent, bg::get<bg::min_corner, 0>(extent) - 1.0);
+    bg::set<bg::min_corner, 1>(extent, bg::get<bg::min_corner, 1>(extent) - 1.0);
+    bg::set<bg::max_corner, 0>(extent, bg::get<bg::max_corner, 0>(extent) + 1.0);
+    bg::set<bg::max_corner, 1>(extent, bg::get<bg::max_corner, 1>(extent) + 1.0);
+
+    std::vector<box_type> tiles;
+    bg::make_tile_grid(extent, columns, rows, tiles);
+    BOOST_CHECK_EQUAL(tiles.size(), columns * rows);
+
+    std::vector<MultiOut> outputs;
+    bg::intersection_tiles(geometry, tiles, outputs);
+    BOOST_CHECK_EQUAL(outputs.size(), tiles.size());
+
+    double total = 0;
+    for (std::size_t i = 0; i < tiles.size(); i++)
+    {
+        MultiOut expected;
+        bg::intersection(geometry, tiles[i], expected);
+
+        double const detected_measure = measure(outputs[i]);
+        double const expected_measure = measure(expected);
+        BOOST_CHECK_MESSAGE(std::abs(detected_measure - expected_measure) < 1.0e-6,
+            "case: " << caseid << " tile: " << i
+            << " detected: " << detected_measure
+            << " expected: " << expected_measure);
+        total += detected_measure;
+    }
+
+    BOOST_CHECK_CLOSE(total, measure(geometry), 0.0001);
+}
+
+struct area_measure
+{
+    template <typename Geometry>
+    double operator()(Geometry const& geometry) const
+    {
+        return bg::area(geometry);
+    }
+};
+
+struct length_measure
+{
+    template <typename Geometry>
+    double operator()(Geometry const& geometry) const
+    {
+        return bg::length(geometry);
+    }
+};
+
+template <typename Ring>
+void make_star(Ring& ring, double cx, double cy, double r1, double r2,
+               std::size_t count, bool clockwise)
+{
+    for (std::size_t i = 0; i < count; i++)
+    {
+        double const angle = (clockwise ? -1.0 : 1.0) * 2.0 * bg::math::pi<double>() * i / count;
+        double const r = i % 2 == 0 ? r1 : r2;
+        bg::append(ring, typename bg::point_type<Ring>::type(cx + r * std::cos(angle),
+                                                             cy + r * std::sin(angle)));
+    }
+    bg::append(ring, bg::range::front(ring));
+}
+
+template <typename P>
+void test_areal()
+{
+    using polygon = bg::model::polygon<P>;
+    using multi_polygon = bg::model::multi_polygon<polygon>;
+
+    polygon simple;
+    bg::read_wkt("POLYGON((0 0,0 10,10 10,10 0,0 0),(2 2,8 2,8 8,2 8,2 2))", simple);
+    check_tiles<polygon, multi_polygon>(simple, 6, 6, area_measure(), "simple_hole");
+    check_tiles<polygon, multi_polygon>(simple, 12, 12, area_measure(), "simple_hole_fine");
+
+    // Star with a large hole containing tiles, and with many sections
+    polygon star;
+    make_star(bg::exterior_ring(star), 0.0, 0.0, 50.0, 40.0, 400, true);
+    bg::interior_rings(star).resize(1);
+    make_star(bg::interior_rings(star).front(), 0.0, 0.0, 25.0, 20.0, 200, false);
+    check_tiles<polygon, multi_polygon>(star, 15, 10, area_measure(), "star");
+
+    multi_polygon multi;
+    bg::read_wkt("MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0),(2 2,8 2,8 8,2 8,2 2)),"
+                 "((4 4,4 6,6 6,6 4,4 4)),((20 0,20 1,21 1,21 0,20 0)),"
+                 "((30 0,30 10,40 10,40 0,30 0)))", multi);
+    check_tiles<multi_polygon, multi_polygon>(multi, 20, 5, area_measure(), "multi");
+    check_tiles<multi_polygon, multi_polygon>(multi, 1, 1, area_measure(), "multi_one");
+}
+
+template <typename P>
+void test_linear()
+{
+    using linestring = bg::model::linestring<P>;
+    using multi_linestring = bg::model::multi_linestring<linestring>;
+
+    linestring ls;
+    for (int i = 0; i <= 200; i++)
+    {
+        double const x = i * 0.25;
+        bg::append(ls, P(x, 10.0 * std::sin(x / 4.0)));
+    }
+    check_tiles<linestring, multi_linestring>(ls, 8, 8, length_measure(), "sine");
+
+    multi_linestring mls;
+    bg::read_wkt("MULTILINESTRING((0 0,10 10,20 0,30 10),(0 10,30 0),(5 5,6 5))", mls);
+    check_tiles<multi_linestring, multi_linestring>(mls, 7, 3, length_measure(), "multi");
+}
+
+template <typename P>
+void test_all()
+{
+    test_areal<P>();
+    test_linear<P>();
+
+    // Empty tiles range
+    bg::model::polygon<P> poly;
+    bg::read_wkt("POLYGON((0 0,0 10,10 10,10 0,0 0))", poly);
+    std::vector<bg::model::box<P> > tiles;
+    std::vector<bg::model::multi_polygon<bg::model::polygon<P> > > outputs;
+    bg::intersection_tiles(poly, tiles, outputs);
+    BOOST_CHECK(outputs.empty());
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+
+    return 0;
+}
@@ -0,0 +1,203 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/extensions/algorithms/simplify_coverage.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/is_valid.hpp>
+#include <boost/geometry/algorithms/num_interior_rings.hpp>
+#include <boost/geometry/algorithms/num_points.hpp>
+#include <boost/geometry/algorithms/union.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+
+
+// Adds the points of a wiggly edge from a to b (excluding b). The edge is
+// horizontal or vertical, and the points only depend on their location,
+// such that neighbouring polygons, traversing the edge in the opposite
+// direction, get exactly the same points
+template <typename Ring, typename Point>
+void add_edge(Ring& ring, Point const& a, Point const& b)
+{
+    int const n = 20;
+    double const amplitude = 0.2;
+    for (int k = 0; k < n; k++)
+    {
+        // Calculated exactly, and symmetric in k
+        double const x = (n * bg::get<0>(a) + k * (bg::get<0>(b) - bg::get<0>(a))) / n;
+        double const y = (n * bg::get<1>(a) + k * (bg::get<1>(b) - bg::get<1>(a))) / n;
+        double const offset = amplitude
+            * std::sin(bg::math::pi<double>() * (std::min)(k, n - k) / n)
+            * std::sin(x * 3.7 + y * 5.3);
+        bool const vertical = bg::get<0>(a) == bg::get<0>(b);
+        bg::append(ring, Point(vertical ? x + offset : x, vertical ? y : y + offset));
+    }
+}
+
+template <typename Ring>
+void add_circle(Ring& ring, double cx, double cy, double radius)
+{
+    using point_type = typename bg::point_type<Ring>::type;
+    int const n = 40;
+    for (int k = 0; k < n; k++)
+    {
+        double const angle = 2.0 * bg::math::pi<double>() * k / n;
+        double const r = radius + 0.1 * std::sin(7.0 * angle);
+        bg::append(ring, point_type(cx + r * std::cos(angle), cy + r * std::sin(angle)));
+    }
+}
+
+template <typename Polygon>
+std::vector<Polygon> make_coverage(int columns, int rows)
+{
+    using point_type = typename bg::point_type<Polygon>::type;
+
+    std::vector<Polygon> coverage;
+    for (int i = 0; i < columns; i++)
+    {
+        for (int j = 0; j < rows; j++)
+        {
+            point_type const ll(i * 10.0, j * 10.0);
+            point_type const lr(i * 10.0 + 10.0, j * 10.0);
+            point_type const ur(i * 10.0 + 10.0, j * 10.0 + 10.0);
+            point_type const ul(i * 10.0, j * 10.0 + 10.0);
+
+            Polygon cell;
+            add_edge(bg::exterior_ring(cell), ll, lr);
+            add_edge(bg::exterior_ring(cell), lr, ur);
+            add_edge(bg::exterior_ring(cell), ur, ul);
+            add_edge(bg::exterior_ring(cell), ul, ll);
+            coverage.push_back(cell);
+        }
+    }
+
+    // A lake in the first cell, completely filled by an island
+    bg::interior_rings(coverage.front()).resize(1);
+    add_circle(bg::interior_rings(coverage.front()).front(), 5.0, 5.0, 2.0);
+    Polygon island;
+    add_circle(bg::exterior_ring(island), 5.0, 5.0, 2.0);
+    coverage.push_back(island);
+
+    for (auto& polygon : coverage)
+    {
+        bg::correct(polygon);
+    }
+    return coverage;
+}
+
+template <typename Polygon>
+void check_coverage(std::string const& caseid, std::vector<Polygon> const& input,
+                    std::vector<Polygon> const& output, std::size_t expected_points)
+{
+    BOOST_CHECK_EQUAL(output.size(), input.size());
+
+    double sum = 0.0;
+    std::size_t point_count = 0;
+    bg::model::multi_polygon<Polygon> merged;
+    for (auto const& polygon : output)
+    {
+        std::string message;
+        BOOST_CHECK_MESSAGE(bg::is_valid(polygon, message),
+            caseid << " invalid: " << message << " " << bg::wkt(polygon));
+
+        sum += bg::area(polygon);
+        point_count += bg::num_points(polygon);
+
+        bg::model::multi_polygon<Polygon> united;
+        bg::union_(merged, polygon, united);
+        merged = united;
+    }
+
+    // No gaps: one polygon without holes, no overlaps: the same area
+    BOOST_CHECK_EQUAL(merged.size(), 1u);
+    BOOST_CHECK_EQUAL(bg::num_interior_rings(merged), 0u);
+    BOOST_CHECK_CLOSE(bg::area(merged), sum, 0.0001);
+    BOOST_CHECK_EQUAL(point_count, expected_points);
+}
+
+template <typename P, bool ClockWise, bool Closed>
+void test_coverage()
+{
+    using polygon = bg::model::polygon<P, ClockWise, Closed>;
+
+    std::vector<polygon> const coverage = make_coverage<polygon>(3, 3);
+
+    // The wiggles are removed: each cell keeps its nodes, or three nodes and
+    // its corner. The lake and the island keep the same 7 points.
+    std::size_t const closing = Closed ? 1 : 0;
+    std::size_t const expected = 9 * (4 + closing) + 2 * (7 + closing);
+
+    std::vector<polygon> simplified;
+    bg::simplify_coverage(coverage, simplified, 0.5);
+    check_coverage("grid", coverage, simplified, expected);
+
+    // Multiple threads should give the same result
+    std::vector<polygon> simplified_mt;
+    bg::simplify_coverage(coverage, simplified_mt, 0.5, bg::default_strategy(), 4);
+    BOOST_CHECK_EQUAL(simplified_mt.size(), simplified.size());
+    for (std::size_t i = 0; i < simplified.size() && i < simplified_mt.size(); i++)
+    {
+        BOOST_CHECK(bg::to_wkt(simplified_mt[i]) == bg::to_wkt(simplified[i]));
+    }
+
+    // A large distance: rings do not collapse
+    std::vector<polygon> coarse;
+    bg::simplify_coverage(coverage, coarse, 100.0);
+    BOOST_CHECK_EQUAL(coarse.size(), coverage.size());
+    for (auto const& polygon : coarse)
+    {
+        BOOST_CHECK_GE(bg::num_points(polygon), 3 + closing);
+    }
+
+    // Empty coverage
+    std::vector<polygon> empty, empty_output;
+    bg::simplify_coverage(empty, empty_output, 0.5);
+    BOOST_CHECK(empty_output.empty());
+}
+
+template <typename P>
+void test_multi()
+{
+    using polygon = bg::model::polygon<P>;
+    using multi_polygon = bg::model::multi_polygon<polygon>;
+
+    std::vector<polygon> const cells = make_coverage<polygon>(2, 1);
+
+    // The first cell with its island as a multi polygon, the second cell
+    std::vector<multi_polygon> coverage(2);
+    coverage[0].push_back(cells[0]);
+    coverage[0].push_back(cells[2]);
+    coverage[1].push_back(cells[1]);
+
+    std::vector<multi_polygon> simplified;
+    bg::simplify_coverage(coverage, simplified, 0.5);
+    BOOST_CHECK_EQUAL(simplified.size(), 2u);
+    BOOST_CHECK_EQUAL(simplified[0].size(), 2u);
+    BOOST_CHECK_CLOSE(bg::area(simplified[0]) + bg::area(simplified[1]), 200.0, 5.0);
+}
+
+int test_main(int, char* [])
+{
+    using point = bg::model::d2::point_xy<double>;
+
+    test_coverage<point, true, true>();
+    test_coverage<point, false, true>();
+    test_coverage<point, true, false>();
+    test_coverage<point, false, false>();
+    test_multi<point>();
+
+    return 0;
+}
@@ -0,0 +1,90 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cmath>
+#include <string>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/extensions/algorithms/visvalingam_whyatt_ranking.hpp>
+
+#include <boost/geometry/algorithms/simplify.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+
+
+template <typename Linestring>
+void test_distances(std::string const& caseid, Linestring const& linestring,
+                    std::initializer_list<double> distances)
+{
+    bg::visvalingam_whyatt_ranking<typename bg::point_type<Linestring>::type> const
+        ranking(linestring);
+
+    BOOST_CHECK_EQUAL(ranking.points().size(), boost::size(linestring));
+
+    std::size_t previous_count = boost::size(linestring);
+    for (double const distance : distances)
+    {
+        // Extracting gives the same as simplifying with Visvalingam-Whyatt
+        Linestring expected, extracted;
+        bg::simplify(linestring, expected, distance,
+                     bg::strategies::simplify::visvalingam_whyatt<>());
+        ranking.extract(distance, extracted);
+
+        BOOST_CHECK_MESSAGE(bg::to_wkt(extracted) == bg::to_wkt(expected),
+            caseid << " distance: " << distance
+            << " extracted: " << bg::wkt(extracted)
+            << " expected: " << bg::wkt(expected));
+        BOOST_CHECK_EQUAL(ranking.count(distance), boost::size(extracted));
+
+        // Larger distances never give more points
+        BOOST_CHECK_LE(boost::size(extracted), previous_count);
+        previous_count = boost::size(extracted);
+    }
+}
+
+template <typename P>
+void test_all()
+{
+    using linestring = bg::model::linestring<P>;
+
+    linestring zigzag;
+    bg::read_wkt("LINESTRING(0 10,1 7,1 9,2 6,2 7,3 4,3 5,5 3,4 5,6 2,6 3,9 1,"
+                 "7 3,10 1,9 2,12 1,10 2,13 1,11 2,14 1,12 2,16 1,14 2,17 3,"
+                 "15 3,18 4,16 4,19 5,17 5,20 6,18 6,21 8,19 7,21 9,19 8,21 10,"
+                 "19 9,21 11,19 10,20 13,19 11)", zigzag);
+    test_distances("zigzag", zigzag, {-1.0, 0.0, 0.5, 1.0, 1.5, 2.0, 3.0, 10.0});
+
+    // Collinear points have an effective area of zero
+    linestring collinear;
+    bg::read_wkt("LINESTRING(0 0,1 1,2 2,3 3,3 4)", collinear);
+    test_distances("collinear", collinear, {-1.0, 0.0, 1.0});
+
+    // A spiral, effective areas increase from the center
+    linestring spiral;
+    for (int i = 0; i < 1000; i++)
+    {
+        double const angle = i * 0.05;
+        double const radius = 1.0 + angle * (1.0 + 0.1 * std::sin(i * 1.3));
+        bg::append(spiral, P(radius * std::cos(angle), radius * std::sin(angle)));
+    }
+    test_distances("spiral", spiral, {0.01, 0.05, 0.1, 0.2, 0.5, 1.0, 5.0, 100.0});
+
+    // Degenerate cases
+    test_distances("empty", linestring(), {1.0});
+    linestring two;
+    bg::read_wkt("LINESTRING(0 0,1 1)", two);
+    test_distances("two", two, {1.0});
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+
+    return 0;
+}
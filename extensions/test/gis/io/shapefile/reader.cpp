@@ -0,0 +1,249 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/endian/conversion.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/equals.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+
+#include <boost/geometry/extensions/gis/io/shapefile/reader.hpp>
+
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::polygon<point_type> polygon_type;
+typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+typedef bg::model::box<point_type> box_type;
+
+// Writes a polygon shapefile, each record consisting of rings, a record
+// without rings is written as a null shape
+class shapefile_writer
+{
+public :
+    typedef std::vector<std::vector<point_type> > record_type;
+
+    void add(record_type const& rings)
+    {
+        m_records.push_back(rings);
+    }
+
+    void write(std::string const& shp_path, std::string const& shx_path) const
+    {
+        std::string shp, shx;
+        std::vector<int> offsets, lengths;
+        for (record_type const& rings : m_records)
+        {
+            std::string content;
+            if (rings.empty())
+            {
+                little(content, 0);
+            }
+            else
+            {
+                box_type box;
+                bg::assign_inverse(box);
+                int count = 0;
+                for (auto const& ring : rings)
+                {
+                    for (auto const& p : ring)
+                    {
+                        bg::expand(box, p);
+                        count++;
+                    }
+                }
+                little(content, 5);
+                add_box(content, box);
+                little(content, int(rings.size()));
+                little(content, count);
+                int part = 0;
+                for (auto const& ring : rings)
+                {
+                    little(content, part);
+                    part += int(ring.size());
+                }
+                for (auto const& ring : rings)
+                {
+                    for (auto const& p : ring)
+                    {
+                        little(content, bg::get<0>(p));
+                        little(content, bg::get<1>(p));
+                    }
+                }
+            }
+            offsets.push_back(int(100 + shp.size()) / 2);
+            lengths.push_back(int(content.size()) / 2);
+            big(shp, int(offsets.size()));
+            big(shp, lengths.back());
+            shp += content;
+        }
+
+        std::ofstream shp_file(shp_path.c_str(), std::ios::binary);
+        shp_file << header(int(100 + shp.size())) << shp;
+        std::ofstream shx_file(shx_path.c_str(), std::ios::binary);
+        shx_file << header(int(100 + 8 * offsets.size()));
+        for (std::size_t i = 0; i < offsets.size(); i++)
+        {
+            std::string record;
+            big(record, offsets[i]);
+            big(record, lengths[i]);
+            shx_file << record;
+        }
+    }
+
+private :
+    template <typename T>
+    static void little(std::string& s, T value)
+    {
+        boost::endian::native_to_little_inplace(
+            reinterpret_cast<typename std::conditional<sizeof(T) == 8, boost::int64_t, boost::int32_t>::type&>(value));
+        s.append(reinterpret_cast<char const*>(&value), sizeof(T));
+    }
+
+    static void big(std::string& s, int value)
+    {
+        boost::endian::native_to_big_inplace(value);
+        s.append(reinterpret_cast<char const*>(&value), sizeof(int));
+    }
+
+    static void add_box(std::string& s, box_type const& box)
+    {
+        little(s, bg::get<bg::min_corner, 0>(box));
+        little(s, bg::get<bg::min_corner, 1>(box));
+        little(s, bg::get<bg::max_corner, 0>(box));
+        little(s, bg::get<bg::max_corner, 1>(box));
+    }
+
+    std::string header(int size) const
+    {
+        std::string s;
+        big(s, 9994);
+        for (int i = 0; i < 5; i++)
+        {
+            big(s, 0);
+        }
+        big(s, size / 2);
+        little(s, 1000);
+        little(s, 5);
+        add_box(s, box_type(point_type(0, 0), point_type(30, 10)));
+        for (int i = 0; i < 4; i++)
+        {
+            little(s, 0.0);
+        }
+        return s;
+    }
+
+    std::vector<record_type> m_records;
+};
+
+std::vector<point_type> square(double x, double y, double size)
+{
+    // Clockwise, closed
+    return { point_type(x, y), point_type(x, y + size), point_type(x + size, y + size),
+             point_type(x + size, y), point_type(x, y) };
+}
+
+std::vector<point_type> reversed(std::vector<point_type> points)
+{
+    std::reverse(points.begin(), points.end());
+    return points;
+}
+
+int test_main(int, char*[])
+{
+    std::string const shp_path = "shapefile_reader_test.shp";
+    std::string const shx_path = "shapefile_reader_test.shx";
+
+    shapefile_writer writer;
+    writer.add({ square(0, 0, 4) });
+    writer.add({ square(10, 0, 4), reversed(square(11, 1, 2)) });
+    writer.add({});
+    writer.add({ square(20, 0, 1), square(25, 5, 5) });
+    writer.write(shp_path, shx_path);
+
+    {
+        bg::shapefile_reader const reader(shp_path);
+        BOOST_CHECK_EQUAL(reader.size(), 4u);
+        BOOST_CHECK_EQUAL(reader.shape_type(), 5);
+
+        box_type bounds;
+        reader.bounds(bounds);
+        BOOST_CHECK_EQUAL(bg::to_wkt(bounds), "POLYGON((0 0,0 10,30 10,30 0,0 0))");
+
+        // Random access
+        std::vector<polygon_type> polygons;
+        reader.read(1, polygons);
+        BOOST_CHECK_EQUAL(polygons.size(), 1u);
+        BOOST_CHECK_CLOSE(bg::area(polygons.front()), 12.0, 0.0001);
+
+        // A null shape results in nothing, and has no envelope
+        polygons.clear();
+        reader.read(2, polygons);
+        BOOST_CHECK(polygons.empty());
+        box_type box;
+        BOOST_CHECK(! reader.envelope(2, box));
+        BOOST_CHECK(reader.envelope(3, box));
+        BOOST_CHECK_EQUAL(bg::to_wkt(box), "POLYGON((20 0,20 10,30 10,30 0,20 0))");
+
+        // Prefilter on the stored bounding boxes
+        std::vector<std::size_t> const found
+            = reader.query(box_type(point_type(9, 1), point_type(21, 2)));
+        BOOST_CHECK_EQUAL(found.size(), 2u);
+        BOOST_CHECK(found == std::vector<std::size_t>({ 1, 3 }));
+        BOOST_CHECK(reader.query(box_type(point_type(5, 5), point_type(6, 6))).empty());
+
+        // Reading in parallel gives the same result as reading one by one
+        std::vector<polygon_type> expected;
+        for (std::size_t i = 0; i < reader.size(); i++)
+        {
+            reader.read(i, expected);
+        }
+        BOOST_CHECK_EQUAL(expected.size(), 4u);
+
+        for (std::size_t thread_count = 1; thread_count <= 3; thread_count++)
+        {
+            std::vector<polygon_type> all;
+            reader.read_all(all, thread_count);
+            BOOST_CHECK_EQUAL(all.size(), expected.size());
+            for (std::size_t i = 0; i < all.size() && i < expected.size(); i++)
+            {
+                BOOST_CHECK(bg::equals(all[i], expected[i]));
+            }
+        }
+
+        // Each record as a multi polygon
+        std::vector<multi_polygon_type> multi_polygons;
+        reader.read_records(found, multi_polygons, 2);
+        BOOST_CHECK_EQUAL(multi_polygons.size(), 2u);
+        BOOST_CHECK_EQUAL(multi_polygons[1].size(), 2u);
+
+        // Other geometry types are rejected
+        std::vector<point_type> points;
+        BOOST_CHECK_THROW(reader.read(0, points), bg::read_shapefile_exception);
+    }
+
+    // Missing and truncated files are detected
+    BOOST_CHECK_THROW(bg::shapefile_reader("missing.shp"), bg::read_shapefile_exception);
+    {
+        std::ofstream shx_file(shx_path.c_str(), std::ios::binary | std::ios::app);
+        shx_file << std::string(8, '\x7f');
+    }
+    BOOST_CHECK_THROW(bg::shapefile_reader(shp_path, shx_path), bg::read_shapefile_exception);
+
+    std::remove(shp_path.c_str());
+    std::remove(shx_path.c_str());
+
+    return 0;
+}
@@ -33,6 +33,9 @@
 
 #include <boost/geometry/extensions/multi/gis/io/wkb/read_wkb.hpp>
 
+#include <boost/geometry/geometries/adapted/boost_variant.hpp>
+#include <boost/variant/variant.hpp>
+
 namespace bg = boost::geometry;
 
 namespace { // anonymous
@@ -86,6 +89,47 @@ void test_geometry_equals(Geometry const& g_expected, std::string const& wkbhex)
         ", ACTUAL  : " << bg::wkt(g_wkb) );
 }
 
+
+template <typename Geometry>
+void test_srid(std::string const& wkbhex, boost::uint32_t expected_srid)
+{
+    byte_vector wkb;
+    BOOST_CHECK( bg::hex2wkb(wkbhex, std::back_inserter(wkb)) );
+    Geometry g_wkb;
+    boost::uint32_t srid = 12345;
+    BOOST_CHECK( bg::read_wkb(wkb.begin(), wkb.end(), g_wkb, srid) );
+    BOOST_CHECK_EQUAL(srid, expected_srid);
+}
+
+// Reads from a byte span (with a fast path for model::point<double>) and
+// from iterators, in another point type, which should give the same result
+template <typename Geometry, typename OtherGeometry>
+void test_byte_span(std::string const& wkbhex, std::string const& wkt)
+{
+    byte_vector wkb;
+    BOOST_CHECK( bg::hex2wkb(wkbhex, std::back_inserter(wkb)) );
+
+    Geometry g_span;
+    BOOST_CHECK( bg::read_wkb(wkb.data(), wkb.size(), g_span) );
+
+    OtherGeometry g_other;
+    BOOST_CHECK( bg::read_wkb(wkb.begin(), wkb.end(), g_other) );
+
+    Geometry g_expected;
+    bg::read_wkt(wkt, g_expected);
+
+    BOOST_CHECK_MESSAGE( bg::equals(g_span, g_expected),
+        " EXPECTED: " << bg::wkt(g_expected) << ", ACTUAL  : " << bg::wkt(g_span) );
+    BOOST_CHECK_EQUAL( bg::to_wkt(g_other), bg::to_wkt(g_span) );
+
+    // Truncated WKB can not be read
+    for (std::size_t length = 0; length < wkb.size(); length++)
+    {
+        Geometry g_truncated;
+        BOOST_CHECK( bg::read_wkb(wkb.data(), length, g_truncated) == false );
+    }
+}
+
 //template <typename P, bool Result>
 //void test_polygon_wkt(std::string const& wkt)
 //{
@@ -114,35 +158,51 @@ int test_main(int, char* [])
         test_geometry_equals_old<point3d_type, true>(
             "01E90300005839B4C876BEF33F83C0CAA145B616404F401361C3332240", "POINT(1.234 5.678 9.1011)");
 
-        //     // XYZ - POINT(1.234 5.678 99) - Z coordinate ignored
-        //     test_geometry_equals<point_type, true>(
-        //         "01010000805839B4C876BEF33F83C0CAA145B616400000000000C05840", "POINT(1.234 5.678)");
-        // 
-        //     // SRID=32632;POINT(1.234 5.678) - PostGIS EWKT
-        //     test_geometry_equals<point_type, false>(
-        //         "0101000020787F00005839B4C876BEF33F83C0CAA145B61640", "POINT (1.234 5.678)");
-        // 
-        //     // SRID=4326;POINT(1.234 5.678 99) - PostGIS EWKT
-        //     test_geometry_equals<point_type, false>(
-        //         "01010000A0E61000005839B4C876BEF33F83C0CAA145B616400000000000C05840", "POINT(1.234 5.678)");
-        // 
-        //     // POINTM(1.234 5.678 99) - XYM with M compound ignored
-        //     test_geometry_equals<point_type, true>(
-        //         "01010000405839B4C876BEF33F83C0CAA145B616400000000000C05840", "POINT (1.234 5.678)");
-        // 
-        //     // SRID=32632;POINTM(1.234 5.678 99)
-        //     test_geometry_equals<point_type, false>(
-        //         "0101000060787F00005839B4C876BEF33F83C0CAA145B616400000000000C05840", "POINT (1.234 5.678)");
-        // 
-        //     // POINT(1.234 5.678 15 79) - XYZM - Z and M compounds ignored
-        //     test_geometry_equals<point_type, true>(
-        //         "01010000C05839B4C876BEF33F83C0CAA145B616400000000000002E400000000000C05340",
-        //         "POINT (1.234 5.678)");
-        // 
-        //     // SRID=4326;POINT(1.234 5.678 15 79) - XYZM + SRID
-        //     test_geometry_equals<point_type, false>(
-        //         "01010000E0E61000005839B4C876BEF33F83C0CAA145B616400000000000002E400000000000C05340",
-        //         "POINT (1.234 5.678)");
+        // XYZ - POINT(1.234 5.678 99) - Z coordinate ignored
+        test_geometry_equals_old<point_type, true>(
+            "01010000805839B4C876BEF33F83C0CAA145B616400000000000C05840", "POINT(1.234 5.678)");
+
+        // SRID=32632;POINT(1.234 5.678) - PostGIS EWKT
+        test_geometry_equals_old<point_type, true>(
+            "0101000020787F00005839B4C876BEF33F83C0CAA145B61640", "POINT (1.234 5.678)");
+
+        // SRID=4326;POINT(1.234 5.678 99) - PostGIS EWKT
+        test_geometry_equals_old<point_type, true>(
+            "01010000A0E61000005839B4C876BEF33F83C0CAA145B616400000000000C05840", "POINT(1.234 5.678)");
+        test_geometry_equals_old<point3d_type, true>(
+            "01010000A0E61000005839B4C876BEF33F83C0CAA145B616400000000000C05840", "POINT(1.234 5.678 99)");
+
+        // POINTM(1.234 5.678 99) - XYM with M compound ignored
+        test_geometry_equals_old<point_type, true>(
+            "01010000405839B4C876BEF33F83C0CAA145B616400000000000C05840", "POINT (1.234 5.678)");
+        test_geometry_equals_old<point3d_type, true>(
+            "01010000405839B4C876BEF33F83C0CAA145B616400000000000C05840", "POINT (1.234 5.678 0)");
+
+        // SRID=32632;POINTM(1.234 5.678 99)
+        test_geometry_equals_old<point_type, true>(
+            "0101000060787F00005839B4C876BEF33F83C0CAA145B616400000000000C05840", "POINT (1.234 5.678)");
+
+        // POINT(1.234 5.678 15 79) - XYZM - Z and M compounds ignored
+        test_geometry_equals_old<point_type, true>(
+            "01010000C05839B4C876BEF33F83C0CAA145B616400000000000002E400000000000C05340",
+            "POINT (1.234 5.678)");
+        test_geometry_equals_old<point3d_type, true>(
+            "01010000C05839B4C876BEF33F83C0CAA145B616400000000000002E400000000000C05340",
+            "POINT (1.234 5.678 15)");
+
+        // SRID=4326;POINT(1.234 5.678 15 79) - XYZM + SRID
+        test_geometry_equals_old<point_type, true>(
+            "01010000E0E61000005839B4C876BEF33F83C0CAA145B616400000000000002E400000000000C05340",
+            "POINT (1.234 5.678)");
+
+        // ISO POINT ZM (1.234 5.678 15 79)
+        test_geometry_equals_old<point3d_type, true>(
+            "01B90B00005839B4C876BEF33F83C0CAA145B616400000000000002E400000000000C05340",
+            "POINT (1.234 5.678 15)");
+
+        // Big endian (XDR) POINT(1.234 5.678)
+        test_geometry_equals_old<point_type, true>(
+            "00000000013FF3BE76C8B439584016B645A1CAC083", "POINT (1.234 5.678)");
 
     }
     
@@ -229,7 +289,8 @@ int test_main(int, char* [])
                 "0102000000030000005839B4C876BEF33F83C0CAA145B616404F401361C333224062A1D634EF3824409CC420B072482A40EB73B515FB2B3040"
                 );
 
-            test_geometry_equals<linestring_type, false>
+            // EWKB with Z, Z coordinates ignored
+            test_geometry_equals<linestring_type, true>
                 (
                 linestring, 
                 "0102000080030000005839B4C876BEF33F83C0CAA145B616400000000000C058404F401361C333224062A1D634EF3824400000000000C058409CC420B072482A40EB73B515FB2B30400000000000C05840"
@@ -491,5 +552,84 @@ int test_main(int, char* [])
             );
     }
     
+    //
+    // Geometries with Z/M, SRID, collections and dynamic geometries
+    //
+
+    // SRID=32632;POINT(1.234 5.678)
+    test_srid<point_type>("0101000020787F00005839B4C876BEF33F83C0CAA145B61640", 32632);
+    test_srid<point_type>("01010000005839B4C876BEF33F83C0CAA145B61640", 0);
+
+    {
+        typedef bg::model::d2::point_xy<float> point_xy_type;
+        typedef bg::model::linestring<point_xy_type> linestring_xy_type;
+        typedef bg::model::polygon<point_xy_type> polygon_xy_type;
+        typedef bg::model::multi_polygon<polygon_xy_type> multipolygon_xy_type;
+
+        // LINESTRING(1.234 5.678,9.1011 10.1112,13.1415 16.1718)
+        test_byte_span<linestring_type, linestring_xy_type>(
+            "0102000000030000005839B4C876BEF33F83C0CAA145B616404F401361C333224062A1D634EF3824409CC420B072482A40EB73B515FB2B3040",
+            "LINESTRING(1.234 5.678,9.1011 10.1112,13.1415 16.1718)");
+
+        // The same in big endian
+        test_byte_span<linestring_type, linestring_xy_type>(
+            "0000000002000000033FF3BE76C8B439584016B645A1CAC083402233C36113404F402438EF34D6A162402A4872B020C49C40302BFB15B573EB",
+            "LINESTRING(1.234 5.678,9.1011 10.1112,13.1415 16.1718)");
+
+        // MULTIPOLYGON(((35 10,10 20,15 40,45 45,35 10),(20 30,35 35,30 20,20 30)))
+        test_byte_span<multipolygon_type, multipolygon_xy_type>(
+            "0106000000010000000103000000020000000500000000000000008041400000000000002440000000000000244000000000000034400000000000002e40000000000000444000000000008046400000000000804640000000000080414000000000000024400400000000000000000034400000000000003e40000000000080414000000000008041400000000000003e40000000000000344000000000000034400000000000003e40",
+            "MULTIPOLYGON(((35 10,10 20,15 40,45 45,35 10),(20 30,35 35,30 20,20 30)))");
+
+        // LINESTRING Z (1 2 3,2 3 4,4 5 6) into a 2D linestring
+        test_byte_span<linestring_type, linestring_xy_type>(
+            "01EA03000003000000000000000000F03F00000000000000400000000000000840000000000000004000000000000008400000000000001040000000000000104000000000000014400000000000001840",
+            "LINESTRING(1 2,2 3,4 5)");
+    }
+
+    typedef boost::variant<point_type, linestring_type, polygon_type> variant_type;
+    typedef bg::model::geometry_collection<variant_type> collection_type;
+
+    // GEOMETRYCOLLECTION(POINT(1 2),LINESTRING(1 2,2 3))
+    std::string const collection_hex = "010700000002000000"
+        "0101000000000000000000F03F0000000000000040"
+        "010200000002000000000000000000F03F000000000000004000000000000000400000000000000840";
+
+    {
+        byte_vector wkb;
+        bg::hex2wkb(collection_hex, std::back_inserter(wkb));
+
+        collection_type collection;
+        BOOST_CHECK( bg::read_wkb(wkb.data(), wkb.size(), collection) );
+        BOOST_CHECK_EQUAL( bg::to_wkt(collection),
+                           "GEOMETRYCOLLECTION(POINT(1 2),LINESTRING(1 2,2 3))" );
+
+        // A multi polygon can not be stored in this collection
+        byte_vector wkb_multi;
+        bg::hex2wkb("010700000001000000010600000000000000", std::back_inserter(wkb_multi));
+        BOOST_CHECK( bg::read_wkb(wkb_multi.data(), wkb_multi.size(), collection) == false );
+
+        // A collection is not a point
+        point_type point;
+        BOOST_CHECK( bg::read_wkb(wkb.data(), wkb.size(), point) == false );
+    }
+
+    {
+        byte_vector wkb;
+        bg::hex2wkb("010200000003000000000000000000F03F00000000000000400000000000000040000000000000084000000000000010400000000000001440",
+            std::back_inserter(wkb));
+
+        variant_type variant;
+        BOOST_CHECK( bg::read_wkb(wkb.data(), wkb.size(), variant) );
+        BOOST_CHECK_EQUAL( bg::to_wkt(variant), "LINESTRING(1 2,2 3,4 5)" );
+    }
+
+    // Corrupt numbers of points or geometries
+    test_geometry_parse_failure<linestring_type>("0102000000FFFFFFFF000000000000F03F", "");
+    test_geometry_parse_failure<multipoint_type>("0104000000FFFFFFFF", "");
+    test_geometry_parse_failure<point_type>("0201000000000000000000F03F0000000000000040", "");
+    test_geometry_parse_failure<point_type>("0108000000000000000000F03F0000000000000040", "");
+    test_geometry_parse_failure<point_type>("0102000000000000000000F03F0000000000000040", "");
+
     return 0;
 }
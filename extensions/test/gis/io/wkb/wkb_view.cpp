@@ -0,0 +1,161 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/cstdint.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/centroid.hpp>
+#include <boost/geometry/algorithms/convert.hpp>
+#include <boost/geometry/algorithms/distance.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/length.hpp>
+#include <boost/geometry/algorithms/num_points.hpp>
+#include <boost/geometry/algorithms/perimeter.hpp>
+#include <boost/geometry/algorithms/within.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+
+#include <boost/geometry/extensions/gis/io/wkb/utility.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/wkb_view.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/write_wkb.hpp>
+
+
+typedef std::vector<boost::uint8_t> byte_vector;
+
+inline byte_vector from_hex(std::string const& hex)
+{
+    byte_vector wkb;
+    BOOST_CHECK(bg::hex2wkb(hex, std::back_inserter(wkb)));
+    return wkb;
+}
+
+template <typename Point>
+void test_linestring()
+{
+    bg::model::linestring<Point> ls;
+    bg::read_wkt("LINESTRING(0 0,3 4,3 8)", ls);
+    byte_vector wkb;
+    BOOST_CHECK(bg::write_wkb(ls, std::back_inserter(wkb)));
+
+    bg::wkb_linestring_view<Point> const view(wkb.data(), wkb.size());
+    BOOST_CHECK_EQUAL(boost::size(view), 3u);
+    BOOST_CHECK_CLOSE(bg::length(view), 9.0, 0.0001);
+    BOOST_CHECK_CLOSE(bg::distance(Point(6, 8), view), 3.0, 0.0001);
+    BOOST_CHECK_EQUAL(bg::to_wkt(view), "LINESTRING(0 0,3 4,3 8)");
+
+    bg::model::box<Point> box;
+    bg::envelope(view, box);
+    BOOST_CHECK_EQUAL(bg::to_wkt(box), "POLYGON((0 0,0 8,3 8,3 0,0 0))");
+
+    // Truncated WKB is rejected when the view is constructed
+    BOOST_CHECK_THROW((bg::wkb_linestring_view<Point>(wkb.data(), wkb.size() - 1)),
+                      bg::read_wkb_exception);
+    // As is another geometry type
+    BOOST_CHECK_THROW((bg::wkb_polygon_view<Point>(wkb.data(), wkb.size())),
+                      bg::read_wkb_exception);
+}
+
+template <typename Point>
+void test_polygon()
+{
+    // XDR, with a hole
+    byte_vector const wkb = from_hex(
+        "0000000003000000020000000540240000000000000000000000000000402400"
+        "00000000004010000000000000402C0000000000004010000000000000402C00"
+        "0000000000000000000000000040240000000000000000000000000000000000"
+        "0540260000000000003FF0000000000000402A0000000000003FF00000000000"
+        "00402A0000000000004008000000000000402600000000000040080000000000"
+        "0040260000000000003FF0000000000000");
+
+    typedef bg::wkb_polygon_view<Point> view_type;
+    view_type const view(wkb.data(), wkb.size());
+
+    BOOST_CHECK_EQUAL(boost::size(bg::interior_rings(view)), 1u);
+    BOOST_CHECK_EQUAL(bg::num_points(view), 10u);
+    BOOST_CHECK_CLOSE(bg::area(view), 12.0, 0.0001);
+    BOOST_CHECK_CLOSE(bg::perimeter(view), 24.0, 0.0001);
+    BOOST_CHECK(bg::within(Point(10.5, 2), view));
+    BOOST_CHECK(! bg::within(Point(12, 2), view));
+    BOOST_CHECK_CLOSE(bg::distance(Point(12, 2), view), 1.0, 0.0001);
+
+    Point centroid;
+    bg::centroid(view, centroid);
+    BOOST_CHECK_CLOSE(bg::get<0>(centroid), 12.0, 0.0001);
+    BOOST_CHECK_CLOSE(bg::get<1>(centroid), 2.0, 0.0001);
+
+    bg::model::polygon<Point> copy;
+    bg::convert(view, copy);
+    BOOST_CHECK_EQUAL(bg::to_wkt(copy),
+        "POLYGON((10 0,10 4,14 4,14 0,10 0),(11 1,13 1,13 3,11 3,11 1))");
+
+    // EWKB with Z and an SRID, Z is not assigned to a 2D point
+    byte_vector const ewkb = from_hex(
+        "01030000A0E61000000100000005000000000000000000000000000000000000"
+        "000000000000001C40000000000000000000000000000010400000000000001C"
+        "40000000000000104000000000000010400000000000001C4000000000000010"
+        "4000000000000000000000000000001C40000000000000000000000000000000"
+        "000000000000001C40");
+    view_type const z_view(ewkb.data(), ewkb.size());
+    BOOST_CHECK_EQUAL(z_view.srid(), 4326u);
+    BOOST_CHECK(boost::empty(bg::interior_rings(z_view)));
+    BOOST_CHECK_CLOSE(bg::area(z_view), 16.0, 0.0001);
+}
+
+template <typename Point>
+void test_multi_polygon()
+{
+    byte_vector const wkb = from_hex(
+        "0106000000020000000103000000010000000500000000000000000000000000"
+        "0000000000000000000000000000000000000000104000000000000010400000"
+        "0000000010400000000000001040000000000000000000000000000000000000"
+        "0000000000000103000000020000000500000000000000000024400000000000"
+        "000000000000000000244000000000000010400000000000002C400000000000"
+        "0010400000000000002C40000000000000000000000000000024400000000000"
+        "000000050000000000000000002640000000000000F03F0000000000002A4000"
+        "0000000000F03F0000000000002A400000000000000840000000000000264000"
+        "000000000008400000000000002640000000000000F03F");
+
+    bg::wkb_multi_polygon_view<Point> const view(wkb.data(), wkb.size());
+    BOOST_CHECK_EQUAL(boost::size(view), 2u);
+    BOOST_CHECK_EQUAL(bg::num_points(view), 15u);
+    BOOST_CHECK_CLOSE(bg::area(view), 28.0, 0.0001);
+    BOOST_CHECK(bg::within(Point(1, 1), view));
+    BOOST_CHECK(bg::within(Point(10.5, 2), view));
+    BOOST_CHECK(! bg::within(Point(12, 2), view));
+
+    bg::model::box<Point> box;
+    bg::envelope(view, box);
+    BOOST_CHECK_EQUAL(bg::to_wkt(box), "POLYGON((0 0,0 4,14 4,14 0,0 0))");
+
+    // A polygon cut short is detected
+    BOOST_CHECK_THROW((bg::wkb_multi_polygon_view<Point>(wkb.data(), wkb.size() - 8)),
+                      bg::read_wkb_exception);
+
+    // Empty
+    bg::wkb_multi_polygon_view<Point> const empty;
+    BOOST_CHECK(boost::empty(empty));
+    BOOST_CHECK_EQUAL(bg::area(empty), 0.0);
+}
+
+int test_main(int, char* [])
+{
+    typedef bg::model::d2::point_xy<double> point_type;
+    test_linestring<point_type>();
+    test_polygon<point_type>();
+    test_multi_polygon<point_type>();
+
+    test_linestring<bg::model::point<float, 2, bg::cs::cartesian> >();
+    test_polygon<bg::model::point<float, 2, bg::cs::cartesian> >();
+
+    return 0;
+}
@@ -32,6 +32,10 @@
 #include <boost/geometry/multi/io/wkt/wkt.hpp> 
 
 #include <boost/geometry/extensions/multi/gis/io/wkb/write_wkb.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/read_wkb.hpp>
+
+#include <boost/geometry/geometries/adapted/boost_variant.hpp>
+#include <boost/variant/variant.hpp>
 
 #include <boost/range/algorithm_ext/push_back.hpp>
 #include <boost/assign/list_of.hpp>
@@ -55,6 +59,27 @@ void test_geometry_equals(Geometry const& geometry, std::string const& wkbhex)
     
     BOOST_CHECK_EQUAL( wkbhex, hex_out);
 }
+
+template <typename Geometry>
+void test_ewkb(Geometry const& geometry, boost::uint32_t srid, std::string const& wkbhex)
+{
+    std::string wkb_out;
+    bg::write_ewkb(geometry, std::back_inserter(wkb_out), srid);
+
+    std::string hex_out;
+    BOOST_CHECK( bg::wkb2hex(wkb_out.begin(), wkb_out.end(), hex_out) );
+
+    boost::algorithm::to_lower(hex_out);
+
+    BOOST_CHECK_EQUAL( wkbhex, hex_out);
+
+    // Read back, with the same SRID
+    Geometry read_back;
+    boost::uint32_t read_srid = 0;
+    BOOST_CHECK( bg::read_wkb(wkb_out.data(), wkb_out.size(), read_back, read_srid) );
+    BOOST_CHECK_EQUAL( read_srid, srid );
+    BOOST_CHECK_EQUAL( bg::to_wkt(read_back), bg::to_wkt(geometry) );
+}
 } // namespace anonymous
 
 int test_main(int, char* [])
@@ -352,5 +377,57 @@ int test_main(int, char* [])
             );
     }
     
+    //
+    // EWKB, collections and dynamic geometries
+    //
+
+    {
+        point_type point(1.0, 2.0);
+        test_ewkb(point, 0, "0101000000000000000000f03f0000000000000040");
+        test_ewkb(point, 4326, "0101000020e6100000000000000000f03f0000000000000040");
+
+        point3d_type point3d(1.0, 2.0, 3.0);
+        test_ewkb(point3d, 0, "0101000080000000000000f03f00000000000000400000000000000840");
+    }
+
+    {
+        // The SRID is only written for the multi geometry itself
+        multipoint_type multipoint;
+        bg::append(multipoint, point_type(1.0, 2.0));
+        test_ewkb(multipoint, 4326,
+            "0104000020e6100000010000000101000000000000000000f03f0000000000000040");
+    }
+
+    typedef boost::variant<point_type, linestring_type, polygon_type> variant_type;
+
+    {
+        bg::model::geometry_collection<variant_type> collection;
+        collection.push_back(point_type(1.0, 2.0));
+        linestring_type linestring;
+        bg::append(linestring, point_type(1.0, 2.0));
+        bg::append(linestring, point_type(2.0, 3.0));
+        collection.push_back(linestring);
+
+        test_geometry_equals<bg::model::geometry_collection<variant_type>, true>
+            (
+            collection,
+            "010700000002000000"
+            "0101000000000000000000f03f0000000000000040"
+            "010200000002000000000000000000f03f000000000000004000000000000000400000000000000840"
+            );
+
+        test_ewkb(collection, 3857,
+            "0107000020110f000002000000"
+            "0101000000000000000000f03f0000000000000040"
+            "010200000002000000000000000000f03f000000000000004000000000000000400000000000000840");
+
+        variant_type variant = linestring;
+        test_geometry_equals<variant_type, true>
+            (
+            variant,
+            "010200000002000000000000000000f03f000000000000004000000000000000400000000000000840"
+            );
+    }
+
     return 0;
 }
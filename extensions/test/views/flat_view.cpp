@@ -0,0 +1,141 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/extensions/views/flat_view.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/centroid.hpp>
+#include <boost/geometry/algorithms/convert.hpp>
+#include <boost/geometry/algorithms/distance.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/equals.hpp>
+#include <boost/geometry/algorithms/intersects.hpp>
+#include <boost/geometry/algorithms/length.hpp>
+#include <boost/geometry/algorithms/num_points.hpp>
+#include <boost/geometry/algorithms/perimeter.hpp>
+#include <boost/geometry/algorithms/within.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+
+
+// Three polygons, the second with a hole, in one coordinate buffer
+struct flat_data
+{
+    std::vector<double> coordinates
+    {
+        0, 0, 0, 4, 4, 4, 4, 0, 0, 0,
+        10, 0, 10, 4, 14, 4, 14, 0, 10, 0,
+        11, 1, 13, 1, 13, 3, 11, 3, 11, 1,
+        20, 0, 20, 1, 21, 0, 20, 0
+    };
+    std::vector<std::size_t> ring_offsets { 0, 5, 10, 15, 19 };
+    std::vector<std::size_t> polygon_offsets { 0, 1, 3, 4 };
+};
+
+template <typename Point>
+void test_linestring()
+{
+    std::vector<double> const coordinates { 0, 0, 3, 4, 3, 8 };
+    bg::flat_linestring_view<Point> const view(coordinates.data(), 3);
+
+    BOOST_CHECK_EQUAL(boost::size(view), 3u);
+    BOOST_CHECK_CLOSE(bg::length(view), 9.0, 0.0001);
+    BOOST_CHECK_CLOSE(bg::distance(Point(6, 8), view), 3.0, 0.0001);
+    BOOST_CHECK_EQUAL(bg::to_wkt(view), "LINESTRING(0 0,3 4,3 8)");
+
+    bg::model::box<Point> box;
+    bg::envelope(view, box);
+    BOOST_CHECK_EQUAL(bg::to_wkt(box), "POLYGON((0 0,0 8,3 8,3 0,0 0))");
+
+    // The points are not copied
+    BOOST_CHECK(static_cast<void const*>(&*boost::begin(view)) == coordinates.data());
+}
+
+template <typename Point>
+void test_polygon()
+{
+    using polygon_view = bg::flat_polygon_view<Point>;
+    using polygon = bg::model::polygon<Point>;
+
+    flat_data const data;
+    polygon_view const view(data.coordinates.data(), data.ring_offsets.data() + 1, 2);
+
+    BOOST_CHECK_EQUAL(bg::num_interior_rings(view), 1u);
+    BOOST_CHECK_EQUAL(bg::num_points(view), 10u);
+    BOOST_CHECK_CLOSE(bg::area(view), 12.0, 0.0001);
+    BOOST_CHECK_CLOSE(bg::perimeter(view), 24.0, 0.0001);
+    BOOST_CHECK_EQUAL(bg::to_wkt(view),
+        "POLYGON((10 0,10 4,14 4,14 0,10 0),(11 1,13 1,13 3,11 3,11 1))");
+
+    Point centroid;
+    bg::centroid(view, centroid);
+    BOOST_CHECK_CLOSE(bg::get<0>(centroid), 12.0, 0.0001);
+
+    BOOST_CHECK(bg::within(Point(10.5, 2), view));
+    BOOST_CHECK(! bg::within(Point(12, 2), view));
+    BOOST_CHECK_CLOSE(bg::distance(Point(12, 2), view), 1.0, 0.0001);
+
+    // Algorithms based on turns, with a model and with another view
+    polygon crossing, inside_hole;
+    bg::read_wkt("POLYGON((13 -1,13 1,16 1,16 -1,13 -1))", crossing);
+    bg::read_wkt("POLYGON((11.5 1.5,11.5 2.5,12.5 2.5,12.5 1.5,11.5 1.5))", inside_hole);
+    BOOST_CHECK(bg::intersects(view, crossing));
+    BOOST_CHECK(! bg::intersects(view, inside_hole));
+
+    polygon_view const first(data.coordinates.data(), data.ring_offsets.data(), 1);
+    BOOST_CHECK(! bg::intersects(view, first));
+    BOOST_CHECK(bg::intersects(first, first));
+
+    polygon copy;
+    bg::convert(view, copy);
+    BOOST_CHECK(bg::equals(view, copy));
+}
+
+template <typename Point>
+void test_multi_polygon()
+{
+    using multi_polygon_view = bg::flat_multi_polygon_view<Point>;
+
+    flat_data const data;
+    multi_polygon_view const view(data.coordinates.data(), data.ring_offsets.data(),
+                                  data.polygon_offsets.data(), 3);
+
+    BOOST_CHECK_EQUAL(boost::size(view), 3u);
+    BOOST_CHECK_EQUAL(bg::num_points(view), 19u);
+    BOOST_CHECK_CLOSE(bg::area(view), 16.0 + 12.0 + 0.5, 0.0001);
+
+    bg::model::box<Point> box;
+    bg::envelope(view, box);
+    BOOST_CHECK_EQUAL(bg::to_wkt(box), "POLYGON((0 0,0 4,21 4,21 0,0 0))");
+
+    BOOST_CHECK(bg::within(Point(20.2, 0.2), view));
+    BOOST_CHECK(! bg::within(Point(12, 2), view));
+    BOOST_CHECK_CLOSE(bg::distance(Point(7, 2), view), 3.0, 0.0001);
+
+    bg::model::polygon<Point> crossing;
+    bg::read_wkt("POLYGON((3 3,3 5,11 5,11 3,3 3))", crossing);
+    BOOST_CHECK(bg::intersects(view, crossing));
+    BOOST_CHECK(bg::intersects(view, view));
+
+    // An empty view
+    multi_polygon_view const empty;
+    BOOST_CHECK_EQUAL(bg::area(empty), 0.0);
+}
+
+int test_main(int, char* [])
+{
+    test_linestring<bg::model::point<double, 2, bg::cs::cartesian> >();
+    test_polygon<bg::model::point<double, 2, bg::cs::cartesian> >();
+    test_multi_polygon<bg::model::point<double, 2, bg::cs::cartesian> >();
+    return 0;
+}
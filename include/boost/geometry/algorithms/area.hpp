@@ -19,6 +19,8 @@
 #ifndef BOOST_GEOMETRY_ALGORITHMS_AREA_HPP
 #define BOOST_GEOMETRY_ALGORITHMS_AREA_HPP
 
+#include <type_traits>
+
 #include <boost/core/ignore_unused.hpp>
 #include <boost/range/begin.hpp>
 #include <boost/range/end.hpp>
@@ -38,6 +40,7 @@
 #include <boost/geometry/algorithms/detail/calculate_sum.hpp>
 // #include <boost/geometry/algorithms/detail/throw_on_empty_input.hpp>
 #include <boost/geometry/algorithms/detail/multi_sum.hpp>
+#include <boost/geometry/algorithms/detail/range_kernels.hpp>
 #include <boost/geometry/algorithms/detail/visit.hpp>
 
 #include <boost/geometry/algorithms/area_result.hpp>
@@ -80,6 +83,38 @@ struct box_area
 };
 
 
+// The cartesian strategy on a ring with coordinates stored as x, y, x, y, ...
+// is calculated by a vectorized kernel, with the same formula
+template <typename Ring, typename Strategy, typename Result>
+struct use_range_kernel
+    : std::integral_constant
+        <
+            bool,
+            (std::is_same<Strategy, strategy::area::cartesian<> >::value
+             || std::is_same<Strategy, strategy::area::cartesian<double> >::value)
+            && std::is_same<Result, double>::value
+            && detail::range_kernels::is_contiguous_xy<Ring>::value
+        >
+{};
+
+template <typename Ring>
+inline double ring_area_kernel(Ring const& ring)
+{
+    double const* xy = detail::range_kernels::coordinates(ring);
+    std::size_t const count = boost::size(ring);
+    double sum = detail::range_kernels::area_sum(xy, count);
+    if (geometry::closure<Ring>::value == open)
+    {
+        double const* last = xy + 2 * (count - 1);
+        sum += (last[0] + xy[0]) * (last[1] - xy[1]);
+    }
+    if (geometry::point_order<Ring>::value == counterclockwise)
+    {
+        sum = -sum;
+    }
+    return sum / 2.0;
+}
+
 struct ring_area
 {
     template <typename Ring, typename Strategies>
@@ -87,21 +122,39 @@ struct ring_area
     apply(Ring const& ring, Strategies const& strategies)
     {
         using strategy_type = decltype(strategies.area(ring));
-
-        BOOST_CONCEPT_ASSERT( (geometry::concepts::AreaStrategy<Ring, strategy_type>) );
-        assert_dimension<Ring, 2>();
-
-        // Ignore warning (because using static method sometimes) on strategy
-        boost::ignore_unused(strategies);
+        using result_type = typename area_result<Ring, Strategies>::type;
 
         // An open ring has at least three points,
         // A closed ring has at least four points,
         // if not, there is no (zero) area
         if (boost::size(ring) < detail::minimum_ring_size<Ring>::value)
         {
-            return typename area_result<Ring, Strategies>::type();
+            return result_type();
         }
 
+        return apply(ring, strategies,
+                     use_range_kernel<Ring, strategy_type, result_type>());
+    }
+
+    template <typename Ring, typename Strategies>
+    static inline typename area_result<Ring, Strategies>::type
+    apply(Ring const& ring, Strategies const& , std::true_type)
+    {
+        return ring_area_kernel(ring);
+    }
+
+    template <typename Ring, typename Strategies>
+    static inline typename area_result<Ring, Strategies>::type
+    apply(Ring const& ring, Strategies const& strategies, std::false_type)
+    {
+        using strategy_type = decltype(strategies.area(ring));
+
+        BOOST_CONCEPT_ASSERT( (geometry::concepts::AreaStrategy<Ring, strategy_type>) );
+        assert_dimension<Ring, 2>();
+
+        // Ignore warning (because using static method sometimes) on strategy
+        boost::ignore_unused(strategies);
+
         detail::closed_clockwise_view<Ring const> const view(ring);
         auto it = boost::begin(view);
         auto const end = boost::end(view);
@@ -77,36 +77,40 @@ struct translating_transformer<Geometry, areal_tag, cartesian_tag>
     typedef point_type result_type;
     
     explicit translating_transformer(Geometry const& geom)
-        : m_origin(NULL)
+        : m_has_origin(false)
     {
         geometry::point_iterator<Geometry const>
             pt_it = geometry::points_begin(geom);
         if ( pt_it != geometry::points_end(geom) )
         {
-            m_origin = boost::addressof(*pt_it);
+            // Copied, the iterator might return the point by value
+            m_origin = *pt_it;
+            m_has_origin = true;
         }
     }
 
     explicit translating_transformer(point_type const& origin)
-        : m_origin(boost::addressof(origin))
+        : m_origin(origin)
+        , m_has_origin(true)
     {}
 
     result_type apply(point_type const& pt) const
     {
         point_type res = pt;
-        if ( m_origin )
-            geometry::subtract_point(res, *m_origin);
+        if ( m_has_origin )
+            geometry::subtract_point(res, m_origin);
         return res;
     }
 
     template <typename ResPt>
     void apply_reverse(ResPt & res_pt) const
     {
-        if ( m_origin )
-            geometry::add_point(res_pt, *m_origin);
+        if ( m_has_origin )
+            geometry::add_point(res_pt, m_origin);
     }
 
-    const point_type * m_origin;
+    point_type m_origin;
+    bool m_has_origin;
 };
 
 
@@ -468,7 +468,13 @@ struct intersection_linear_areal_point
                typename rescale_policy_type<RobustPolicy>::type
            >::value));
 
-        typedef geometry::segment_ratio<typename geometry::coordinate_type<PointOut>::type> ratio_type;
+        typedef geometry::segment_ratio
+            <
+                typename geometry::detail::promoted_to_exact_integral
+                    <
+                        typename geometry::coordinate_type<PointOut>::type
+                    >::type
+            > ratio_type;
 
         typedef detail::overlay::turn_info
             <
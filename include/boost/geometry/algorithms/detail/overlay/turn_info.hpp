@@ -78,7 +78,13 @@ struct turn_operation
 template
 <
     typename Point,
-    typename SegmentRatio = geometry::segment_ratio<typename coordinate_type<Point>::type>,
+    typename SegmentRatio = geometry::segment_ratio
+        <
+            typename geometry::detail::promoted_to_exact_integral
+                <
+                    typename coordinate_type<Point>::type
+                >::type
+        >,
     typename Operation = turn_operation<Point, SegmentRatio>,
     typename Container = boost::array<Operation, 2>
 >
@@ -0,0 +1,231 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_RANGE_KERNELS_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_RANGE_KERNELS_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include <boost/config.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/size.hpp>
+
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/geometries/point.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+
+// SSE2 is part of x86-64, on other platforms the kernels are loops
+// with independent sums, which can be pipelined or vectorized
+#if ! defined(BOOST_GEOMETRY_NO_SIMD) \
+    && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define BOOST_GEOMETRY_RANGE_KERNELS_SSE2
+#include <emmintrin.h>
+#endif
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace range_kernels
+{
+
+// Points of which the coordinates are an array of two doubles
+template <typename Point>
+struct is_xy_array
+    : std::false_type
+{};
+
+template <typename CoordinateSystem>
+struct is_xy_array<model::point<double, 2, CoordinateSystem> >
+    : std::true_type
+{};
+
+template <typename CoordinateSystem>
+struct is_xy_array<model::d2::point_xy<double, CoordinateSystem> >
+    : std::true_type
+{};
+
+template <typename Point, typename Allocator>
+std::true_type is_std_vector(std::vector<Point, Allocator> const*);
+
+template <typename Point>
+std::false_type is_std_vector(...);
+
+/*!
+\brief Internal, true if the points of the range are stored contiguously
+    as x, y, x, y, ..., such that the kernels below can be used.
+    That is the case for a std::vector (such as model::linestring and
+    model::ring) or a range iterated by pointer, of model::point or
+    model::d2::point_xy with double coordinates.
+*/
+template
+<
+    typename Range,
+    typename Point = typename geometry::point_type<Range>::type
+>
+struct is_contiguous_xy
+    : std::integral_constant
+        <
+            bool,
+            is_xy_array<Point>::value
+            && sizeof(Point) == 2 * sizeof(double)
+            && (std::is_pointer<typename boost::range_iterator<Range const>::type>::value
+                || decltype(is_std_vector<Point>(std::declval<Range const*>()))::value)
+        >
+{};
+
+template <typename Range>
+inline double const* coordinates(Range const& range)
+{
+    return reinterpret_cast<double const*>(&*boost::begin(range));
+}
+
+
+// Returns the sum of (x1 + x2) * (y1 - y2) over the segments, which is
+// twice the area of a closed clockwise ring
+inline double area_sum(double const* xy, std::size_t count)
+{
+    std::size_t i = 0;
+    double sum = 0;
+#ifdef BOOST_GEOMETRY_RANGE_KERNELS_SSE2
+    // Each vector contains one point, the first lane of the sums collects
+    // (x1 + x2) * (y1 - y2), the second lane is ignored
+    __m128d sum0 = _mm_setzero_pd();
+    __m128d sum1 = _mm_setzero_pd();
+    __m128d p0 = _mm_loadu_pd(xy);
+    for (; i + 2 < count; i += 2)
+    {
+        __m128d const p1 = _mm_loadu_pd(xy + 2 * i + 2);
+        __m128d const p2 = _mm_loadu_pd(xy + 2 * i + 4);
+        __m128d const d01 = _mm_sub_pd(p0, p1);
+        __m128d const d12 = _mm_sub_pd(p1, p2);
+        sum0 = _mm_add_pd(sum0, _mm_mul_pd(_mm_add_pd(p0, p1), _mm_shuffle_pd(d01, d01, 1)));
+        sum1 = _mm_add_pd(sum1, _mm_mul_pd(_mm_add_pd(p1, p2), _mm_shuffle_pd(d12, d12, 1)));
+        p0 = p2;
+    }
+    sum = _mm_cvtsd_f64(sum0) + _mm_cvtsd_f64(sum1);
+#else
+    double sums[4] = { 0, 0, 0, 0 };
+    for (; i + 4 < count; i += 4)
+    {
+        for (std::size_t k = 0; k < 4; k++)
+        {
+            double const* p = xy + 2 * (i + k);
+            sums[k] += (p[0] + p[2]) * (p[1] - p[3]);
+        }
+    }
+    sum = (sums[0] + sums[1]) + (sums[2] + sums[3]);
+#endif
+    for (; i + 1 < count; i++)
+    {
+        double const* p = xy + 2 * i;
+        sum += (p[0] + p[2]) * (p[1] - p[3]);
+    }
+    return sum;
+}
+
+// Returns the sum of the lengths of the segments
+inline double length_sum(double const* xy, std::size_t count)
+{
+    std::size_t i = 0;
+    double sum = 0;
+#ifdef BOOST_GEOMETRY_RANGE_KERNELS_SSE2
+    // Two segments are handled at once, the squared lengths are
+    // transposed such that both square roots are calculated together
+    __m128d sums = _mm_setzero_pd();
+    for (; i + 2 < count; i += 2)
+    {
+        __m128d const p0 = _mm_loadu_pd(xy + 2 * i);
+        __m128d const p1 = _mm_loadu_pd(xy + 2 * i + 2);
+        __m128d const p2 = _mm_loadu_pd(xy + 2 * i + 4);
+        __m128d d01 = _mm_sub_pd(p1, p0);
+        __m128d d12 = _mm_sub_pd(p2, p1);
+        d01 = _mm_mul_pd(d01, d01);
+        d12 = _mm_mul_pd(d12, d12);
+        __m128d const squared = _mm_add_pd(_mm_unpacklo_pd(d01, d12),
+                                           _mm_unpackhi_pd(d01, d12));
+        sums = _mm_add_pd(sums, _mm_sqrt_pd(squared));
+    }
+    sum = _mm_cvtsd_f64(sums) + _mm_cvtsd_f64(_mm_unpackhi_pd(sums, sums));
+#else
+    double sums[4] = { 0, 0, 0, 0 };
+    for (; i + 4 < count; i += 4)
+    {
+        for (std::size_t k = 0; k < 4; k++)
+        {
+            double const* p = xy + 2 * (i + k);
+            double const dx = p[2] - p[0];
+            double const dy = p[3] - p[1];
+            sums[k] += std::sqrt(dx * dx + dy * dy);
+        }
+    }
+    sum = (sums[0] + sums[1]) + (sums[2] + sums[3]);
+#endif
+    for (; i + 1 < count; i++)
+    {
+        double const* p = xy + 2 * i;
+        double const dx = p[2] - p[0];
+        double const dy = p[3] - p[1];
+        sum += std::sqrt(dx * dx + dy * dy);
+    }
+    return sum;
+}
+
+// Assigns min x, min y, max x, max y of at least one point
+inline void minmax(double const* xy, std::size_t count, double* result)
+{
+    std::size_t i = 1;
+#ifdef BOOST_GEOMETRY_RANGE_KERNELS_SSE2
+    // Each vector contains one point, so min and max are those of x and y.
+    // The point is the first operand, such that NaN coordinates are skipped
+    // as by the comparisons in expand
+    __m128d min0 = _mm_loadu_pd(xy);
+    __m128d max0 = min0;
+    __m128d min1 = min0;
+    __m128d max1 = min0;
+    for (; i + 1 < count; i += 2)
+    {
+        __m128d const p0 = _mm_loadu_pd(xy + 2 * i);
+        __m128d const p1 = _mm_loadu_pd(xy + 2 * i + 2);
+        min0 = _mm_min_pd(p0, min0);
+        max0 = _mm_max_pd(p0, max0);
+        min1 = _mm_min_pd(p1, min1);
+        max1 = _mm_max_pd(p1, max1);
+    }
+    if (i < count)
+    {
+        __m128d const p0 = _mm_loadu_pd(xy + 2 * i);
+        min0 = _mm_min_pd(p0, min0);
+        max0 = _mm_max_pd(p0, max0);
+    }
+    _mm_storeu_pd(result, _mm_min_pd(min0, min1));
+    _mm_storeu_pd(result + 2, _mm_max_pd(max0, max1));
+#else
+    result[0] = result[2] = xy[0];
+    result[1] = result[3] = xy[1];
+    for (; i < count; i++)
+    {
+        double const x = xy[2 * i];
+        double const y = xy[2 * i + 1];
+        result[0] = x < result[0] ? x : result[0];
+        result[1] = y < result[1] ? y : result[1];
+        result[2] = x > result[2] ? x : result[2];
+        result[3] = y > result[3] ? y : result[3];
+    }
+#endif
+}
+
+}} // namespace detail::range_kernels
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_RANGE_KERNELS_HPP
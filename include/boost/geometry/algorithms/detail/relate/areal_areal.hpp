@@ -25,6 +25,7 @@
 #include <boost/geometry/algorithms/detail/single_geometry.hpp>
 
 #include <boost/geometry/algorithms/detail/relate/point_geometry.hpp>
+#include <boost/geometry/algorithms/detail/relate/point_in_areal.hpp>
 #include <boost/geometry/algorithms/detail/relate/turns.hpp>
 #include <boost/geometry/algorithms/detail/relate/boundary_checker.hpp>
 #include <boost/geometry/algorithms/detail/relate/follow_helpers.hpp>
@@ -37,9 +38,9 @@ namespace boost { namespace geometry
 #ifndef DOXYGEN_NO_DETAIL
 namespace detail { namespace relate {
 
-// WARNING!
-// TODO: In the worst case calling this Pred in a loop for MultiPolygon/MultiPolygon may take O(NM)
-// Use the rtree in this case!
+// The other MultiPolygon is checked with an rtree of the envelopes of its
+// polygons, calling this Pred in a loop for MultiPolygon/MultiPolygon would
+// take O(NM) otherwise
 
 // may be used to set EI and EB for an Areal geometry for which no turns were generated
 template
@@ -56,8 +57,7 @@ public:
                      Result & res,
                      PointInArealStrategy const& point_in_areal_strategy)
         : m_result(res)
-        , m_point_in_areal_strategy(point_in_areal_strategy)
-        , m_other_areal(other_areal)
+        , m_point_in_other_areal(other_areal, point_in_areal_strategy)
         , m_flags(0)
     {
         // check which relations must be analysed
@@ -79,8 +79,6 @@ public:
     template <typename Areal>
     bool operator()(Areal const& areal)
     {
-        using detail::within::point_in_geometry;
-
         // if those flags are set nothing will change
         if ( m_flags == 3 )
         {
@@ -98,11 +96,7 @@ public:
         }
 
         // check if the areal is inside the other_areal
-        // TODO: This is O(N)
-        // Run in a loop O(NM) - optimize!
-        int const pig = point_in_geometry(pt,
-                                          m_other_areal,
-                                          m_point_in_areal_strategy);
+        int const pig = m_point_in_other_areal.apply(pt);
         //BOOST_GEOMETRY_ASSERT( pig != 0 );
 
         // inside
@@ -132,11 +126,7 @@ public:
                     continue; // ignore
                 }
 
-                // TODO: O(N)
-                // Optimize!
-                int const hpig = point_in_geometry(range::front(range_ref),
-                                                   m_other_areal,
-                                                   m_point_in_areal_strategy);
+                int const hpig = m_point_in_other_areal.apply(range::front(range_ref));
 
                 // hole outside
                 if ( hpig < 0 )
@@ -170,11 +160,7 @@ public:
                     continue; // ignore
                 }
 
-                // TODO: O(N)
-                // Optimize!
-                int const hpig = point_in_geometry(range::front(range_ref),
-                                                   m_other_areal,
-                                                   m_point_in_areal_strategy);
+                int const hpig = m_point_in_other_areal.apply(range::front(range_ref));
 
                 // hole inside
                 if ( hpig > 0 )
@@ -193,8 +179,7 @@ public:
 
 private:
     Result & m_result;
-    PointInArealStrategy const& m_point_in_areal_strategy;
-    OtherAreal const& m_other_areal;
+    point_in_areal<OtherAreal, PointInArealStrategy> m_point_in_other_areal;
     int m_flags;
 };
 
@@ -614,7 +599,7 @@ struct areal_areal
             , other_geometry(other_geom)
             , interrupt(result.interrupt) // just in case, could be false as well
             , m_result(result)
-            , m_point_in_areal_strategy(point_in_areal_strategy)
+            , m_point_in_other_geometry(other_geom, point_in_areal_strategy)
             , m_flags(0)
         {
             // check which relations must be analysed
@@ -658,12 +643,9 @@ struct areal_areal
             // if the range is an interior ring we may use other IPs generated for this single geometry
             // to know which other single geometries should be checked
 
-            // TODO: optimize! e.g. use spatial index
-            // O(N) - running it in a loop gives O(NM)
-            using detail::within::point_in_geometry;
-            int const pig = point_in_geometry(range::front(sub_range),
-                                              other_geometry,
-                                              m_point_in_areal_strategy);
+            // The other MultiPolygon is checked with an rtree, running it in
+            // a loop would give O(NM) otherwise
+            int const pig = m_point_in_other_geometry.apply(range::front(sub_range));
 
             //BOOST_GEOMETRY_ASSERT(pig != 0);
             if ( pig > 0 )
@@ -752,7 +734,7 @@ struct areal_areal
 
     private:
         Result & m_result;
-        PointInArealStrategy const& m_point_in_areal_strategy;
+        point_in_areal<OtherGeometry, PointInArealStrategy> m_point_in_other_geometry;
         int m_flags;
     };
 
@@ -30,6 +30,7 @@
 #include <boost/geometry/algorithms/detail/single_geometry.hpp>
 
 #include <boost/geometry/algorithms/detail/relate/point_geometry.hpp>
+#include <boost/geometry/algorithms/detail/relate/point_in_areal.hpp>
 #include <boost/geometry/algorithms/detail/relate/turns.hpp>
 #include <boost/geometry/algorithms/detail/relate/boundary_checker.hpp>
 #include <boost/geometry/algorithms/detail/relate/follow_helpers.hpp>
@@ -44,9 +45,9 @@ namespace boost { namespace geometry
 #ifndef DOXYGEN_NO_DETAIL
 namespace detail { namespace relate {
 
-// WARNING!
-// TODO: In the worst case calling this Pred in a loop for MultiLinestring/MultiPolygon may take O(NM)
-// Use the rtree in this case!
+// The MultiPolygon is checked with an rtree of the envelopes of its polygons,
+// calling this Pred in a loop for MultiLinestring/MultiPolygon would take
+// O(NM) otherwise
 
 // may be used to set IE and BE for a Linear geometry for which no turns were generated
 template
@@ -64,9 +65,8 @@ public:
                                 Result & res,
                                 Strategy const& strategy,
                                 BoundaryChecker const& boundary_checker)
-        : m_geometry2(geometry2)
+        : m_point_in_geometry2(geometry2, strategy)
         , m_result(res)
-        , m_strategy(strategy)
         , m_boundary_checker(boundary_checker)
         , m_interrupt_flags(0)
     {
@@ -110,9 +110,7 @@ public:
             return false;
         }
 
-        int const pig = detail::within::point_in_geometry(range::front(linestring),
-                                                          m_geometry2,
-                                                          m_strategy);
+        int const pig = m_point_in_geometry2.apply(range::front(linestring));
         //BOOST_GEOMETRY_ASSERT_MSG(pig != 0, "There should be no IPs");
 
         if ( pig > 0 )
@@ -148,9 +146,8 @@ public:
     }
 
 private:
-    Geometry2 const& m_geometry2;
+    point_in_areal<Geometry2, Strategy> m_point_in_geometry2;
     Result & m_result;
-    Strategy const& m_strategy;
     BoundaryChecker const& m_boundary_checker;
     unsigned m_interrupt_flags;
 };
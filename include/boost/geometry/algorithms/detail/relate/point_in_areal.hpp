@@ -0,0 +1,158 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_RELATE_POINT_IN_AREAL_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_RELATE_POINT_IN_AREAL_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <boost/range/size.hpp>
+
+#include <boost/geometry/algorithms/detail/expand_by_epsilon.hpp>
+#include <boost/geometry/algorithms/detail/within/point_in_geometry.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/geometries/box.hpp>
+
+#include <boost/geometry/index/rtree.hpp>
+
+#include <boost/geometry/util/range.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace relate
+{
+
+// Checks many points against one areal geometry, as point_in_geometry.
+// For a single polygon or ring the geometry is checked directly.
+template
+<
+    typename Areal,
+    typename Strategy,
+    typename Tag = typename tag<Areal>::type
+>
+class point_in_areal
+{
+public:
+    inline point_in_areal(Areal const& areal, Strategy const& strategy)
+        : m_areal(areal)
+        , m_strategy(strategy)
+    {}
+
+    template <typename Point>
+    inline int apply(Point const& point)
+    {
+        return detail::within::point_in_geometry(point, m_areal, m_strategy);
+    }
+
+private:
+    Areal const& m_areal;
+    Strategy const& m_strategy;
+};
+
+// For a multi polygon the envelopes of the polygons are indexed by an rtree,
+// built at the first call, so only the polygons whose envelopes contain the
+// point are checked. Otherwise checking the parts of one multi polygon for
+// which no turns were generated against another one is O(NM).
+template <typename MultiPolygon, typename Strategy>
+class point_in_areal<MultiPolygon, Strategy, multi_polygon_tag>
+{
+    typedef typename geometry::point_type<MultiPolygon>::type point_type;
+    typedef model::box<point_type> box_type;
+    typedef std::pair<box_type, std::size_t> box_pair_type;
+    typedef index::parameters
+        <
+            index::rstar<4>, Strategy
+        > index_parameters_type;
+    typedef index::rtree<box_pair_type, index_parameters_type> rtree_type;
+
+    // Up to this number of polygons they are checked in a loop
+    static const std::size_t max_unindexed_count = 16;
+
+    struct less_index
+    {
+        inline bool operator()(box_pair_type const& left,
+                               box_pair_type const& right) const
+        {
+            return left.second < right.second;
+        }
+    };
+
+public:
+    inline point_in_areal(MultiPolygon const& multi_polygon, Strategy const& strategy)
+        : m_multi_polygon(multi_polygon)
+        , m_strategy(strategy)
+    {}
+
+    template <typename Point>
+    inline int apply(Point const& point)
+    {
+        std::size_t const count = boost::size(m_multi_polygon);
+        if (count <= max_unindexed_count)
+        {
+            return detail::within::point_in_geometry(point, m_multi_polygon, m_strategy);
+        }
+
+        if (! m_rtree)
+        {
+            std::vector<box_pair_type> boxes(count);
+            for (std::size_t i = 0 ; i < count ; ++i)
+            {
+                geometry::envelope(range::at(m_multi_polygon, i), boxes[i].first, m_strategy);
+                geometry::detail::expand_by_epsilon(boxes[i].first);
+                boxes[i].second = i;
+            }
+
+            m_rtree.reset(new rtree_type(boxes.begin(), boxes.end(),
+                                         index_parameters_type(index::rstar<4>(), m_strategy)));
+        }
+
+        m_found.clear();
+        m_rtree->query(index::intersects(point), std::back_inserter(m_found));
+
+        // As point_in_geometry, the result of the first polygon containing
+        // the point or having it on its boundary
+        std::sort(m_found.begin(), m_found.end(), less_index());
+        for (auto it = m_found.begin() ; it != m_found.end() ; ++it)
+        {
+            int const pip = detail::within::point_in_geometry(point,
+                                range::at(m_multi_polygon, it->second), m_strategy);
+            if (pip >= 0)
+            {
+                return pip;
+            }
+        }
+
+        return -1;
+    }
+
+private:
+    MultiPolygon const& m_multi_polygon;
+    Strategy const& m_strategy;
+    std::unique_ptr<rtree_type> m_rtree;
+    std::vector<box_pair_type> m_found;
+};
+
+}} // namespace detail::relate
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_RELATE_POINT_IN_AREAL_HPP
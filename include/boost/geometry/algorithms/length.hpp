@@ -20,18 +20,22 @@
 #ifndef BOOST_GEOMETRY_ALGORITHMS_LENGTH_HPP
 #define BOOST_GEOMETRY_ALGORITHMS_LENGTH_HPP
 
+#include <cmath>
 #include <iterator>
+#include <type_traits>
 
 #include <boost/core/ignore_unused.hpp>
 #include <boost/range/begin.hpp>
 #include <boost/range/end.hpp>
 #include <boost/range/iterator.hpp>
+#include <boost/range/size.hpp>
 #include <boost/range/value_type.hpp>
 
 #include <boost/geometry/algorithms/assign.hpp>
 #include <boost/geometry/algorithms/detail/calculate_null.hpp>
 #include <boost/geometry/algorithms/detail/dummy_geometries.hpp>
 #include <boost/geometry/algorithms/detail/multi_sum.hpp>
+#include <boost/geometry/algorithms/detail/range_kernels.hpp>
 // #include <boost/geometry/algorithms/detail/throw_on_empty_input.hpp>
 #include <boost/geometry/algorithms/detail/visit.hpp>
 
@@ -88,9 +92,51 @@ struct range_length
 {
     typedef typename default_length_result<Range>::type return_type;
 
+    // Pythagoras on a range with coordinates stored as x, y, x, y, ...
+    // is calculated by a vectorized kernel
+    template <typename Strategy>
+    using use_range_kernel = std::integral_constant
+        <
+            bool,
+            (std::is_same<Strategy, strategy::distance::pythagoras<> >::value
+             || std::is_same<Strategy, strategy::distance::pythagoras<double> >::value)
+            && std::is_same<return_type, double>::value
+            && detail::range_kernels::is_contiguous_xy<Range>::value
+        >;
+
     template <typename Strategies>
     static inline return_type
     apply(Range const& range, Strategies const& strategies)
+    {
+        using strategy_type = decltype(strategies.distance(dummy_point(), dummy_point()));
+        return apply(range, strategies, use_range_kernel<strategy_type>());
+    }
+
+    template <typename Strategies>
+    static inline return_type
+    apply(Range const& range, Strategies const& , std::true_type)
+    {
+        std::size_t const count = boost::size(range);
+        if (count == 0)
+        {
+            return 0;
+        }
+
+        double const* xy = detail::range_kernels::coordinates(range);
+        double sum = detail::range_kernels::length_sum(xy, count);
+        if (Closure == open)
+        {
+            double const* last = xy + 2 * (count - 1);
+            double const dx = xy[0] - last[0];
+            double const dy = xy[1] - last[1];
+            sum += std::sqrt(dx * dx + dy * dy);
+        }
+        return sum;
+    }
+
+    template <typename Strategies>
+    static inline return_type
+    apply(Range const& range, Strategies const& strategies, std::false_type)
     {
         return_type sum = return_type();
         detail::closed_view<Range const> const view(range);
@@ -23,9 +23,9 @@
 #include <iostream>
 #endif
 #include <set>
+#include <utility>
 #include <vector>
 
-#include <boost/core/addressof.hpp>
 #include <boost/core/ignore_unused.hpp>
 #include <boost/range/begin.hpp>
 #include <boost/range/end.hpp>
@@ -44,9 +44,11 @@
 
 #include <boost/geometry/core/cs.hpp>
 #include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
 #include <boost/geometry/core/exterior_ring.hpp>
 #include <boost/geometry/core/interior_rings.hpp>
 #include <boost/geometry/core/mutable_range.hpp>
+#include <boost/geometry/core/point_type.hpp>
 #include <boost/geometry/core/tags.hpp>
 #include <boost/geometry/core/visit.hpp>
 
@@ -60,7 +62,9 @@
 #include <boost/geometry/strategies/simplify/cartesian.hpp>
 #include <boost/geometry/strategies/simplify/geographic.hpp>
 #include <boost/geometry/strategies/simplify/spherical.hpp>
+#include <boost/geometry/strategies/simplify/visvalingam_whyatt.hpp>
 
+#include <boost/geometry/util/select_most_precise.hpp>
 #include <boost/geometry/util/type_traits_std.hpp>
 
 #ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
@@ -75,29 +79,23 @@ namespace detail { namespace simplify
 {
 
 /*!
-\brief Small wrapper around a point, with an extra member "included"
-\details
-    It has a const-reference to the original point (so no copy here)
-\tparam the enclosed point type
+\brief Workspace for the douglas_peucker policy
+\details Contains the flags of the included points and the explicit stack
+    of subranges still to be considered. It can be reused for many ranges,
+    such that memory is only allocated for the largest range.
 */
-template <typename Point>
-struct douglas_peucker_point
+struct douglas_peucker_workspace
 {
-    typedef Point point_type;
-
-    Point const* p;
-    bool included;
-
-    inline douglas_peucker_point(Point const& ap)
-        : p(boost::addressof(ap))
-        , included(false)
-    {}
+    std::vector<bool> included;
+    std::vector<std::pair<std::size_t, std::size_t> > stack;
 };
 
 /*!
 \brief Implements the simplify algorithm.
 \details The douglas_peucker policy simplifies a linestring, ring or
     vector of points using the well-known Douglas-Peucker algorithm.
+    It is implemented iteratively, using an explicit stack instead of
+    recursion, and one flag per point.
 \note This strategy uses itself a point-segment potentially comparable
     distance strategy
 \author Barend and Maarten, 1995/1996
@@ -111,124 +109,114 @@ For the algorithm, see for example:
 */
 class douglas_peucker
 {
-    template <typename Iterator, typename Distance, typename PSDistanceStrategy>
-    static inline void consider(Iterator begin,
-                                Iterator end,
-                                Distance const& max_dist,
-                                int& n,
-                                PSDistanceStrategy const& ps_distance_strategy)
+public:
+    template <typename Point>
+    using workspace_type = douglas_peucker_workspace;
+
+private:
+    template
+    <
+        typename Range, typename OutputIterator, typename Distance,
+        typename PSDistanceStrategy
+    >
+    static inline OutputIterator apply_(Range const& range,
+                                        OutputIterator out,
+                                        Distance const& max_dist,
+                                        PSDistanceStrategy const& ps_distance_strategy,
+                                        douglas_peucker_workspace& workspace)
     {
-        typedef typename std::iterator_traits<Iterator>::value_type::point_type point_type;
+#ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
+            std::cout << "max distance: " << max_dist
+                      << std::endl << std::endl;
+#endif
+
+        typedef typename boost::range_value<Range>::type point_type;
         typedef decltype(ps_distance_strategy.apply(std::declval<point_type>(),
                             std::declval<point_type>(), std::declval<point_type>())) distance_type;
 
-        std::size_t size = end - begin;
-
-        // size must be at least 3
-        // because we want to consider a candidate point in between
-        if (size <= 2)
+        std::size_t const size = boost::size(range);
+        if (size == 0)
         {
-#ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
-            if (begin != end)
-            {
-                std::cout << "ignore between " << dsv(*(begin->p))
-                    << " and " << dsv(*((end - 1)->p))
-                    << " size=" << size << std::endl;
-            }
-            std::cout << "return because size=" << size << std::endl;
-#endif
-            return;
+            return out;
         }
 
-        Iterator last = end - 1;
-
-#ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
-        std::cout << "find between " << dsv(*(begin->p))
-            << " and " << dsv(*(last->p))
-            << " size=" << size << std::endl;
-#endif
-
+        auto const begin = boost::begin(range);
 
-        // Find most far point, compare to the current segment
-        //geometry::segment<Point const> s(begin->p, last->p);
-        distance_type md(-1.0); // any value < 0
-        Iterator candidate = end;
-        for (Iterator it = begin + 1; it != last; ++it)
+        // Include first and last point of line,
+        // they are always part of the line
+        std::vector<bool>& included = workspace.included;
+        included.assign(size, false);
+        included.front() = true;
+        included.back() = true;
+
+        // Consider the subranges, starting with the whole range, including
+        // points if they are further away than the specified distance
+        auto& stack = workspace.stack;
+        stack.clear();
+        stack.emplace_back(0, size - 1);
+
+        while (! stack.empty())
         {
-            distance_type dist = ps_distance_strategy.apply(*(it->p), *(begin->p), *(last->p));
-
-#ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
-            std::cout << "consider " << dsv(*(it->p))
-                << " at " << double(dist)
-                << ((dist > max_dist) ? " maybe" : " no")
-                << std::endl;
+            std::size_t const first = stack.back().first;
+            std::size_t const last = stack.back().second;
+            stack.pop_back();
 
-#endif
-            if (md < dist)
+            // there must be at least one candidate point in between
+            if (last - first < 2)
             {
-                md = dist;
-                candidate = it;
+                continue;
             }
-        }
 
-        // If a point is found, set the include flag
-        // and handle segments in between recursively
-        if (max_dist < md && candidate != end)
-        {
 #ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
-            std::cout << "use " << dsv(candidate->p) << std::endl;
+            std::cout << "find between " << dsv(*(begin + first))
+                << " and " << dsv(*(begin + last))
+                << " size=" << last - first + 1 << std::endl;
 #endif
 
-            candidate->included = true;
-            n++;
-
-            consider(begin, candidate + 1, max_dist, n, ps_distance_strategy);
-            consider(candidate, end, max_dist, n, ps_distance_strategy);
-        }
-    }
+            // Find most far point, compare to the current segment
+            point_type const& p1 = *(begin + first);
+            point_type const& p2 = *(begin + last);
+            distance_type md(-1.0); // any value < 0
+            std::size_t candidate = last;
+            auto it = begin + first + 1;
+            for (std::size_t i = first + 1; i < last; ++i, ++it)
+            {
+                distance_type const dist = ps_distance_strategy.apply(*it, p1, p2);
 
-    template
-    <
-        typename Range, typename OutputIterator, typename Distance,
-        typename PSDistanceStrategy
-    >
-    static inline OutputIterator apply_(Range const& range,
-                                        OutputIterator out,
-                                        Distance const& max_distance,
-                                        PSDistanceStrategy const& ps_distance_strategy)
-    {
 #ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
-            std::cout << "max distance: " << max_distance
-                      << std::endl << std::endl;
+                std::cout << "consider " << dsv(*it)
+                    << " at " << double(dist)
+                    << ((dist > max_dist) ? " maybe" : " no")
+                    << std::endl;
 #endif
+                if (md < dist)
+                {
+                    md = dist;
+                    candidate = i;
+                }
+            }
 
-        typedef typename boost::range_value<Range>::type point_type;
-        typedef douglas_peucker_point<point_type> dp_point_type;
-
-        // Copy coordinates, a vector of references to all points
-        std::vector<dp_point_type> ref_candidates(boost::begin(range),
-                                                  boost::end(range));
-
-        // Include first and last point of line,
-        // they are always part of the line
-        int n = 2;
-        ref_candidates.front().included = true;
-        ref_candidates.back().included = true;
+            // If a point is found, set the include flag
+            // and handle subranges in between
+            if (max_dist < md && candidate != last)
+            {
+#ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
+                std::cout << "use " << dsv(*(begin + candidate)) << std::endl;
+#endif
 
-        // Get points, recursively, including them if they are further away
-        // than the specified distance
-        consider(boost::begin(ref_candidates), boost::end(ref_candidates), max_distance, n,
-                 ps_distance_strategy);
+                included[candidate] = true;
+                stack.emplace_back(candidate, last);
+                stack.emplace_back(first, candidate);
+            }
+        }
 
         // Copy included elements to the output
-        for (auto it = boost::begin(ref_candidates); it != boost::end(ref_candidates); ++it)
+        auto it = begin;
+        for (std::size_t i = 0; i < size; ++i, ++it)
         {
-            if (it->included)
+            if (included[i])
             {
-                // copy-coordinates does not work because OutputIterator
-                // does not model Point (??)
-                //geometry::convert(*(it->p), *out);
-                *out = *(it->p);
+                *out = *it;
                 ++out;
             }
         }
@@ -240,7 +228,8 @@ public:
     static inline OutputIterator apply(Range const& range,
                                        OutputIterator out,
                                        Distance const& max_distance,
-                                       Strategies const& strategies)
+                                       Strategies const& strategies,
+                                       douglas_peucker_workspace& workspace)
     {
         typedef typename boost::range_value<Range>::type point_type;
         typedef decltype(strategies.distance(detail::dummy_point(), detail::dummy_segment())) distance_strategy_type;
@@ -260,8 +249,250 @@ public:
                           <
                               comparable_distance_strategy_type, point_type, point_type
                           >::apply(cstrategy, max_distance),
-                      cstrategy);
+                      cstrategy, workspace);
+    }
+
+    template <typename Range, typename OutputIterator, typename Distance, typename Strategies>
+    static inline OutputIterator apply(Range const& range,
+                                       OutputIterator out,
+                                       Distance const& max_distance,
+                                       Strategies const& strategies)
+    {
+        douglas_peucker_workspace workspace;
+        return apply(range, out, max_distance, strategies, workspace);
+    }
+};
+
+
+/*!
+\brief Workspace for the visvalingam_whyatt policy
+\details Contains the links between the remaining points, their effective
+    areas and the heap. It can be reused for many ranges.
+*/
+template <typename Area>
+struct visvalingam_whyatt_workspace
+{
+    std::vector<std::size_t> previous;
+    std::vector<std::size_t> next;
+    std::vector<Area> areas;
+    std::vector<std::pair<Area, std::size_t> > heap;
+};
+
+/*!
+\brief Implements the simplify algorithm of Visvalingam-Whyatt.
+\details The visvalingam_whyatt policy repeatedly removes the point with the
+    smallest effective area: the area of the triangle formed with its
+    remaining neighbours. Points are removed as long as their effective
+    area is not larger than the square of the specified distance.
+    The effective area of a point is never smaller than that of a point
+    removed before, such that removal order and effective area correspond.
+    The points are kept in a min-heap, outdated entries are skipped.
+\note Only implemented for cartesian coordinate systems.
+*/
+
+/*
+For the algorithm, see for example:
+ - https://en.wikipedia.org/wiki/Visvalingam-Whyatt_algorithm
+ - Visvalingam, M. and Whyatt, J.D., Line generalisation by repeated
+   elimination of points, The Cartographic Journal 30 (1), 1993
+*/
+class visvalingam_whyatt
+{
+    template <typename Area, typename Point>
+    static inline Area triangle_area(Point const& p0, Point const& p1, Point const& p2)
+    {
+        Area const dx1 = Area(get<0>(p1)) - Area(get<0>(p0));
+        Area const dy1 = Area(get<1>(p1)) - Area(get<1>(p0));
+        Area const dx2 = Area(get<0>(p2)) - Area(get<0>(p0));
+        Area const dy2 = Area(get<1>(p2)) - Area(get<1>(p0));
+        Area const twice = dx1 * dy2 - dy1 * dx2;
+        return (twice < 0 ? -twice : twice) / Area(2);
+    }
+
+public:
+
+    template <typename Point>
+    using area_type = typename select_most_precise
+        <
+            typename coordinate_type<Point>::type,
+            double
+        >::type;
+
+    template <typename Point>
+    using workspace_type = visvalingam_whyatt_workspace<area_type<Point> >;
+
+    // Calculates the effective area of all points, in removal order.
+    // Calls visitor(index, area) for each removed point, which has to return
+    // false to stop. The remaining points are linked in workspace.next.
+    template <typename Range, typename Area, typename Visitor>
+    static inline void rank(Range const& range,
+                            visvalingam_whyatt_workspace<Area>& workspace,
+                            Visitor&& visitor)
+    {
+        std::size_t const size = boost::size(range);
+        auto const begin = boost::begin(range);
+        auto const point = [&begin](std::size_t i) -> decltype(*begin)
+        {
+            return *(begin + i);
+        };
+
+        auto& previous = workspace.previous;
+        auto& next = workspace.next;
+        auto& areas = workspace.areas;
+        auto& heap = workspace.heap;
+
+        previous.resize(size);
+        next.resize(size);
+        areas.assign(size, Area(0));
+        heap.clear();
+
+        using entry_type = std::pair<Area, std::size_t>;
+        auto const greater = [](entry_type const& a, entry_type const& b)
+        {
+            return a.first > b.first
+                || (a.first == b.first && a.second > b.second);
+        };
+
+        for (std::size_t i = 0; i < size; i++)
+        {
+            previous[i] = i - 1;
+            next[i] = i + 1;
+            if (i > 0 && i + 1 < size)
+            {
+                areas[i] = triangle_area<Area>(point(i - 1), point(i), point(i + 1));
+                heap.emplace_back(areas[i], i);
+            }
+        }
+        std::make_heap(heap.begin(), heap.end(), greater);
+
+        // A removed point gets size as its next point
+        while (! heap.empty())
+        {
+            std::pop_heap(heap.begin(), heap.end(), greater);
+            entry_type const entry = heap.back();
+            heap.pop_back();
+
+            std::size_t const i = entry.second;
+            if (next[i] == size || areas[i] != entry.first)
+            {
+                // Removed or outdated
+                continue;
+            }
+
+            if (! visitor(i, entry.first))
+            {
+                return;
+            }
+
+            std::size_t const p = previous[i];
+            std::size_t const n = next[i];
+            next[p] = n;
+            previous[n] = p;
+            next[i] = size;
+
+            // Update the effective areas of the neighbours
+            std::size_t const neighbours[2] = { p, n };
+            for (std::size_t const j : neighbours)
+            {
+                if (j == 0 || next[j] == size)
+                {
+                    // First or last point, they are never removed
+                    continue;
+                }
+                Area area = triangle_area<Area>(point(previous[j]), point(j), point(next[j]));
+                if (area < entry.first)
+                {
+                    area = entry.first;
+                }
+                if (area != areas[j])
+                {
+                    areas[j] = area;
+                    heap.emplace_back(area, j);
+                    std::push_heap(heap.begin(), heap.end(), greater);
+                }
+            }
+        }
+    }
+
+    template
+    <
+        typename Range, typename OutputIterator, typename Distance,
+        typename Strategies, typename Area
+    >
+    static inline OutputIterator apply(Range const& range,
+                                       OutputIterator out,
+                                       Distance const& max_distance,
+                                       Strategies const& ,
+                                       visvalingam_whyatt_workspace<Area>& workspace)
+    {
+        std::size_t const size = boost::size(range);
+        if (size == 0)
+        {
+            return out;
+        }
+
+        Area const max_area = Area(max_distance) * Area(max_distance);
+        rank(range, workspace, [&max_area](std::size_t, Area const& area)
+        {
+            return ! (max_area < area);
+        });
+
+        // Copy the remaining points to the output, first and last point
+        // are always remaining
+        auto const begin = boost::begin(range);
+        for (std::size_t i = 0; i < size; i = workspace.next[i])
+        {
+            *out = *(begin + i);
+            ++out;
+        }
+        return out;
     }
+
+    template <typename Range, typename OutputIterator, typename Distance, typename Strategies>
+    static inline OutputIterator apply(Range const& range,
+                                       OutputIterator out,
+                                       Distance const& max_distance,
+                                       Strategies const& strategies)
+    {
+        using point_type = typename boost::range_value<Range>::type;
+        visvalingam_whyatt_workspace<area_type<point_type> > workspace;
+        return apply(range, out, max_distance, strategies, workspace);
+    }
+};
+
+
+// The simplify policy is Douglas-Peucker, unless selected by the strategy
+template <typename Strategies>
+struct policy_type
+{
+    using type = douglas_peucker;
+};
+
+template <typename Strategies>
+struct policy_type<strategies::simplify::visvalingam_whyatt<Strategies> >
+{
+    using type = visvalingam_whyatt;
+};
+
+
+// Calls the simplify policy with one workspace for all ranges of one
+// geometry (the rings of a polygon, the linestrings or polygons of a
+// multi-geometry), such that memory is only allocated for the largest range
+template <typename Policy, typename Point>
+class workspace_policy
+{
+public:
+    template <typename Range, typename OutputIterator, typename Distance, typename Strategies>
+    inline OutputIterator apply(Range const& range,
+                                OutputIterator out,
+                                Distance const& max_distance,
+                                Strategies const& strategies) const
+    {
+        return Policy::apply(range, out, max_distance, strategies, m_workspace);
+    }
+
+private:
+    mutable typename Policy::template workspace_type<Point> m_workspace;
 };
 
 
@@ -785,7 +1016,11 @@ struct simplify
             <
                 GeometryIn, GeometryOut
             >::apply(geometry, out, max_distance,
-                     detail::simplify::douglas_peucker(),
+                     detail::simplify::workspace_policy
+                        <
+                            typename detail::simplify::policy_type<Strategies>::type,
+                            typename geometry::point_type<GeometryIn>::type
+                        >(),
                      strategies);
     }
 };
@@ -855,7 +1090,7 @@ struct simplify_insert
             <
                 Geometry
             >::apply(geometry, out, max_distance,
-                     detail::simplify::douglas_peucker(),
+                     typename detail::simplify::policy_type<Strategies>::type(),
                      strategies);
     }
 };
@@ -9,6 +9,11 @@
 #ifndef BOOST_GEOMETRY_CORE_COORDINATE_PROMOTION_HPP
 #define BOOST_GEOMETRY_CORE_COORDINATE_PROMOTION_HPP
 
+#include <climits>
+#include <type_traits>
+
+#include <boost/config.hpp>
+
 #include <boost/geometry/core/coordinate_type.hpp>
 
 // TODO: move this to a future headerfile implementing traits for these types
@@ -102,6 +107,57 @@ struct promoted_to_floating_point
         >;
 };
 
+// Promote signed integral types to a signed integral type having (at least)
+// twice the number of bits, such that the product of two differences of
+// coordinates (and the sum of two of these products) is exact, as long as
+// the coordinates are smaller than 2^(n-2) (for example 2^62 for int64).
+// The native 128 bits integer is used if it is enabled (see promote_integral),
+// otherwise Boost.Multiprecision. A 128 bits integer is promoted to the
+// 256 bits integer of Boost.Multiprecision. Other types stay as they are.
+template
+<
+    typename Type,
+    bool IsSignedIntegral = std::is_integral<Type>::value
+                            && std::is_signed<Type>::value
+>
+struct promoted_to_exact_integral
+{
+    using type = Type;
+};
+
+template <typename Type>
+struct promoted_to_exact_integral<Type, true>
+{
+#if defined(BOOST_HAS_INT128) && defined(BOOST_GEOMETRY_ENABLE_INT128)
+    using int128_type = boost::int128_type;
+#else
+    using int128_type = boost::multiprecision::int128_t;
+#endif
+
+    using type = std::conditional_t
+        <
+            (CHAR_BIT * sizeof(Type) <= 32),
+            long long,
+            std::conditional_t
+                <
+                    (CHAR_BIT * sizeof(Type) <= 64),
+                    int128_type,
+                    std::conditional_t
+                        <
+                            (CHAR_BIT * sizeof(Type) <= 128),
+                            boost::multiprecision::int256_t,
+                            Type
+                        >
+                >
+        >;
+};
+
+template <>
+struct promoted_to_exact_integral<boost::multiprecision::int128_t, false>
+{
+    using type = boost::multiprecision::int256_t;
+};
+
 }
 
 
@@ -0,0 +1,584 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_BULK_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_BULK_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/centroid.hpp>
+#include <boost/geometry/algorithms/covered_by.hpp>
+#include <boost/geometry/algorithms/detail/partition.hpp>
+#include <boost/geometry/algorithms/disjoint.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/expand.hpp>
+#include <boost/geometry/algorithms/length.hpp>
+#include <boost/geometry/algorithms/within.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/point_order.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/radian_access.hpp>
+#include <boost/geometry/formulas/area_formulas.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/strategies/default_strategy.hpp>
+#include <boost/geometry/strategy/geographic/area.hpp>
+#include <boost/geometry/util/math.hpp>
+#include <boost/geometry/util/parallel_for.hpp>
+
+#include <boost/geometry/extensions/geometries/columnar.hpp>
+#include <boost/geometry/extensions/views/flat_view.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace bulk
+{
+
+template <typename Point, bool ClockWise, bool Closed, typename Offset>
+inline flat_multi_polygon_view<Point, ClockWise, Closed, Offset>
+flat_view_of(flat_multi_polygon_view<Point, ClockWise, Closed, Offset> const& view)
+{
+    return view;
+}
+
+template <typename Point, bool ClockWise, bool Closed, typename Offset>
+inline flat_multi_polygon_view<Point, ClockWise, Closed, Offset>
+flat_view_of(columnar_multi_polygon<Point, ClockWise, Closed, Offset> const& multi)
+{
+    return multi.view();
+}
+
+template <typename Point, typename Offset>
+inline flat_multi_linestring_view<Point, Offset>
+flat_view_of(flat_multi_linestring_view<Point, Offset> const& view)
+{
+    return view;
+}
+
+template <typename Point, typename Offset>
+inline flat_multi_linestring_view<Point, Offset>
+flat_view_of(columnar_multi_linestring<Point, Offset> const& multi)
+{
+    return multi.view();
+}
+
+// Ring j of a flat multi polygon
+template <typename View>
+inline typename View::polygon_type::ring_type ring_at(View const& view, std::size_t j)
+{
+    typedef typename View::polygon_type::ring_type ring_type;
+    return ring_type(view.points() + view.ring_offsets()[j],
+                     view.points() + view.ring_offsets()[j + 1]);
+}
+
+template <typename Item>
+struct indexed
+{
+    Item item;
+    std::size_t index;
+};
+
+struct expand_indexed
+{
+    template <typename Box, typename Item>
+    inline void apply(Box& total, indexed<Item> const& item) const
+    {
+        geometry::expand(total, item.item);
+    }
+};
+
+struct overlaps_indexed
+{
+    template <typename Box, typename Item>
+    inline bool apply(Box const& box, indexed<Item> const& item) const
+    {
+        return ! geometry::disjoint(item.item, box);
+    }
+};
+
+template <typename View, typename Strategy>
+struct within_visitor
+{
+    inline within_visitor(View const& view, std::vector<std::size_t>& result,
+                          Strategy const& strategy)
+        : m_view(view)
+        , m_result(result)
+        , m_strategy(strategy)
+    {}
+
+    template <typename Point, typename Box>
+    inline bool apply(indexed<Point> const& point, indexed<Box> const& box)
+    {
+        std::size_t& found = m_result[point.index];
+        // Partition visits pairs in an arbitrary order, keep the first polygon
+        if (box.index < found
+            && geometry::covered_by(point.item, box.item)
+            && geometry::within(point.item, m_view.at(box.index), m_strategy))
+        {
+            found = box.index;
+        }
+        return true;
+    }
+
+    View const& m_view;
+    std::vector<std::size_t>& m_result;
+    Strategy const& m_strategy;
+};
+
+// The number of polygons of which the geographic areas are calculated by
+// one task
+static const std::size_t geographic_area_block_size = 256;
+
+// The geographic area of the polygons of a flat multi polygon. The segments
+// are calculated as by the strategy, but the terms depending on one vertex
+// are calculated once for both segments of the vertex, and the terms of the
+// vertices and the trapezoidal excesses of the segments are calculated in
+// separate loops over all vertices of a block of polygons, which can be
+// vectorized. The spheroid constants are these of the strategy.
+template
+<
+    typename FormulaPolicy, std::size_t SeriesOrder,
+    typename Spheroid, typename CalculationType
+>
+class geographic_area
+{
+    typedef strategy::area::geographic
+        <
+            FormulaPolicy, SeriesOrder, Spheroid, CalculationType
+        > strategy_type;
+    typedef strategy::area::detail::geographic_access access;
+
+public :
+    explicit inline geographic_area(strategy_type const& strategy)
+        : m_strategy(strategy)
+    {}
+
+    // Calculates the areas of the polygons [first, last) of the view
+    template <typename View, typename Result>
+    inline void apply(View const& view, std::size_t first, std::size_t last,
+                      Result* areas) const
+    {
+        typedef typename View::polygon_type::ring_type ring_type;
+        typedef typename geometry::point_type<ring_type>::type point_type;
+        typedef typename strategy_type::template result_type<ring_type>::type calc_t;
+        typedef typename access::template area_formulas
+            <
+                strategy_type, calc_t
+            >::type area_formulas;
+        typedef typename FormulaPolicy::template inverse
+            <
+                calc_t, true, true, true, false, false
+            > inverse_type;
+
+        static bool const clockwise = geometry::point_order<ring_type>::value == geometry::clockwise;
+        static bool const closed = geometry::closure<ring_type>::value == geometry::closed;
+
+        auto const& constants = access::constants(m_strategy);
+        auto const& model = constants.m_formula_model.get(constants.m_spheroid);
+
+        auto const* const ring_offsets = view.ring_offsets();
+        auto const* const polygon_offsets = view.polygon_offsets();
+        std::size_t const first_ring = polygon_offsets[first];
+        std::size_t const last_ring = polygon_offsets[last];
+
+        // The vertices of the rings, closed and clockwise, as visited by
+        // area(), and the first vertex of each ring
+        std::vector<point_type const*> vertices;
+        vertices.reserve(ring_offsets[last_ring] - ring_offsets[first_ring]
+                         + last_ring - first_ring);
+        std::vector<std::size_t> starts(1, 0);
+        starts.reserve(last_ring - first_ring + 1);
+        for (std::size_t j = first_ring; j < last_ring; j++)
+        {
+            point_type const* const points = view.points() + ring_offsets[j];
+            std::size_t const size = ring_offsets[j + 1] - ring_offsets[j];
+            if (size >= geometry::detail::minimum_ring_size<ring_type>::value)
+            {
+                std::size_t const count = closed ? size : size + 1;
+                for (std::size_t k = 0; k < count; k++)
+                {
+                    std::size_t const index = clockwise ? k : count - 1 - k;
+                    vertices.push_back(points + (index < size ? index : 0));
+                }
+            }
+            starts.push_back(vertices.size());
+        }
+
+        std::size_t const n = vertices.size();
+        calc_t const c2 = calc_t(2);
+        calc_t const one_minus_f = calc_t(1) - constants.m_f;
+
+        std::vector<calc_t> lon(n), lat(n), tan_half_lat(n), sin_bet(n), cos_bet(n),
+                            lon21(n), trapezoid(n);
+        for (std::size_t i = 0; i < n; i++)
+        {
+            lon[i] = get_as_radian<0>(*vertices[i]);
+            lat[i] = get_as_radian<1>(*vertices[i]);
+        }
+
+        // The terms of the vertices, each function in its own loop
+        for (std::size_t i = 0; i < n; i++)
+        {
+            tan_half_lat[i] = tan(lat[i] / c2);
+        }
+        for (std::size_t i = 0; i < n; i++)
+        {
+            // the tangent of the reduced latitude
+            sin_bet[i] = tan(lat[i]) * one_minus_f;
+        }
+        for (std::size_t i = 0; i < n; i++)
+        {
+            cos_bet[i] = atan(sin_bet[i]);
+        }
+        for (std::size_t i = 0; i < n; i++)
+        {
+            cos_bet[i] = cos(cos_bet[i]);
+        }
+        for (std::size_t i = 0; i < n; i++)
+        {
+            sin_bet[i] *= cos_bet[i];
+        }
+
+        // The terms of the segments starting at each vertex, the last vertex
+        // of a ring gives a segment to the next ring which is not used
+        for (std::size_t i = 0; i + 1 < n; i++)
+        {
+            lon21[i] = lon[i + 1] - lon[i];
+            math::normalize_longitude<radian, calc_t>(lon21[i]);
+        }
+        for (std::size_t i = 0; i < n; i++)
+        {
+            trapezoid[i] = tan(lon21[i] / c2);
+        }
+        for (std::size_t i = 0; i + 1 < n; i++)
+        {
+            trapezoid[i] = area_formulas::trapezoidal_formula_tan(tan_half_lat[i],
+                                                                  tan_half_lat[i + 1],
+                                                                  trapezoid[i]);
+        }
+
+        std::size_t ring = 0;
+        for (std::size_t p = first; p < last; p++)
+        {
+            Result sum = 0;
+            for (std::size_t j = polygon_offsets[p]; j < std::size_t(polygon_offsets[p + 1]); j++, ring++)
+            {
+                if (starts[ring] == starts[ring + 1])
+                {
+                    continue;
+                }
+
+                calc_t excess_sum = 0;
+                calc_t correction_sum = 0;
+                std::size_t crosses_prime_meridian = 0;
+                for (std::size_t i = starts[ring]; i + 1 < starts[ring + 1]; i++)
+                {
+                    // As in the strategy
+                    point_type const& p1 = *vertices[i];
+                    point_type const& p2 = *vertices[i + 1];
+                    if (math::equals(get<0>(p1), get<0>(p2)))
+                    {
+                        continue;
+                    }
+                    if (area_formulas::crosses_prime_meridian(p1, p2))
+                    {
+                        crosses_prime_meridian++;
+                    }
+                    if (math::equals(get<1>(p1), 0) && math::equals(get<1>(p2), 0))
+                    {
+                        continue;
+                    }
+
+                    auto const i_res = inverse_type::apply(lon[i], lat[i],
+                                                           lon[i + 1], lat[i + 1],
+                                                           model);
+                    typename area_formulas::point_terms const t1
+                        = { lat[i], sin_bet[i], cos_bet[i] };
+                    typename area_formulas::point_terms const t2
+                        = { lat[i + 1], sin_bet[i + 1], cos_bet[i + 1] };
+                    auto const result = area_formulas::ellipsoidal(lon21[i], t1, t2, i_res,
+                        [&]() { return trapezoid[i]; }, constants);
+
+                    excess_sum += result.spherical_term;
+                    correction_sum += result.ellipsoidal_term;
+                }
+
+                sum += access::ring_area(m_strategy, excess_sum, correction_sum,
+                                         crosses_prime_meridian);
+            }
+            areas[p - first] = sum;
+        }
+    }
+
+private :
+    strategy_type const& m_strategy;
+};
+
+}} // namespace detail::bulk
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Calculates the area of each polygon of a flat or columnar multi polygon
+\ingroup area
+\details The rings are visited in the order of the coordinate buffer, and
+    summed per polygon using the offsets, without any allocation.
+\param multi_polygon a flat_multi_polygon_view or a columnar_multi_polygon
+\param out output iterator receiving the area of each polygon
+\param strategy \param_strategy{area}
+*/
+template <typename MultiPolygon, typename OutputIterator, typename Strategy>
+inline OutputIterator bulk_area(MultiPolygon const& multi_polygon, OutputIterator out,
+                                Strategy const& strategy)
+{
+    auto const view = detail::bulk::flat_view_of(multi_polygon);
+    auto const* const offsets = view.polygon_offsets();
+    for (std::size_t i = 0; i < view.size(); i++)
+    {
+        typename default_area_result<typename MultiPolygon::polygon_type>::type sum = 0;
+        for (std::size_t j = offsets[i]; j < std::size_t(offsets[i + 1]); j++)
+        {
+            sum += geometry::area(detail::bulk::ring_at(view, j), strategy);
+        }
+        *out++ = sum;
+    }
+    return out;
+}
+
+/*!
+\brief Calculates the geographic area of each polygon of a flat or columnar
+    multi polygon, in threads
+\ingroup area
+\details The areas are the same as these calculated by the strategy for each
+    polygon, up to the rounding. The spheroid constants of the strategy are
+    used for all polygons, the terms of each vertex are calculated once for
+    both adjacent segments, and the trapezoidal excesses of the segments are
+    calculated in loops which can be vectorized. The polygons are divided
+    into blocks which are calculated by thread_count threads.
+\param multi_polygon a flat_multi_polygon_view or a columnar_multi_polygon
+\param out output iterator receiving the area of each polygon
+\param strategy the geographic area strategy
+\param thread_count the number of threads, 0 or 1 means the calling thread
+*/
+template
+<
+    typename MultiPolygon, typename OutputIterator,
+    typename FormulaPolicy, std::size_t SeriesOrder,
+    typename Spheroid, typename CalculationType
+>
+inline OutputIterator bulk_area(MultiPolygon const& multi_polygon, OutputIterator out,
+                                strategy::area::geographic
+                                    <
+                                        FormulaPolicy, SeriesOrder, Spheroid, CalculationType
+                                    > const& strategy,
+                                std::size_t thread_count = 1)
+{
+    typedef strategy::area::geographic
+        <
+            FormulaPolicy, SeriesOrder, Spheroid, CalculationType
+        > strategy_type;
+    typedef typename strategy_type::template result_type
+        <
+            typename MultiPolygon::polygon_type
+        >::type result_type;
+
+    auto const view = detail::bulk::flat_view_of(multi_polygon);
+    detail::bulk::geographic_area
+        <
+            FormulaPolicy, SeriesOrder, Spheroid, CalculationType
+        > const kernel(strategy);
+
+    // The areas are calculated in chunks of blocks, and written to the
+    // output iterator by the calling thread
+    std::size_t const block_size = detail::bulk::geographic_area_block_size;
+    std::size_t const chunk_size = block_size * 256 * (std::max)(thread_count, std::size_t(1));
+    std::vector<result_type> areas;
+    for (std::size_t chunk = 0; chunk < view.size(); chunk += chunk_size)
+    {
+        std::size_t const count = (std::min)(chunk_size, view.size() - chunk);
+        areas.resize(count);
+        std::size_t const blocks = (count + block_size - 1) / block_size;
+        detail::parallel_for(blocks, thread_count, [&](std::size_t block)
+        {
+            std::size_t const first = chunk + block * block_size;
+            std::size_t const last = (std::min)(first + block_size, chunk + count);
+            kernel.apply(view, first, last, areas.data() + (first - chunk));
+        });
+        out = std::copy(areas.begin(), areas.end(), out);
+    }
+    return out;
+}
+
+template <typename MultiPolygon, typename OutputIterator>
+inline OutputIterator bulk_area(MultiPolygon const& multi_polygon, OutputIterator out)
+{
+    return bulk_area(multi_polygon, out, default_strategy());
+}
+
+
+/*!
+\brief Calculates the envelope of each polygon of a flat or columnar
+    multi polygon
+\ingroup envelope
+\details Only the exterior rings are visited, the interior rings of valid
+    polygons being inside them.
+\param multi_polygon a flat_multi_polygon_view or a columnar_multi_polygon
+\param out output iterator receiving a Box for each polygon
+\param strategy \param_strategy{envelope}
+*/
+template <typename Box, typename MultiPolygon, typename OutputIterator, typename Strategy>
+inline OutputIterator bulk_envelope(MultiPolygon const& multi_polygon, OutputIterator out,
+                                    Strategy const& strategy)
+{
+    auto const view = detail::bulk::flat_view_of(multi_polygon);
+    for (std::size_t i = 0; i < view.size(); i++)
+    {
+        Box box;
+        geometry::envelope(detail::bulk::ring_at(view, view.polygon_offsets()[i]),
+                           box, strategy);
+        *out++ = box;
+    }
+    return out;
+}
+
+template <typename Box, typename MultiPolygon, typename OutputIterator>
+inline OutputIterator bulk_envelope(MultiPolygon const& multi_polygon, OutputIterator out)
+{
+    return bulk_envelope<Box>(multi_polygon, out, default_strategy());
+}
+
+
+/*!
+\brief Calculates the length of each linestring of a flat or columnar
+    multi linestring
+\ingroup length
+\param multi_linestring a flat_multi_linestring_view or a columnar_multi_linestring
+\param out output iterator receiving the length of each linestring
+\param strategy \param_strategy{distance}
+*/
+template <typename MultiLinestring, typename OutputIterator, typename Strategy>
+inline OutputIterator bulk_length(MultiLinestring const& multi_linestring, OutputIterator out,
+                                  Strategy const& strategy)
+{
+    auto const view = detail::bulk::flat_view_of(multi_linestring);
+    for (std::size_t i = 0; i < view.size(); i++)
+    {
+        *out++ = geometry::length(view.at(i), strategy);
+    }
+    return out;
+}
+
+template <typename MultiLinestring, typename OutputIterator>
+inline OutputIterator bulk_length(MultiLinestring const& multi_linestring, OutputIterator out)
+{
+    return bulk_length(multi_linestring, out, default_strategy());
+}
+
+
+/*!
+\brief Calculates the centroid of each polygon of a flat or columnar
+    multi polygon
+\ingroup centroid
+\param multi_polygon a flat_multi_polygon_view or a columnar_multi_polygon
+\param out output iterator receiving a Point for each polygon
+\param strategy \param_strategy{centroid}
+*/
+template <typename Point, typename MultiPolygon, typename OutputIterator, typename Strategy>
+inline OutputIterator bulk_centroid(MultiPolygon const& multi_polygon, OutputIterator out,
+                                    Strategy const& strategy)
+{
+    auto const view = detail::bulk::flat_view_of(multi_polygon);
+    for (std::size_t i = 0; i < view.size(); i++)
+    {
+        Point point;
+        geometry::centroid(view.at(i), point, strategy);
+        *out++ = point;
+    }
+    return out;
+}
+
+template <typename Point, typename MultiPolygon, typename OutputIterator>
+inline OutputIterator bulk_centroid(MultiPolygon const& multi_polygon, OutputIterator out)
+{
+    return bulk_centroid<Point>(multi_polygon, out, default_strategy());
+}
+
+
+/*!
+\brief Finds, for each point, the first polygon of a flat or columnar
+    multi polygon containing it
+\ingroup within
+\details The envelopes of the polygons are calculated with bulk_envelope.
+    Points and envelopes are then paired by a partition, and only points
+    inside an envelope are tested against its polygon.
+\param points range of points
+\param multi_polygon a flat_multi_polygon_view or a columnar_multi_polygon
+\param strategy \param_strategy{within}
+\return for each point, the index of the polygon, or std::size_t(-1) if
+    the point is not within any of the polygons
+*/
+template <typename Points, typename MultiPolygon, typename Strategy>
+inline std::vector<std::size_t> bulk_within(Points const& points,
+                                            MultiPolygon const& multi_polygon,
+                                            Strategy const& strategy)
+{
+    typedef typename boost::range_value<Points>::type point_type;
+    typedef model::box<typename geometry::point_type<MultiPolygon>::type> box_type;
+    typedef detail::bulk::indexed<point_type> indexed_point;
+    typedef detail::bulk::indexed<box_type> indexed_box;
+
+    auto const view = detail::bulk::flat_view_of(multi_polygon);
+
+    std::vector<box_type> envelopes;
+    envelopes.reserve(view.size());
+    bulk_envelope<box_type>(view, std::back_inserter(envelopes));
+
+    std::vector<indexed_box> boxes;
+    boxes.reserve(envelopes.size());
+    for (std::size_t i = 0; i < envelopes.size(); i++)
+    {
+        boxes.push_back(indexed_box{envelopes[i], i});
+    }
+
+    std::vector<indexed_point> indexed_points;
+    for (auto it = boost::begin(points); it != boost::end(points); ++it)
+    {
+        indexed_points.push_back(indexed_point{*it, indexed_points.size()});
+    }
+
+    std::vector<std::size_t> result(indexed_points.size(), std::size_t(-1));
+    detail::bulk::within_visitor<decltype(view), Strategy> visitor(view, result, strategy);
+    geometry::partition
+        <
+            box_type
+        >::apply(indexed_points, boxes, visitor,
+                 detail::bulk::expand_indexed(), detail::bulk::overlaps_indexed(),
+                 detail::bulk::expand_indexed(), detail::bulk::overlaps_indexed());
+    return result;
+}
+
+template <typename Points, typename MultiPolygon>
+inline std::vector<std::size_t> bulk_within(Points const& points,
+                                            MultiPolygon const& multi_polygon)
+{
+    return bulk_within(points, multi_polygon, default_strategy());
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_BULK_HPP
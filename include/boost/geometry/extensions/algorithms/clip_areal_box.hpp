@@ -0,0 +1,216 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_CLIP_AREAL_BOX_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_CLIP_AREAL_BOX_HPP
+
+#include <type_traits>
+
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/algorithms/detail/overlay/overlay.hpp>
+
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/point_order.hpp>
+#include <boost/geometry/core/static_assert.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/geometries/concepts/check.hpp>
+
+#include <boost/geometry/policies/robustness/no_rescale_policy.hpp>
+
+#include <boost/geometry/strategies/relate/services.hpp>
+
+#include <boost/geometry/util/range.hpp>
+
+#include <boost/geometry/extensions/algorithms/detail/intersection/areal_box.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace clip_areal_box
+{
+
+template <typename Polygon, typename Box, typename PolygonOut>
+struct overlay
+    : detail::overlay::overlay
+        <
+            Polygon, Box,
+            detail::overlay::do_reverse<geometry::point_order<Polygon>::value>::value,
+            false,
+            detail::overlay::do_reverse<geometry::point_order<PolygonOut>::value>::value,
+            PolygonOut, overlay_intersection
+        >
+{};
+
+// Clipped along the box if possible, falling back to the overlay for
+// degenerate cases and non floating point output coordinates
+template
+<
+    typename PolygonOut,
+    bool UseClipper = std::is_floating_point
+        <
+            typename geometry::coordinate_type<PolygonOut>::type
+        >::value
+>
+struct clip_polygon
+{
+    template <typename Polygon, typename Box, typename OutputIterator, typename Strategy>
+    static inline OutputIterator apply(Polygon const& polygon, Box const& box,
+                                       OutputIterator out, Strategy const& strategy)
+    {
+        return overlay<Polygon, Box, PolygonOut>::apply(polygon, box,
+                    detail::no_rescale_policy(), out, strategy);
+    }
+};
+
+template <typename PolygonOut>
+struct clip_polygon<PolygonOut, true>
+{
+    template <typename Polygon, typename Box, typename OutputIterator, typename Strategy>
+    static inline OutputIterator apply(Polygon const& polygon, Box const& box,
+                                       OutputIterator out, Strategy const& strategy)
+    {
+        detail::intersection::areal_box_clipper<PolygonOut> clipper;
+        if (clipper.apply(polygon, box, out, strategy))
+        {
+            return out;
+        }
+        return overlay<Polygon, Box, PolygonOut>::apply(polygon, box,
+                    detail::no_rescale_policy(), out, strategy);
+    }
+};
+
+}} // namespace detail::clip_areal_box
+#endif // DOXYGEN_NO_DETAIL
+
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace dispatch
+{
+
+template <typename Areal, typename Tag = typename tag<Areal>::type>
+struct clip_areal_box
+{
+    BOOST_GEOMETRY_STATIC_ASSERT_FALSE(
+        "Not implemented for this Geometry type.",
+        Areal, Tag);
+};
+
+template <typename Polygon>
+struct clip_areal_box<Polygon, polygon_tag>
+{
+    template <typename Box, typename MultiPolygonOut, typename Strategy>
+    static inline void apply(Polygon const& polygon, Box const& box,
+                             MultiPolygonOut& multi_polygon_out,
+                             Strategy const& strategy)
+    {
+        detail::clip_areal_box::clip_polygon
+            <
+                typename boost::range_value<MultiPolygonOut>::type
+            >::apply(polygon, box, range::back_inserter(multi_polygon_out), strategy);
+    }
+};
+
+// The polygons of a valid multi-polygon do not overlap,
+// so they are clipped one by one
+template <typename MultiPolygon>
+struct clip_areal_box<MultiPolygon, multi_polygon_tag>
+{
+    template <typename Box, typename MultiPolygonOut, typename Strategy>
+    static inline void apply(MultiPolygon const& multi_polygon, Box const& box,
+                             MultiPolygonOut& multi_polygon_out,
+                             Strategy const& strategy)
+    {
+        auto out = range::back_inserter(multi_polygon_out);
+        for (auto const& polygon : multi_polygon)
+        {
+            out = detail::clip_areal_box::clip_polygon
+                <
+                    typename boost::range_value<MultiPolygonOut>::type
+                >::apply(polygon, box, out, strategy);
+        }
+    }
+};
+
+} // namespace dispatch
+#endif // DOXYGEN_NO_DISPATCH
+
+
+/*!
+\brief Calculates the intersection of a polygon or a multi polygon with a box
+    by clipping the rings along the box
+\ingroup intersection
+\details Each ring is walked once, its segments are clipped with Liang-Barsky
+    and the parts inside the box are connected along the box boundary,
+    without building turns. Polygons touching the box (a vertex on its
+    boundary, a segment along one of its sides or through a corner) are
+    intersected by the overlay instead. Unlike intersection(), spikes and
+    collinear points of the input are not removed from the output, and the
+    polygons of a multi polygon are clipped one by one, so it has to be valid.
+\tparam Areal polygon or multi polygon
+\tparam Box \tparam_box
+\tparam MultiPolygonOut multi polygon, or range of polygons, receiving the result
+\tparam Strategy \tparam_strategy{Intersection}
+\param areal the polygon or multi polygon
+\param box the box
+\param multi_polygon_out the polygons of the intersection are appended to it
+\param strategy \param_strategy{intersection}
+\note Currently only for 2D cartesian geometries
+ */
+template <typename Areal, typename Box, typename MultiPolygonOut, typename Strategy>
+inline void clip_areal_box(Areal const& areal, Box const& box,
+                           MultiPolygonOut& multi_polygon_out,
+                           Strategy const& strategy)
+{
+    concepts::check<Areal const>();
+    concepts::check<Box const>();
+
+    BOOST_GEOMETRY_STATIC_ASSERT(
+        (std::is_same
+            <
+                typename cs_tag<Areal>::type, cartesian_tag
+            >::value
+        && geometry::dimension<Areal>::value == 2),
+        "Not implemented for this coordinate system.",
+        typename cs_tag<Areal>::type);
+
+    dispatch::clip_areal_box<Areal>::apply(areal, box, multi_polygon_out, strategy);
+}
+
+
+/*!
+\brief Calculates the intersection of a polygon or a multi polygon with a box
+    by clipping the rings along the box
+\ingroup intersection
+\tparam Areal polygon or multi polygon
+\tparam Box \tparam_box
+\tparam MultiPolygonOut multi polygon, or range of polygons, receiving the result
+\param areal the polygon or multi polygon
+\param box the box
+\param multi_polygon_out the polygons of the intersection are appended to it
+ */
+template <typename Areal, typename Box, typename MultiPolygonOut>
+inline void clip_areal_box(Areal const& areal, Box const& box,
+                           MultiPolygonOut& multi_polygon_out)
+{
+    using strategy_type = typename strategies::relate::services::default_strategy
+        <
+            Areal, Box
+        >::type;
+
+    clip_areal_box(areal, box, multi_polygon_out, strategy_type());
+}
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_CLIP_AREAL_BOX_HPP
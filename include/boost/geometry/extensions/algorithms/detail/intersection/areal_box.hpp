@@ -0,0 +1,671 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_DETAIL_INTERSECTION_AREAL_BOX_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_DETAIL_INTERSECTION_AREAL_BOX_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/size.hpp>
+
+#include <boost/geometry/algorithms/convert.hpp>
+#include <boost/geometry/algorithms/detail/convert_point_to_point.hpp>
+#include <boost/geometry/algorithms/detail/within/point_in_geometry.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_order.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/util/condition.hpp>
+#include <boost/geometry/util/range.hpp>
+#include <boost/geometry/util/select_most_precise.hpp>
+
+#include <boost/geometry/views/detail/closed_clockwise_view.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace intersection
+{
+
+
+// Positions on the boundary of a box, measured clockwise along the boundary,
+// starting at the minimum corner: up along the left side, right along the
+// top, down along the right side and back along the bottom.
+template <typename Box, typename CalculationType>
+struct clip_box_boundary
+{
+    explicit clip_box_boundary(Box const& box)
+        : min_x(get<min_corner, 0>(box))
+        , min_y(get<min_corner, 1>(box))
+        , max_x(get<max_corner, 0>(box))
+        , max_y(get<max_corner, 1>(box))
+        , width(max_x - min_x)
+        , height(max_y - min_y)
+    {}
+
+    // Edges, in the order used by the clipping below
+    enum edge_type { edge_left, edge_right, edge_bottom, edge_top };
+
+    template <typename Point>
+    inline CalculationType position(Point const& point, int edge) const
+    {
+        switch (edge)
+        {
+            case edge_left : return get<1>(point) - min_y;
+            case edge_top : return height + get<0>(point) - min_x;
+            case edge_right : return height + width + max_y - get<1>(point);
+            default : return height + height + width + max_x - get<0>(point);
+        }
+    }
+
+    inline CalculationType corner_position(int index) const
+    {
+        return index == 0 ? CalculationType(0)
+             : index == 1 ? height
+             : index == 2 ? height + width
+             : height + height + width;
+    }
+
+    template <typename Point>
+    inline void assign_corner(int index, Point& point) const
+    {
+        set<0>(point, index == 0 || index == 1 ? min_x : max_x);
+        set<1>(point, index == 0 || index == 3 ? min_y : max_y);
+    }
+
+    // Returns 1 if the point is inside, -1 if it is outside
+    // and 0 if it is located on the boundary of the box
+    template <typename Point>
+    inline int code(Point const& point) const
+    {
+        CalculationType const x = get<0>(point);
+        CalculationType const y = get<1>(point);
+        if (x < min_x || x > max_x || y < min_y || y > max_y)
+        {
+            return -1;
+        }
+        return x > min_x && x < max_x && y > min_y && y < max_y ? 1 : 0;
+    }
+
+    CalculationType min_x, min_y, max_x, max_y;
+    CalculationType width, height;
+};
+
+
+/*!
+    \brief Clips polygons by a box without building turns
+    \details The rings are walked once, the parts inside the box are
+        collected (clipping segments with Liang-Barsky) and afterwards
+        connected along the boundary of the box, in the same way as
+        the Sutherland-Hodgman clipper but without generating edges
+        along the box for parts which are disconnected.
+        If the input touches the box (a vertex on its boundary, a
+        segment through a corner, or along one of its sides) apply
+        returns false and the caller should use the overlay instead.
+    \note Cartesian 2D with floating point coordinates only.
+    \tparam PolygonOut output polygon type
+ */
+template <typename PolygonOut>
+class areal_box_clipper
+{
+    using point_type = typename geometry::point_type<PolygonOut>::type;
+    using ring_out_type = typename geometry::ring_type<PolygonOut>::type;
+    using calc_type = typename select_most_precise
+        <
+            typename geometry::coordinate_type<point_type>::type,
+            double
+        >::type;
+
+    struct piece
+    {
+        std::size_t begin;
+        std::size_t end;
+        calc_type start_position;
+        calc_type end_position;
+        bool used;
+    };
+
+public :
+
+    template
+    <
+        typename Polygon, typename Box,
+        typename OutputIterator, typename Strategy
+    >
+    inline bool apply(Polygon const& polygon, Box const& box,
+                      OutputIterator& out, Strategy const& strategy)
+    {
+        clip_box_boundary<Box, calc_type> const boundary(box);
+        if (! (boundary.width > 0 && boundary.height > 0))
+        {
+            return false;
+        }
+
+        m_points.clear();
+        m_pieces.clear();
+        m_inside_holes.clear();
+
+        bool exterior_inside = false;
+        bool box_in_exterior = false;
+        bool box_in_hole = false;
+
+        int const exterior_code = clip_ring(exterior_ring(polygon), boundary,
+                                            polygon, strategy);
+        if (exterior_code == ring_degenerate)
+        {
+            return false;
+        }
+        exterior_inside = exterior_code == ring_inside;
+        box_in_exterior = exterior_code == ring_around_box;
+
+        bool const exterior_crosses = ! m_pieces.empty();
+
+        auto const& rings = interior_rings(polygon);
+        std::size_t index = 0;
+        for (auto it = boost::begin(rings); it != boost::end(rings); ++it, ++index)
+        {
+            int const code = clip_ring(*it, boundary, polygon, strategy);
+            if (code == ring_degenerate)
+            {
+                return false;
+            }
+            else if (code == ring_inside)
+            {
+                m_inside_holes.push_back(index);
+            }
+            else if (code == ring_around_box)
+            {
+                box_in_hole = true;
+            }
+        }
+
+        if (box_in_hole)
+        {
+            // The box is inside one of the holes, nothing is visible
+            return ! exterior_crosses && m_pieces.empty();
+        }
+
+        if (m_pieces.empty())
+        {
+            if (exterior_inside)
+            {
+                PolygonOut result;
+                geometry::convert(polygon, result);
+                *out++ = result;
+            }
+            else if (box_in_exterior)
+            {
+                PolygonOut result;
+                for (int i = 0; i < 4; i++)
+                {
+                    append_corner(exterior_ring(result), boundary, i);
+                }
+                append_corner(exterior_ring(result), boundary, 0);
+                add_holes(result, polygon, strategy, true);
+                *out++ = result;
+            }
+            return true;
+        }
+
+        if (! exterior_crosses && ! box_in_exterior)
+        {
+            // Holes crossing the box but the exterior ring does not: invalid
+            return false;
+        }
+
+        return link(boundary, polygon, out, strategy);
+    }
+
+private :
+
+    static const int ring_degenerate = 0;
+    static const int ring_inside = 1;
+    static const int ring_outside = 2;
+    static const int ring_around_box = 3;
+    static const int ring_crosses = 4;
+
+    template <typename Point, typename Boundary>
+    static inline bool clip_segment(Point const& p, Point const& q,
+                                    Boundary const& boundary,
+                                    calc_type& t0, calc_type& t1,
+                                    int& entry_edge, int& exit_edge,
+                                    bool& degenerate)
+    {
+        calc_type const x = get<0>(p);
+        calc_type const y = get<1>(p);
+        calc_type const dx = calc_type(get<0>(q)) - x;
+        calc_type const dy = calc_type(get<1>(q)) - y;
+
+        calc_type const ps[4] = { -dx, dx, -dy, dy };
+        calc_type const qs[4] = { x - boundary.min_x, boundary.max_x - x,
+                                  y - boundary.min_y, boundary.max_y - y };
+
+        t0 = 0;
+        t1 = 1;
+        for (int edge = 0; edge < 4; edge++)
+        {
+            if (ps[edge] < 0)
+            {
+                calc_type const r = qs[edge] / ps[edge];
+                if (r > t1)
+                {
+                    return false;
+                }
+                if (r > t0)
+                {
+                    t0 = r;
+                    entry_edge = edge;
+                }
+            }
+            else if (ps[edge] > 0)
+            {
+                calc_type const r = qs[edge] / ps[edge];
+                if (r < t0)
+                {
+                    return false;
+                }
+                if (r < t1)
+                {
+                    t1 = r;
+                    exit_edge = edge;
+                }
+            }
+            else if (qs[edge] < 0)
+            {
+                return false;
+            }
+            else if (qs[edge] == 0)
+            {
+                // Along the side of the box
+                degenerate = true;
+                return false;
+            }
+        }
+
+        if (! (t0 < t1))
+        {
+            // Touching the box in one point (a corner)
+            degenerate = true;
+            return false;
+        }
+        return true;
+    }
+
+    // Assigns the intersection point on the specified edge, the coordinate
+    // along the edge is clamped, the other is set exactly.
+    template <typename Point, typename Boundary>
+    static inline bool assign_on_edge(Point const& p, Point const& q,
+                                      calc_type t, int edge,
+                                      Boundary const& boundary,
+                                      point_type& result)
+    {
+        calc_type const x = get<0>(p);
+        calc_type const y = get<1>(p);
+        calc_type cx = x + t * (calc_type(get<0>(q)) - x);
+        calc_type cy = y + t * (calc_type(get<1>(q)) - y);
+
+        if (edge == Boundary::edge_left || edge == Boundary::edge_right)
+        {
+            cx = edge == Boundary::edge_left ? boundary.min_x : boundary.max_x;
+            cy = (std::min)((std::max)(cy, boundary.min_y), boundary.max_y);
+            set<0>(result, cx);
+            set<1>(result, cy);
+            return cy > boundary.min_y && cy < boundary.max_y;
+        }
+
+        cy = edge == Boundary::edge_bottom ? boundary.min_y : boundary.max_y;
+        cx = (std::min)((std::max)(cx, boundary.min_x), boundary.max_x);
+        set<0>(result, cx);
+        set<1>(result, cy);
+        return cx > boundary.min_x && cx < boundary.max_x;
+    }
+
+    template <typename Point>
+    inline void append_point(Point const& point)
+    {
+        point_type p;
+        geometry::detail::conversion::convert_point_to_point(point, p);
+        if (m_points.empty()
+            || ! (get<0>(m_points.back()) == get<0>(p)
+                  && get<1>(m_points.back()) == get<1>(p)))
+        {
+            m_points.push_back(p);
+        }
+    }
+
+    template <typename Ring, typename Boundary, typename Polygon, typename Strategy>
+    inline int clip_ring(Ring const& ring, Boundary const& boundary,
+                         Polygon const& polygon, Strategy const& strategy)
+    {
+        detail::closed_clockwise_view
+            <
+                Ring const,
+                geometry::closure<Polygon>::value,
+                geometry::point_order<Polygon>::value
+            > const view(ring);
+
+        std::size_t const size = boost::size(view);
+        if (size < 4)
+        {
+            return ring_degenerate;
+        }
+
+        // The last point of the closed view is equal to the first one
+        std::size_t const count = size - 1;
+        std::size_t start = count;
+        bool has_inside = false;
+        for (std::size_t i = 0; i < count; i++)
+        {
+            int const code = boundary.code(range::at(view, i));
+            if (code == 0)
+            {
+                return ring_degenerate;
+            }
+            else if (code == 1)
+            {
+                has_inside = true;
+            }
+            else if (start == count)
+            {
+                start = i;
+            }
+        }
+
+        if (start == count)
+        {
+            return ring_inside;
+        }
+
+        // Start walking at a point outside the box,
+        // such that all pieces are complete at the end of the loop
+        std::size_t const pieces_before = m_pieces.size();
+        bool inside = false;
+        for (std::size_t n = 0; n < count; n++)
+        {
+            auto const& p = range::at(view, (start + n) % count);
+            auto const& q = range::at(view, (start + n + 1) % count);
+
+            if (inside && boundary.code(q) == 1)
+            {
+                append_point(q);
+                continue;
+            }
+
+            calc_type t0 = 0, t1 = 1;
+            int entry_edge = -1, exit_edge = -1;
+            bool degenerate = false;
+            if (! clip_segment(p, q, boundary, t0, t1,
+                               entry_edge, exit_edge, degenerate))
+            {
+                if (degenerate || inside)
+                {
+                    return ring_degenerate;
+                }
+                continue;
+            }
+
+            if (! inside)
+            {
+                point_type entry;
+                if (! assign_on_edge(p, q, t0, entry_edge, boundary, entry))
+                {
+                    return ring_degenerate;
+                }
+                piece pc;
+                pc.begin = m_points.size();
+                pc.end = pc.begin;
+                pc.start_position = boundary.position(entry, entry_edge);
+                pc.end_position = pc.start_position;
+                pc.used = false;
+                m_pieces.push_back(pc);
+                m_points.push_back(entry);
+                inside = true;
+            }
+
+            if (exit_edge < 0)
+            {
+                append_point(q);
+            }
+            else
+            {
+                point_type exit;
+                if (! assign_on_edge(p, q, t1, exit_edge, boundary, exit))
+                {
+                    return ring_degenerate;
+                }
+                append_point(exit);
+                m_pieces.back().end_position = boundary.position(exit, exit_edge);
+                m_pieces.back().end = m_points.size();
+                inside = false;
+            }
+        }
+
+        if (m_pieces.size() > pieces_before)
+        {
+            return ring_crosses;
+        }
+
+        if (has_inside)
+        {
+            // Points inside, but no pieces
+            return ring_degenerate;
+        }
+
+        // The ring is completely outside the box, or the box is inside the ring
+        point_type center;
+        set<0>(center, (boundary.min_x + boundary.max_x) / 2);
+        set<1>(center, (boundary.min_y + boundary.max_y) / 2);
+        int const pip = detail::within::point_in_range(center, view,
+                                strategy.relate(center, polygon));
+        return pip == 1 ? ring_around_box
+             : pip == -1 ? ring_outside
+             : ring_degenerate;
+    }
+
+    template <typename Boundary>
+    inline void append_corner(ring_out_type& ring, Boundary const& boundary, int index) const
+    {
+        point_type corner;
+        boundary.assign_corner(index, corner);
+        range::push_back(ring, corner);
+    }
+
+    // Appends the corners passed when walking clockwise from one position
+    // on the boundary to another
+    template <typename Boundary>
+    inline void append_corners(ring_out_type& ring, Boundary const& boundary,
+                               calc_type from, calc_type to) const
+    {
+        if (from < to)
+        {
+            for (int i = 0; i < 4; i++)
+            {
+                calc_type const c = boundary.corner_position(i);
+                if (c > from && c < to)
+                {
+                    append_corner(ring, boundary, i);
+                }
+            }
+            return;
+        }
+
+        for (int i = 1; i < 4; i++)
+        {
+            if (boundary.corner_position(i) > from)
+            {
+                append_corner(ring, boundary, i);
+            }
+        }
+        for (int i = 0; i < 4; i++)
+        {
+            if (boundary.corner_position(i) < to)
+            {
+                append_corner(ring, boundary, i);
+            }
+        }
+    }
+
+    template
+    <
+        typename Boundary, typename Polygon,
+        typename OutputIterator, typename Strategy
+    >
+    inline bool link(Boundary const& boundary, Polygon const& polygon,
+                     OutputIterator& out, Strategy const& strategy)
+    {
+        // All positions where the rings cross the boundary should be distinct
+        m_positions.clear();
+        m_order.clear();
+        for (std::size_t i = 0; i < m_pieces.size(); i++)
+        {
+            m_positions.push_back(m_pieces[i].start_position);
+            m_positions.push_back(m_pieces[i].end_position);
+            m_order.push_back(i);
+        }
+        std::sort(m_positions.begin(), m_positions.end());
+        if (std::adjacent_find(m_positions.begin(), m_positions.end())
+                != m_positions.end())
+        {
+            return false;
+        }
+
+        std::sort(m_order.begin(), m_order.end(),
+                  [this](std::size_t a, std::size_t b)
+                  {
+                      return m_pieces[a].start_position
+                           < m_pieces[b].start_position;
+                  });
+
+        m_results.clear();
+        for (std::size_t i = 0; i < m_pieces.size(); i++)
+        {
+            if (m_pieces[i].used)
+            {
+                continue;
+            }
+
+            PolygonOut result;
+            ring_out_type& ring = exterior_ring(result);
+            std::size_t current = i;
+            do
+            {
+                piece& pc = m_pieces[current];
+                if (pc.used)
+                {
+                    // Not returned to the first piece
+                    return false;
+                }
+                pc.used = true;
+                for (std::size_t j = pc.begin; j < pc.end; j++)
+                {
+                    range::push_back(ring, m_points[j]);
+                }
+
+                // The next piece starts at the first position after the end
+                // of this piece (walking clockwise along the boundary)
+                auto it = std::upper_bound(m_order.begin(), m_order.end(),
+                            pc.end_position,
+                            [this](calc_type const& value, std::size_t index)
+                            {
+                                return value < m_pieces[index].start_position;
+                            });
+                std::size_t const next = it == m_order.end()
+                                       ? m_order.front() : *it;
+
+                append_corners(ring, boundary, pc.end_position,
+                               m_pieces[next].start_position);
+                current = next;
+            } while (current != i);
+
+            range::push_back(ring, range::front(ring));
+            m_results.push_back(std::move(result));
+        }
+
+        for (PolygonOut& result : m_results)
+        {
+            add_holes(result, polygon, strategy, m_results.size() == 1);
+            *out++ = std::move(result);
+        }
+
+        return true;
+    }
+
+    // Adds the holes inside the box to the polygon containing them,
+    // and fixes the orientation and closure of the exterior ring
+    template <typename Polygon, typename Strategy>
+    inline void add_holes(PolygonOut& result, Polygon const& polygon,
+                          Strategy const& strategy, bool all)
+    {
+        ring_out_type& ring = exterior_ring(result);
+        auto const& rings = interior_rings(polygon);
+        std::size_t kept = 0;
+        for (std::size_t const index : m_inside_holes)
+        {
+            auto const& hole = range::at(rings, index);
+
+            point_type point;
+            geometry::detail::conversion::convert_point_to_point(
+                range::front(hole), point);
+            if (all
+                || detail::within::point_in_range(point, ring,
+                        strategy.relate(point, result)) == 1)
+            {
+                ring_out_type hole_out;
+                geometry::convert(hole, hole_out);
+                range::push_back(interior_rings(result), std::move(hole_out));
+            }
+            else
+            {
+                m_inside_holes[kept++] = index;
+            }
+        }
+        m_inside_holes.resize(kept);
+
+        // The exterior ring is built clockwise and closed
+        if (BOOST_GEOMETRY_CONDITION(
+                geometry::point_order<PolygonOut>::value == counterclockwise))
+        {
+            std::reverse(boost::begin(ring), boost::end(ring));
+        }
+        if (BOOST_GEOMETRY_CONDITION(
+                geometry::closure<PolygonOut>::value == open))
+        {
+            range::pop_back(ring);
+        }
+    }
+
+    std::vector<point_type> m_points;
+    std::vector<piece> m_pieces;
+    std::vector<calc_type> m_positions;
+    std::vector<std::size_t> m_order;
+    std::vector<PolygonOut> m_results;
+    std::vector<std::size_t> m_inside_holes;
+};
+
+
+}} // namespace detail::intersection
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_DETAIL_INTERSECTION_AREAL_BOX_HPP
@@ -0,0 +1,198 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_DISTANCE_MATRIX_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_DISTANCE_MATRIX_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/size.hpp>
+
+#include <boost/geometry/core/radian_access.hpp>
+#include <boost/geometry/formulas/andoyer_inverse.hpp>
+#include <boost/geometry/formulas/inverse_matrix.hpp>
+#include <boost/geometry/formulas/meridian_inverse.hpp>
+#include <boost/geometry/formulas/thomas_inverse.hpp>
+#include <boost/geometry/formulas/vincenty_inverse.hpp>
+#include <boost/geometry/strategies/geographic/distance.hpp>
+#include <boost/geometry/strategies/geographic/parameters.hpp>
+#include <boost/geometry/util/math.hpp>
+#include <boost/geometry/util/parallel_for.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace distance_matrix
+{
+
+// The formula of the strategy, the formulas with hoisted terms are the
+// formulas themselves and not the types derived from them by the policies
+template <typename FormulaPolicy, typename CT>
+struct inverse_formula
+{
+    typedef typename FormulaPolicy::template inverse
+        <
+            CT, true, false, false, false, false
+        > type;
+};
+
+template <typename CT>
+struct inverse_formula<strategy::andoyer, CT>
+{
+    typedef formula::andoyer_inverse<CT, true, false, false, false, false> type;
+};
+
+template <typename CT>
+struct inverse_formula<strategy::thomas, CT>
+{
+    typedef formula::thomas_inverse<CT, true, false, false, false, false> type;
+};
+
+template <typename CT>
+struct inverse_formula<strategy::vincenty, CT>
+{
+    typedef formula::vincenty_inverse<CT, true, false, false, false, false> type;
+};
+
+template <typename CT, typename Points1, typename Points2,
+          typename FormulaPolicy, typename Spheroid, typename CalculationType>
+inline void apply(Points1 const& points1, Points2 const& points2, CT* distances,
+                  strategy::distance::geographic
+                      <
+                          FormulaPolicy, Spheroid, CalculationType
+                      > const& strategy,
+                  std::size_t thread_count)
+{
+    typedef typename inverse_formula<FormulaPolicy, CT>::type inverse_type;
+    typedef formula::inverse_matrix<inverse_type> matrix_type;
+    typedef typename matrix_type::point_type point_type;
+    typedef formula::meridian_inverse
+        <
+            CT, strategy::default_order<FormulaPolicy>::value
+        > meridian_inverse;
+
+    Spheroid const& spheroid = strategy.model();
+
+    std::vector<point_type> prepared1, prepared2;
+    prepared1.reserve(boost::size(points1));
+    prepared2.reserve(boost::size(points2));
+    for (auto it = boost::begin(points1); it != boost::end(points1); ++it)
+    {
+        prepared1.push_back(matrix_type::prepare(CT(get_as_radian<0>(*it)),
+                                                 CT(get_as_radian<1>(*it)), spheroid));
+    }
+    for (auto it = boost::begin(points2); it != boost::end(points2); ++it)
+    {
+        prepared2.push_back(matrix_type::prepare(CT(get_as_radian<0>(*it)),
+                                                 CT(get_as_radian<1>(*it)), spheroid));
+    }
+
+    CT const pi = math::pi<CT>();
+    CT const c_half = CT(0.5);
+    CT const tolerance = CT(1e-9);
+    CT const max_lat = pi / CT(2) - tolerance;
+
+    std::size_t const count2 = prepared2.size();
+    std::size_t const block_size = formula::detail::inverse_matrix_block_size;
+    std::size_t const blocks = (count2 + block_size - 1) / block_size;
+    parallel_for(prepared1.size() * blocks, thread_count, [&](std::size_t task)
+    {
+        std::size_t const i = task / blocks;
+        std::size_t const first = (task % blocks) * block_size;
+        std::size_t const count = (std::min)(block_size, count2 - first);
+        CT* row = distances + i * count2 + first;
+
+        matrix_type::apply_row(prepared1[i], prepared2.data() + first, count,
+                               spheroid, row);
+
+        // As in the strategy, the points on the same meridian. The
+        // difference of longitudes has to be a multiple of pi or both points
+        // have to be at the poles, this is checked roughly before the exact
+        // check of meridian_inverse.
+        point_type const& p1 = prepared1[i];
+        for (std::size_t j = 0; j < count; ++j)
+        {
+            point_type const& p2 = prepared2[first + j];
+            CT const half_turns = math::abs(p2.lon - p1.lon) / pi;
+            if (math::abs(half_turns - std::floor(half_turns + c_half)) > tolerance
+                && (math::abs(p1.lat) < max_lat || math::abs(p2.lat) < max_lat))
+            {
+                continue;
+            }
+
+            typename meridian_inverse::result const res
+                = meridian_inverse::apply(p1.lon, p1.lat, p2.lon, p2.lat, spheroid);
+            if (res.meridian)
+            {
+                row[j] = res.distance;
+            }
+        }
+    });
+}
+
+}} // namespace detail::distance_matrix
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Calculates the geographic distances between all points of two ranges,
+    written row by row to a dense matrix
+\details distances[i * n2 + j] is the distance between the point i of the
+    first range and the point j of the second range, where n2 is the number
+    of points of the second range. The distances are the same as these
+    calculated by the strategy for each pair, up to the rounding. The terms
+    of the formula of the strategy depending on one point only are
+    calculated once for each point, see formula::inverse_matrix. With one
+    point in the first range the distances from one origin to many targets
+    are calculated. The rows are divided into blocks which are calculated
+    by thread_count threads.
+\ingroup distance
+\tparam Points1 \tparam_range_point
+\tparam Points2 \tparam_range_point
+\param points1 the points of the rows
+\param points2 the points of the columns
+\param distances the matrix of at least n1 * n2 values
+\param strategy the geographic distance strategy
+\param thread_count the number of threads, 0 or 1 means the calling thread
+*/
+template <typename Points1, typename Points2, typename CT,
+          typename FormulaPolicy, typename Spheroid, typename CalculationType>
+inline void distance_matrix(Points1 const& points1, Points2 const& points2,
+                            CT* distances,
+                            strategy::distance::geographic
+                                <
+                                    FormulaPolicy, Spheroid, CalculationType
+                                > const& strategy,
+                            std::size_t thread_count = 1)
+{
+    detail::distance_matrix::apply(points1, points2, distances, strategy, thread_count);
+}
+
+/*!
+\brief Calculates the geographic distances between all points of two ranges
+    with the default geographic strategy
+\ingroup distance
+*/
+template <typename Points1, typename Points2, typename CT>
+inline void distance_matrix(Points1 const& points1, Points2 const& points2,
+                            CT* distances)
+{
+    detail::distance_matrix::apply(points1, points2, distances,
+                                   strategy::distance::geographic<>(), 1);
+}
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_DISTANCE_MATRIX_HPP
@@ -0,0 +1,499 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_INTERSECTION_TILES_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_INTERSECTION_TILES_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator_range.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/algorithms/convert.hpp>
+#include <boost/geometry/algorithms/covered_by.hpp>
+#include <boost/geometry/algorithms/detail/overlay/clip_linestring.hpp>
+#include <boost/geometry/algorithms/detail/overlay/intersection_insert.hpp>
+#include <boost/geometry/algorithms/detail/partition.hpp>
+#include <boost/geometry/algorithms/detail/sections/range_by_section.hpp>
+#include <boost/geometry/algorithms/detail/sections/section_box_policies.hpp>
+#include <boost/geometry/algorithms/detail/sections/sectionalize.hpp>
+#include <boost/geometry/algorithms/detail/single_geometry.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/coordinate_system.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/static_assert.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+
+#include <boost/geometry/policies/robustness/no_rescale_policy.hpp>
+
+#include <boost/geometry/strategies/relate/services.hpp>
+
+#include <boost/geometry/util/range.hpp>
+#include <boost/geometry/util/sequence.hpp>
+#include <boost/geometry/util/type_traits.hpp>
+
+#include <boost/geometry/views/detail/closed_clockwise_view.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace intersection_tiles
+{
+
+
+// A tile, converted to the box type of the sections, with its position
+// in the input range. The member is called bounding_box such that the
+// section box policies can be used for tiles as well.
+template <typename Box>
+struct indexed_tile
+{
+    Box bounding_box;
+    std::size_t index;
+};
+
+
+// Collects, per tile, the indices of the sections overlapping that tile
+template <typename Sections>
+struct assign_sections_visitor
+{
+    assign_sections_visitor(Sections const& sections,
+                            std::vector<std::vector<std::size_t> >& assigned)
+        : m_sections(sections)
+        , m_assigned(assigned)
+    {}
+
+    template <typename Section, typename Tile>
+    inline bool apply(Section const& section, Tile const& tile)
+    {
+        m_assigned[tile.index].push_back(
+            static_cast<std::size_t>(&section - &m_sections.front()));
+        return true;
+    }
+
+    Sections const& m_sections;
+    std::vector<std::vector<std::size_t> >& m_assigned;
+};
+
+
+// Determines if a point is inside an areal geometry, considering only the
+// segments of the sections which can influence the winding number of the
+// point (the sections at the right side of the point, crossing its y).
+template <typename Point, typename Geometry, typename Sections, typename Strategy>
+inline int point_in_sections(Point const& point, Geometry const& geometry,
+                             Sections const& sections,
+                             Strategy const& strategy)
+{
+    using pip_strategy_type = decltype(strategy.relate(point, geometry));
+    using ring_type = typename ring_type<Geometry>::type;
+    using view_type = detail::closed_clockwise_view
+        <
+            ring_type const, geometry::closure<Geometry>::value, clockwise
+        >;
+
+    pip_strategy_type const pip_strategy = strategy.relate(point, geometry);
+    typename pip_strategy_type::state_type state;
+
+    for (auto const& section : sections)
+    {
+        if (get<1>(point) < get<min_corner, 1>(section.bounding_box)
+            || get<1>(point) > get<max_corner, 1>(section.bounding_box)
+            || get<0>(point) > get<max_corner, 0>(section.bounding_box))
+        {
+            continue;
+        }
+
+        view_type const view(range_by_section(geometry, section));
+        auto previous = boost::begin(view) + section.begin_index;
+        auto const end = boost::begin(view) + section.end_index;
+        for (auto it = previous + 1; previous != end; ++previous, ++it)
+        {
+            if (! pip_strategy.apply(point, *previous, *it, state))
+            {
+                return pip_strategy.result(state);
+            }
+        }
+    }
+
+    return pip_strategy.result(state);
+}
+
+
+template <typename Tile, typename Point>
+inline void assign_tile_center(Tile const& tile, Point& point)
+{
+    set<0>(point, (get<min_corner, 0>(tile) + get<max_corner, 0>(tile)) / 2);
+    set<1>(point, (get<min_corner, 1>(tile) + get<max_corner, 1>(tile)) / 2);
+}
+
+
+struct clip_linear
+{
+    // The sections of one tile are sorted. Adjacent sections of the same
+    // linestring are merged, and the points of each merged run are clipped
+    // with Liang-Barsky. Parts of linestrings outside the tile are never visited.
+    template
+    <
+        typename Geometry, typename Sections, typename Tile,
+        typename GeometryOut, typename Strategy
+    >
+    static inline void apply(Geometry const& geometry,
+                             Sections const& sections,
+                             std::vector<std::size_t> const& indices,
+                             Tile const& tile,
+                             GeometryOut& geometry_out,
+                             Strategy const& )
+    {
+        using single_out = typename boost::range_value<GeometryOut>::type;
+        using point_type = typename geometry::point_type<single_out>::type;
+
+        strategy::intersection::liang_barsky<Tile, point_type> lb_strategy;
+
+        std::size_t i = 0;
+        while (i < indices.size())
+        {
+            auto const& first = sections[indices[i]];
+            signed_size_type end_index = first.end_index;
+            std::size_t j = i + 1;
+            for (; j < indices.size(); j++)
+            {
+                auto const& next = sections[indices[j]];
+                if (next.ring_id != first.ring_id
+                    || next.begin_index != end_index)
+                {
+                    break;
+                }
+                end_index = next.end_index;
+            }
+
+            auto const& range = range_by_section(geometry, first);
+            auto const begin = boost::begin(range) + first.begin_index;
+            auto const end = boost::begin(range) + end_index + 1;
+
+            detail::intersection::clip_range_with_box<single_out>(tile,
+                boost::make_iterator_range(begin, end),
+                detail::no_rescale_policy(),
+                range::back_inserter(geometry_out), lb_strategy);
+
+            i = j;
+        }
+    }
+};
+
+
+struct clip_areal
+{
+    template
+    <
+        typename Geometry, typename Sections, typename Tile,
+        typename GeometryOut, typename Strategy
+    >
+    static inline void apply(Geometry const& geometry,
+                             Sections const& sections,
+                             std::vector<std::size_t> const& indices,
+                             Tile const& tile,
+                             GeometryOut& geometry_out,
+                             Strategy const& strategy)
+    {
+        using single_out = typename boost::range_value<GeometryOut>::type;
+
+        if (indices.empty())
+        {
+            // The boundary of the geometry does not cross the tile: the tile
+            // is either completely inside, or completely outside.
+            typename geometry::point_type<Geometry>::type center;
+            assign_tile_center(tile, center);
+            if (point_in_sections(center, geometry, sections, strategy) == 1)
+            {
+                single_out tile_polygon;
+                geometry::convert(tile, tile_polygon);
+                range::push_back(geometry_out, tile_polygon);
+            }
+            return;
+        }
+
+        // Polygons of a multi-polygon without any section in this tile cannot
+        // contribute, because another polygon crosses the tile.
+        // The remaining polygons are either inside the tile, or are clipped.
+        std::size_t i = 0;
+        while (i < indices.size())
+        {
+            auto const& first = sections[indices[i]];
+            bool inside = geometry::covered_by(first.bounding_box, tile);
+            std::size_t j = i + 1;
+            for (; j < indices.size()
+                   && sections[indices[j]].ring_id.multi_index
+                        == first.ring_id.multi_index; j++)
+            {
+                inside = inside
+                    && geometry::covered_by(sections[indices[j]].bounding_box, tile);
+            }
+
+            auto const& single = detail::single_geometry(geometry, first.ring_id);
+
+            // The polygon can only be copied if all its sections are inside
+            // the tile. The sections of one polygon are consecutive, so that
+            // is the case if the indices are consecutive and there are no
+            // other sections of the same polygon before or after them.
+            if (inside
+                && indices[j - 1] - indices[i] == j - i - 1
+                && (indices[i] == 0
+                    || sections[indices[i] - 1].ring_id.multi_index
+                        != first.ring_id.multi_index)
+                && (indices[j - 1] + 1 == sections.size()
+                    || sections[indices[j - 1] + 1].ring_id.multi_index
+                        != first.ring_id.multi_index))
+            {
+                single_out polygon;
+                geometry::convert(single, polygon);
+                range::push_back(geometry_out, polygon);
+            }
+            else
+            {
+                detail::intersection::intersection_insert<single_out>(single,
+                    tile, range::back_inserter(geometry_out), strategy);
+            }
+
+            i = j;
+        }
+    }
+
+};
+
+
+}} // namespace detail::intersection_tiles
+#endif // DOXYGEN_NO_DETAIL
+
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace dispatch
+{
+
+
+template
+<
+    typename Geometry,
+    typename Tag = typename tag_cast
+        <
+            typename tag<Geometry>::type, linear_tag, areal_tag
+        >::type
+>
+struct intersection_tiles
+{
+    BOOST_GEOMETRY_STATIC_ASSERT_FALSE(
+        "Not or not yet implemented for this Geometry type.",
+        Geometry, Tag);
+};
+
+
+template <typename Geometry>
+struct intersection_tiles<Geometry, linear_tag>
+    : detail::intersection_tiles::clip_linear
+{};
+
+
+template <typename Geometry>
+struct intersection_tiles<Geometry, areal_tag>
+    : detail::intersection_tiles::clip_areal
+{};
+
+
+} // namespace dispatch
+#endif // DOXYGEN_NO_DISPATCH
+
+
+/*!
+\brief Fills a range of tiles covering the specified box with a regular grid
+\ingroup intersection
+\details Tiles are generated row by row, starting at the minimum corner.
+\tparam Box \tparam_box
+\tparam Tiles range of boxes
+\param extent box to be covered by the grid
+\param columns number of tiles in x-direction
+\param rows number of tiles in y-direction
+\param tiles output range, cleared before filling
+ */
+template <typename Box, typename Tiles>
+inline void make_tile_grid(Box const& extent,
+                           std::size_t columns, std::size_t rows,
+                           Tiles& tiles)
+{
+    using tile_type = typename boost::range_value<Tiles>::type;
+    using coordinate_type = typename coordinate_type<tile_type>::type;
+
+    range::clear(tiles);
+
+    if (columns == 0 || rows == 0)
+    {
+        return;
+    }
+
+    coordinate_type const min_x = get<min_corner, 0>(extent);
+    coordinate_type const min_y = get<min_corner, 1>(extent);
+    coordinate_type const width = get<max_corner, 0>(extent) - min_x;
+    coordinate_type const height = get<max_corner, 1>(extent) - min_y;
+
+    // Tile borders are calculated from the extent for each tile, such that
+    // adjacent tiles share exactly the same coordinates
+    auto const x_at = [&](std::size_t c)
+    {
+        return c == columns ? get<max_corner, 0>(extent)
+            : min_x + width * static_cast<coordinate_type>(c) / static_cast<coordinate_type>(columns);
+    };
+    auto const y_at = [&](std::size_t r)
+    {
+        return r == rows ? get<max_corner, 1>(extent)
+            : min_y + height * static_cast<coordinate_type>(r) / static_cast<coordinate_type>(rows);
+    };
+
+    for (std::size_t r = 0; r < rows; r++)
+    {
+        for (std::size_t c = 0; c < columns; c++)
+        {
+            tile_type tile;
+            set<min_corner, 0>(tile, x_at(c));
+            set<min_corner, 1>(tile, y_at(r));
+            set<max_corner, 0>(tile, x_at(c + 1));
+            set<max_corner, 1>(tile, y_at(r + 1));
+            range::push_back(tiles, tile);
+        }
+    }
+}
+
+
+/*!
+\brief Calculates the intersection of one geometry with each of a range of tiles
+\ingroup intersection
+\details The geometry is sectionalized once. The sections are assigned to
+    the tiles with a partition, such that each tile only visits the parts
+    of the geometry overlapping it. Linear geometries are clipped per section
+    run. For areal geometries, tiles without any section are either fully
+    covered or disjoint, polygons inside a tile are copied and only polygons
+    crossing the tile border are clipped.
+\tparam Geometry \tparam_geometry
+\tparam Tiles range of boxes
+\tparam Outputs range of multi-geometries (multi_linestring for linear input,
+    multi_polygon for areal input)
+\tparam Strategy \tparam_strategy{Intersection}
+\param geometry \param_geometry
+\param tiles the tiles
+\param outputs output range, resized to the number of tiles. The result of
+    tile i is appended to the i-th element.
+\param strategy \param_strategy{intersection}
+\note Currently only for 2D cartesian geometries
+ */
+template
+<
+    typename Geometry, typename Tiles, typename Outputs, typename Strategy
+>
+inline void intersection_tiles(Geometry const& geometry, Tiles const& tiles,
+                               Outputs& outputs, Strategy const& strategy)
+{
+    concepts::check<Geometry const>();
+
+    BOOST_GEOMETRY_STATIC_ASSERT(
+        (std::is_same
+            <
+                typename cs_tag<Geometry>::type, cartesian_tag
+            >::value),
+        "Not implemented for this coordinate system.",
+        typename cs_tag<Geometry>::type);
+
+    using point_type = typename geometry::point_type<Geometry>::type;
+    using box_type = model::box<point_type>;
+    using sections_type = geometry::sections<box_type, 2>;
+    using dimensions = std::integer_sequence<std::size_t, 0, 1>;
+
+    range::resize(outputs, boost::size(tiles));
+
+    sections_type sections;
+    geometry::sectionalize<false, dimensions>(geometry,
+        detail::no_rescale_policy(), sections, strategy);
+
+    if (sections.empty())
+    {
+        return;
+    }
+
+    std::vector<detail::intersection_tiles::indexed_tile<box_type> > indexed;
+    indexed.reserve(boost::size(tiles));
+    std::size_t index = 0;
+    for (auto const& tile : tiles)
+    {
+        detail::intersection_tiles::indexed_tile<box_type> entry;
+        geometry::convert(tile, entry.bounding_box);
+        entry.index = index++;
+        indexed.push_back(entry);
+    }
+
+    std::vector<std::vector<std::size_t> > assigned(indexed.size());
+    detail::intersection_tiles::assign_sections_visitor
+        <
+            sections_type
+        > visitor(sections, assigned);
+
+    geometry::partition
+        <
+            box_type
+        >::apply(sections, indexed, visitor,
+                 detail::section::get_section_box<Strategy>(strategy),
+                 detail::section::overlaps_section_box<Strategy>(strategy));
+
+    for (std::size_t i = 0; i < indexed.size(); i++)
+    {
+        // Partition visits pairs in an arbitrary order
+        std::sort(assigned[i].begin(), assigned[i].end());
+
+        dispatch::intersection_tiles
+            <
+                Geometry
+            >::apply(geometry, sections, assigned[i],
+                     indexed[i].bounding_box, range::at(outputs, i),
+                     strategy);
+    }
+}
+
+
+/*!
+\brief Calculates the intersection of one geometry with each of a range of tiles
+\ingroup intersection
+\tparam Geometry \tparam_geometry
+\tparam Tiles range of boxes
+\tparam Outputs range of multi-geometries
+\param geometry \param_geometry
+\param tiles the tiles
+\param outputs output range, resized to the number of tiles
+ */
+template <typename Geometry, typename Tiles, typename Outputs>
+inline void intersection_tiles(Geometry const& geometry, Tiles const& tiles,
+                               Outputs& outputs)
+{
+    using strategy_type = typename strategies::relate::services::default_strategy
+        <
+            Geometry,
+            typename boost::range_value<Tiles>::type
+        >::type;
+
+    intersection_tiles(geometry, tiles, outputs, strategy_type());
+}
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_INTERSECTION_TILES_HPP
@@ -0,0 +1,516 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_SIMPLIFY_COVERAGE_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_SIMPLIFY_COVERAGE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/algorithms/clear.hpp>
+#include <boost/geometry/algorithms/simplify.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/static_assert.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/util/parallel_for.hpp>
+
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/geometries/linestring.hpp>
+
+#include <boost/geometry/strategies/default_strategy.hpp>
+
+#include <boost/geometry/util/range.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace simplify_coverage
+{
+
+// Points of neighbouring polygons in a coverage are shared exactly,
+// therefore points are compared without any tolerance
+struct less_exact
+{
+    template <typename Point>
+    inline bool operator()(Point const& a, Point const& b) const
+    {
+        return get<0>(a) < get<0>(b)
+            || (get<0>(a) == get<0>(b) && get<1>(a) < get<1>(b));
+    }
+
+    template <typename Point>
+    inline bool operator()(std::pair<Point, Point> const& a,
+                           std::pair<Point, Point> const& b) const
+    {
+        return (*this)(a.first, b.first)
+            || (! (*this)(b.first, a.first) && (*this)(a.second, b.second));
+    }
+};
+
+template <typename Point>
+inline bool equals_exact(Point const& a, Point const& b)
+{
+    return get<0>(a) == get<0>(b) && get<1>(a) == get<1>(b);
+}
+
+
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct collect_rings
+{
+    BOOST_GEOMETRY_STATIC_ASSERT_FALSE(
+        "Not or not yet implemented for this Geometry type.",
+        Geometry, Tag);
+};
+
+template <typename Polygon>
+struct collect_rings<Polygon, polygon_tag>
+{
+    template <typename Rings>
+    static inline void apply(Polygon& polygon, Rings& rings)
+    {
+        rings.push_back(&geometry::exterior_ring(polygon));
+        for (auto& ring : geometry::interior_rings(polygon))
+        {
+            rings.push_back(&ring);
+        }
+    }
+};
+
+template <typename MultiPolygon>
+struct collect_rings<MultiPolygon, multi_polygon_tag>
+{
+    template <typename Rings>
+    static inline void apply(MultiPolygon& multi_polygon, Rings& rings)
+    {
+        for (auto& polygon : multi_polygon)
+        {
+            collect_rings
+                <
+                    typename boost::range_value<MultiPolygon>::type
+                >::apply(polygon, rings);
+        }
+    }
+};
+
+
+// A part of a ring between two nodes, and its orientation in the ring
+struct chain_use
+{
+    std::size_t index;
+    bool reversed;
+};
+
+
+template <typename Point>
+class coverage_edges
+{
+    using chain_type = model::linestring<Point>;
+
+public :
+
+    // Collects the points of a ring, without duplicates, and closed
+    template <typename Ring>
+    inline void add_ring(Ring const& ring)
+    {
+        std::vector<Point> points;
+        points.reserve(boost::size(ring) + 1);
+        for (auto const& point : ring)
+        {
+            if (points.empty() || ! equals_exact(points.back(), point))
+            {
+                points.push_back(point);
+            }
+        }
+        if (! points.empty() && ! equals_exact(points.front(), points.back()))
+        {
+            points.push_back(points.front());
+        }
+        m_rings.push_back(std::move(points));
+    }
+
+    // Detects the nodes: points where three or more edges meet, or where
+    // only one edge ends. Between the nodes, the border is shared by the
+    // same polygons (or belongs to one polygon only).
+    inline void find_nodes()
+    {
+        std::vector<std::pair<Point, Point>> segments;
+        for (auto const& points : m_rings)
+        {
+            if (! is_valid_ring(points))
+            {
+                continue;
+            }
+            for (std::size_t i = 1; i < points.size(); i++)
+            {
+                segments.push_back(less_exact()(points[i], points[i - 1])
+                    ? std::make_pair(points[i], points[i - 1])
+                    : std::make_pair(points[i - 1], points[i]));
+            }
+        }
+
+        less_exact const less;
+        std::sort(segments.begin(), segments.end(), less);
+        segments.erase(std::unique(segments.begin(), segments.end(),
+            [](auto const& a, auto const& b)
+            {
+                return equals_exact(a.first, b.first)
+                    && equals_exact(a.second, b.second);
+            }), segments.end());
+
+        std::vector<Point> endpoints;
+        endpoints.reserve(2 * segments.size());
+        for (auto const& segment : segments)
+        {
+            endpoints.push_back(segment.first);
+            endpoints.push_back(segment.second);
+        }
+        segments = {};
+
+        std::sort(endpoints.begin(), endpoints.end(), less);
+
+        for (std::size_t i = 0; i < endpoints.size(); )
+        {
+            std::size_t j = i + 1;
+            while (j < endpoints.size() && equals_exact(endpoints[i], endpoints[j]))
+            {
+                j++;
+            }
+            if (j - i != 2)
+            {
+                m_nodes.push_back(endpoints[i]);
+            }
+            i = j;
+        }
+    }
+
+    // Splits all rings into chains between nodes and keeps each chain once
+    inline void build_chains()
+    {
+        m_ring_chains.resize(m_rings.size());
+        std::vector<chain_type> chains;
+
+        for (std::size_t r = 0; r < m_rings.size(); r++)
+        {
+            std::vector<Point> const& points = m_rings[r];
+            if (! is_valid_ring(points))
+            {
+                continue;
+            }
+
+            // Start at a node, or at the smallest point if there is no node,
+            // such that a neighbouring ring starts at the same point
+            std::size_t const n = points.size() - 1;
+            std::size_t start = n;
+            for (std::size_t i = 0; i < n && start == n; i++)
+            {
+                if (is_node(points[i]))
+                {
+                    start = i;
+                }
+            }
+            if (start == n)
+            {
+                start = std::min_element(points.begin(), points.end() - 1,
+                                         less_exact()) - points.begin();
+            }
+
+            chain_type chain;
+            chain.push_back(points[start]);
+            for (std::size_t j = 1; j <= n; j++)
+            {
+                Point const& point = points[(start + j) % n];
+                chain.push_back(point);
+                if (j == n || is_node(point))
+                {
+                    add_chain(std::move(chain), r, chains);
+                    chain = chain_type();
+                    chain.push_back(point);
+                }
+            }
+        }
+
+        // Chains are identified by their first segment, in canonical
+        // orientation: the same chain used by two rings is kept once
+        std::vector<std::size_t> order(chains.size());
+        for (std::size_t i = 0; i < order.size(); i++)
+        {
+            order[i] = i;
+        }
+        auto const key = [](chain_type const& chain)
+        {
+            return std::make_pair(range::at(chain, 0), range::at(chain, 1));
+        };
+        less_exact const less;
+        std::sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b)
+        {
+            return less(key(chains[a]), key(chains[b]));
+        });
+
+        std::vector<std::size_t> unique_index(chains.size());
+        for (std::size_t i = 0; i < order.size(); i++)
+        {
+            if (m_chains.empty() || less(key(m_chains.back()), key(chains[order[i]])))
+            {
+                m_chains.push_back(std::move(chains[order[i]]));
+            }
+            unique_index[order[i]] = m_chains.size() - 1;
+        }
+
+        for (auto& ring_chains : m_ring_chains)
+        {
+            for (chain_use& use : ring_chains)
+            {
+                use.index = unique_index[use.index];
+            }
+        }
+
+        m_rings = {};
+    }
+
+    // Simplifies each chain once, possibly in parallel
+    template <typename Distance, typename Strategy>
+    inline void simplify(Distance const& max_distance, Strategy const& strategy,
+                         std::size_t thread_count)
+    {
+        m_simplified.resize(m_chains.size());
+        detail::parallel_for(m_chains.size(), thread_count,
+            [&](std::size_t i)
+            {
+                geometry::simplify(m_chains[i], m_simplified[i],
+                                   max_distance, strategy);
+            });
+
+        // If a ring would collapse, its chains are not simplified. Because
+        // chains are shared, this can affect other rings too, but a
+        // ring can only get more points again.
+        m_keep_original.assign(m_chains.size(), false);
+        bool changed = true;
+        while (changed)
+        {
+            changed = false;
+            for (auto const& ring_chains : m_ring_chains)
+            {
+                if (ring_chains.empty() || point_count(ring_chains) >= 3)
+                {
+                    continue;
+                }
+                for (chain_use const& use : ring_chains)
+                {
+                    if (! m_keep_original[use.index])
+                    {
+                        m_keep_original[use.index] = true;
+                        changed = true;
+                    }
+                }
+            }
+        }
+    }
+
+    template <typename Ring>
+    inline void assign_ring(std::size_t r, Ring& ring) const
+    {
+        std::vector<chain_use> const& ring_chains = m_ring_chains[r];
+        if (ring_chains.empty())
+        {
+            // Degenerate input ring, it is left as it is
+            return;
+        }
+
+        geometry::clear(ring);
+        for (chain_use const& use : ring_chains)
+        {
+            chain_type const& chain = result(use.index);
+            std::size_t const size = boost::size(chain);
+            for (std::size_t i = 1; i < size; i++)
+            {
+                range::push_back(ring, use.reversed
+                    ? range::at(chain, size - 1 - i)
+                    : range::at(chain, i));
+            }
+        }
+
+        // The last chain ends at the start of the first chain,
+        // which is the closing point for closed rings
+        if (geometry::closure<Ring>::value == closed)
+        {
+            range::push_back(ring, range::front(ring));
+        }
+    }
+
+private :
+
+    static inline bool is_valid_ring(std::vector<Point> const& points)
+    {
+        return points.size() >= 4;
+    }
+
+    inline bool is_node(Point const& point) const
+    {
+        return std::binary_search(m_nodes.begin(), m_nodes.end(), point,
+                                  less_exact());
+    }
+
+    inline chain_type const& result(std::size_t index) const
+    {
+        return m_keep_original[index] ? m_chains[index] : m_simplified[index];
+    }
+
+    inline std::size_t point_count(std::vector<chain_use> const& ring_chains) const
+    {
+        std::size_t count = 0;
+        for (chain_use const& use : ring_chains)
+        {
+            count += boost::size(result(use.index)) - 1;
+        }
+        return count;
+    }
+
+    inline void add_chain(chain_type&& chain, std::size_t ring_index,
+                          std::vector<chain_type>& chains)
+    {
+        std::size_t const size = boost::size(chain);
+        if (equals_exact(range::front(chain), range::back(chain)))
+        {
+            // A closed chain is split at its largest point, which is the same
+            // for all rings using this chain (in either direction)
+            auto const it = std::max_element(boost::begin(chain) + 1,
+                                             boost::end(chain) - 1, less_exact());
+            chain_type first(boost::begin(chain), it + 1);
+            chain_type second(it, boost::end(chain));
+            add_chain(std::move(first), ring_index, chains);
+            add_chain(std::move(second), ring_index, chains);
+            return;
+        }
+
+        // Chains are stored in canonical orientation: starting at their
+        // smallest end point
+        bool const reversed = less_exact()(range::at(chain, size - 1),
+                                           range::at(chain, 0));
+        if (reversed)
+        {
+            std::reverse(boost::begin(chain), boost::end(chain));
+        }
+
+        m_ring_chains[ring_index].push_back(chain_use{chains.size(), reversed});
+        chains.push_back(std::move(chain));
+    }
+
+    std::vector<std::vector<Point>> m_rings;
+    std::vector<Point> m_nodes;
+    std::vector<chain_type> m_chains;
+    std::vector<chain_type> m_simplified;
+    std::vector<bool> m_keep_original;
+    std::vector<std::vector<chain_use>> m_ring_chains;
+};
+
+
+}} // namespace detail::simplify_coverage
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Simplifies a coverage of polygons, keeping shared borders shared
+\ingroup simplify
+\details The borders of the polygons are split into chains at the nodes:
+    the points where three or more borders meet. Each chain is simplified
+    once, and the rings are reassembled from the simplified chains. Therefore
+    the borders between neighbouring polygons stay exactly the same and no
+    gaps or overlaps are introduced, which happens when each polygon is
+    simplified separately. Nodes are never removed. If a ring would collapse,
+    its chains are not simplified.
+    The chains are independent and can be simplified by multiple threads.
+\tparam Coverage range of polygons or multi-polygons, sharing their borders
+    exactly (the same points)
+\tparam Distance \tparam_numeric
+\tparam Strategy A type fulfilling a SimplifyStrategy concept
+\param coverage input coverage
+\param output output coverage, with the same polygons in the same order
+\param max_distance distance (in units of input coordinates) of a vertex
+    to other segments to be removed
+\param strategy simplify strategy to be used for simplification of each chain
+\param thread_count number of threads used to simplify the chains
+\note Like simplify, the simplified chains can intersect other chains if
+    the distance is large compared to the size of the polygons
+ */
+template
+<
+    typename Coverage, typename Distance, typename Strategy
+>
+inline void simplify_coverage(Coverage const& coverage, Coverage& output,
+                              Distance const& max_distance,
+                              Strategy const& strategy,
+                              std::size_t thread_count = 1)
+{
+    using geometry_type = typename boost::range_value<Coverage>::type;
+    using ring_type = typename geometry::ring_type<geometry_type>::type;
+    using point_type = typename geometry::point_type<geometry_type>::type;
+
+    concepts::check<geometry_type const>();
+
+    output = coverage;
+
+    std::vector<ring_type*> rings;
+    for (auto& geometry : output)
+    {
+        detail::simplify_coverage::collect_rings
+            <
+                geometry_type
+            >::apply(geometry, rings);
+    }
+
+    detail::simplify_coverage::coverage_edges<point_type> edges;
+    for (ring_type const* ring : rings)
+    {
+        edges.add_ring(*ring);
+    }
+
+    edges.find_nodes();
+    edges.build_chains();
+    edges.simplify(max_distance, strategy, thread_count);
+
+    for (std::size_t i = 0; i < rings.size(); i++)
+    {
+        edges.assign_ring(i, *rings[i]);
+    }
+}
+
+
+/*!
+\brief Simplifies a coverage of polygons, keeping shared borders shared
+\ingroup simplify
+\tparam Coverage range of polygons or multi-polygons
+\tparam Distance \tparam_numeric
+\param coverage input coverage
+\param output output coverage
+\param max_distance distance (in units of input coordinates) of a vertex
+    to other segments to be removed
+ */
+template <typename Coverage, typename Distance>
+inline void simplify_coverage(Coverage const& coverage, Coverage& output,
+                              Distance const& max_distance)
+{
+    simplify_coverage(coverage, output, max_distance, default_strategy());
+}
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_SIMPLIFY_COVERAGE_HPP
@@ -0,0 +1,145 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_VISVALINGAM_WHYATT_RANKING_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_VISVALINGAM_WHYATT_RANKING_HPP
+
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/size.hpp>
+
+#include <boost/geometry/algorithms/clear.hpp>
+#include <boost/geometry/algorithms/simplify.hpp>
+
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/static_assert.hpp>
+
+#include <boost/geometry/geometries/concepts/check.hpp>
+
+#include <boost/geometry/util/range.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+/*!
+\brief Ranks the points of a linestring by their Visvalingam-Whyatt
+    effective area, such that it can be simplified for any distance
+\ingroup simplify
+\details The effective areas are calculated once (in O(n log n)), and stored
+    with the points. Because the effective area of a point is never smaller
+    than that of any point removed before, simplifying for a distance removes
+    exactly the points with an effective area not larger than its square.
+    Therefore extracting is O(n) and gives the same result as simplify with
+    the strategies::simplify::visvalingam_whyatt strategy, for linestrings.
+    This is useful for progressive rendering, where the same geometry is
+    simplified for many levels of detail.
+    The first and last point are never removed.
+\tparam Point the point type, with a cartesian coordinate system
+*/
+template <typename Point>
+class visvalingam_whyatt_ranking
+{
+    BOOST_GEOMETRY_STATIC_ASSERT(
+        (std::is_same<typename cs_tag<Point>::type, cartesian_tag>::value),
+        "Visvalingam-Whyatt is only implemented for cartesian coordinate systems.",
+        Point);
+
+    using policy_type = detail::simplify::visvalingam_whyatt;
+
+public :
+
+    using area_type = typename policy_type::template area_type<Point>;
+
+    visvalingam_whyatt_ranking() = default;
+
+    template <typename Range>
+    explicit visvalingam_whyatt_ranking(Range const& range)
+    {
+        assign(range);
+    }
+
+    //! Calculates and stores the effective areas of the points of range
+    template <typename Range>
+    inline void assign(Range const& range)
+    {
+        concepts::check<Range const>();
+
+        m_points.assign(boost::begin(range), boost::end(range));
+        m_areas.assign(m_points.size(), (std::numeric_limits<area_type>::max)());
+
+        detail::simplify::visvalingam_whyatt_workspace<area_type> workspace;
+        policy_type::rank(m_points, workspace,
+            [this](std::size_t index, area_type const& area)
+            {
+                m_areas[index] = area;
+                return true;
+            });
+    }
+
+    //! Returns the number of points remaining for the specified distance
+    template <typename Distance>
+    inline std::size_t count(Distance const& max_distance) const
+    {
+        area_type const max_area = max_area_of(max_distance);
+        std::size_t result = 0;
+        for (area_type const& area : m_areas)
+        {
+            if (max_area < area)
+            {
+                result++;
+            }
+        }
+        return result;
+    }
+
+    //! Assigns the points remaining for the specified distance to output
+    template <typename Distance, typename Linestring>
+    inline void extract(Distance const& max_distance, Linestring& output) const
+    {
+        concepts::check<Linestring>();
+
+        geometry::clear(output);
+        area_type const max_area = max_area_of(max_distance);
+        for (std::size_t i = 0; i < m_points.size(); i++)
+        {
+            if (max_area < m_areas[i])
+            {
+                range::push_back(output, m_points[i]);
+            }
+        }
+    }
+
+    //! Returns the points, in their original order
+    inline std::vector<Point> const& points() const { return m_points; }
+
+    //! Returns the effective areas, the first and last point get the maximum
+    inline std::vector<area_type> const& areas() const { return m_areas; }
+
+private :
+
+    template <typename Distance>
+    static inline area_type max_area_of(Distance const& max_distance)
+    {
+        // As in simplify, a negative distance keeps all points
+        return max_distance < 0 ? area_type(-1)
+            : area_type(max_distance) * area_type(max_distance);
+    }
+
+    std::vector<Point> m_points;
+    std::vector<area_type> m_areas;
+};
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_VISVALINGAM_WHYATT_RANKING_HPP
@@ -0,0 +1,232 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_GEOMETRIES_COLUMNAR_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_GEOMETRIES_COLUMNAR_HPP
+
+#include <cstddef>
+#include <vector>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/size.hpp>
+
+#include <boost/geometry/algorithms/detail/convert_point_to_point.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/extensions/views/flat_view.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace columnar
+{
+
+template <typename Points, typename Range>
+inline void append_points(Points& points, Range const& range)
+{
+    typedef typename Points::value_type point_type;
+    for (auto it = boost::begin(range); it != boost::end(range); ++it)
+    {
+        point_type point;
+        geometry::detail::conversion::convert_point_to_point(*it, point);
+        points.push_back(point);
+    }
+}
+
+}} // namespace detail::columnar
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Multi linestring storing all points in one contiguous buffer, and
+    the start of each linestring in an array of offsets
+\ingroup geometries
+\details The layout is as in Apache Arrow (GeoArrow). Adding a linestring
+    does not allocate, apart from the (amortized) growth of the two buffers.
+    The linestrings are flat views, which are invalidated when the
+    buffers grow.
+\tparam Point point type
+\tparam Offset type of the offsets
+*/
+template
+<
+    typename Point = model::point<double, 2, cs::cartesian>,
+    typename Offset = std::size_t
+>
+class columnar_multi_linestring
+{
+public :
+    typedef flat_multi_linestring_view<Point, Offset> view_type;
+    typedef typename view_type::linestring_type linestring_type;
+    typedef typename view_type::const_iterator iterator;
+    typedef typename view_type::const_iterator const_iterator;
+
+    inline columnar_multi_linestring()
+        : m_offsets(1, Offset(0))
+    {}
+
+    //! Appends a linestring, converting its points
+    template <typename Linestring>
+    inline void push_back(Linestring const& linestring)
+    {
+        detail::columnar::append_points(m_points, linestring);
+        m_offsets.push_back(Offset(m_points.size()));
+    }
+
+    inline void reserve(std::size_t linestring_count, std::size_t point_count)
+    {
+        m_offsets.reserve(linestring_count + 1);
+        m_points.reserve(point_count);
+    }
+
+    inline void clear()
+    {
+        m_points.clear();
+        m_offsets.resize(1);
+    }
+
+    inline view_type view() const
+    {
+        return view_type(m_points.data(), m_offsets.data(), size());
+    }
+
+    inline linestring_type at(std::size_t index) const { return view().at(index); }
+    inline const_iterator begin() const { return view().begin(); }
+    inline const_iterator end() const { return view().end(); }
+    inline std::size_t size() const { return m_offsets.size() - 1; }
+    inline bool empty() const { return size() == 0; }
+
+    inline std::vector<Point> const& points() const { return m_points; }
+    inline std::vector<Offset> const& offsets() const { return m_offsets; }
+
+private :
+    std::vector<Point> m_points;
+    std::vector<Offset> m_offsets;
+};
+
+
+/*!
+\brief Multi polygon storing all points in one contiguous buffer, the start
+    of each ring in an array of ring offsets, and the first ring of each
+    polygon in an array of polygon offsets
+\ingroup geometries
+\details The layout is as in Apache Arrow (GeoArrow). Adding a polygon
+    does not allocate, apart from the (amortized) growth of the three
+    buffers, so millions of small polygons are stored in three allocations.
+    The polygons are flat views, which are invalidated when the buffers
+    grow. The polygons added should have the same orientation and closure.
+\tparam Point point type
+\tparam ClockWise true for clockwise direction, false for counter clockwise
+\tparam Closed true for closed rings, false for open rings
+\tparam Offset type of the offsets
+*/
+template
+<
+    typename Point = model::point<double, 2, cs::cartesian>,
+    bool ClockWise = true, bool Closed = true,
+    typename Offset = std::size_t
+>
+class columnar_multi_polygon
+{
+public :
+    typedef flat_multi_polygon_view<Point, ClockWise, Closed, Offset> view_type;
+    typedef typename view_type::polygon_type polygon_type;
+    typedef typename view_type::const_iterator iterator;
+    typedef typename view_type::const_iterator const_iterator;
+
+    inline columnar_multi_polygon()
+        : m_ring_offsets(1, Offset(0))
+        , m_polygon_offsets(1, Offset(0))
+    {}
+
+    //! Appends a polygon, converting its points
+    template <typename Polygon>
+    inline void push_back(Polygon const& polygon)
+    {
+        push_back_ring(geometry::exterior_ring(polygon));
+        auto const& rings = geometry::interior_rings(polygon);
+        for (auto it = boost::begin(rings); it != boost::end(rings); ++it)
+        {
+            push_back_ring(*it);
+        }
+        m_polygon_offsets.push_back(Offset(m_ring_offsets.size() - 1));
+    }
+
+    inline void reserve(std::size_t polygon_count, std::size_t ring_count,
+                        std::size_t point_count)
+    {
+        m_polygon_offsets.reserve(polygon_count + 1);
+        m_ring_offsets.reserve(ring_count + 1);
+        m_points.reserve(point_count);
+    }
+
+    inline void clear()
+    {
+        m_points.clear();
+        m_ring_offsets.resize(1);
+        m_polygon_offsets.resize(1);
+    }
+
+    inline view_type view() const
+    {
+        return view_type(m_points.data(), m_ring_offsets.data(),
+                         m_polygon_offsets.data(), size());
+    }
+
+    inline polygon_type at(std::size_t index) const { return view().at(index); }
+    inline const_iterator begin() const { return view().begin(); }
+    inline const_iterator end() const { return view().end(); }
+    inline std::size_t size() const { return m_polygon_offsets.size() - 1; }
+    inline bool empty() const { return size() == 0; }
+
+    inline std::vector<Point> const& points() const { return m_points; }
+    inline std::vector<Offset> const& ring_offsets() const { return m_ring_offsets; }
+    inline std::vector<Offset> const& polygon_offsets() const { return m_polygon_offsets; }
+
+private :
+    template <typename Ring>
+    inline void push_back_ring(Ring const& ring)
+    {
+        detail::columnar::append_points(m_points, ring);
+        m_ring_offsets.push_back(Offset(m_points.size()));
+    }
+
+    std::vector<Point> m_points;
+    std::vector<Offset> m_ring_offsets;
+    std::vector<Offset> m_polygon_offsets;
+};
+
+
+#ifndef DOXYGEN_NO_TRAITS_SPECIALIZATIONS
+namespace traits
+{
+
+template <typename Point, typename Offset>
+struct tag<columnar_multi_linestring<Point, Offset> >
+{
+    typedef multi_linestring_tag type;
+};
+
+template <typename Point, bool ClockWise, bool Closed, typename Offset>
+struct tag<columnar_multi_polygon<Point, ClockWise, Closed, Offset> >
+{
+    typedef multi_polygon_tag type;
+};
+
+} // namespace traits
+#endif // DOXYGEN_NO_TRAITS_SPECIALIZATIONS
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_GEOMETRIES_COLUMNAR_HPP
@@ -522,10 +522,7 @@ struct read_polygon_policy
         static const bool is_ccw = geometry::point_order<poly_type>::value == geometry::counterclockwise;
         static const bool is_open = geometry::closure<poly_type>::value == geometry::open;
 
-        typename Strategy::point_order_strategy_type
-            order_strategy = strategy.get_point_order_strategy();
-        typename Strategy::template point_in_geometry_strategy<ring_type, ring_type>::type
-            within_strategy = strategy.template get_point_in_geometry_strategy<ring_type, ring_type>();
+        auto const order_strategy = strategy.point_order();
 
         boost::int32_t t;
         //double min_x, min_y, max_x, max_y;
@@ -653,7 +650,7 @@ struct read_polygon_policy
                     {
                         if (is_inner_ring(inner_rings[j],
                                           geometry::exterior_ring(poly),
-                                          within_strategy))
+                                          strategy))
                         {
                             range::push_back(geometry::interior_rings(poly), std::move(inner_rings[j]));
                             ++assigned_count;
@@ -699,7 +696,7 @@ struct read_polygon_policy
     template <typename InnerRing, typename OuterRing, typename Strategy>
     static inline bool is_inner_ring(InnerRing const& inner_ring,
                                      OuterRing const& outer_ring,
-                                     Strategy const& within_strategy)
+                                     Strategy const& strategy)
     {
         // NOTE: The worst case complexity is O(N^2) and best O(N)
         //       R-tree or partition could be used (~O(NlogN))
@@ -707,7 +704,7 @@ struct read_polygon_policy
         typedef typename boost::range_iterator<InnerRing const>::type iter_type;
         for (iter_type it = boost::begin(inner_ring); it != boost::end(inner_ring); ++it)
         {
-            if (detail::within::within_point_geometry(*it, outer_ring, within_strategy))
+            if (detail::within::within_point_geometry(*it, outer_ring, strategy))
             {
                 // at least one point of potentially interior ring found in the interior of exterior ring
                 return true;
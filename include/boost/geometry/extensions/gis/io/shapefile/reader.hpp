@@ -0,0 +1,580 @@
+// Boost.Geometry
+
+// Licensed under the Boost Software License version 1.0.
+// http://www.boost.org/users/license.html
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_GIS_IO_SHAPEFILE_READER_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_GIS_IO_SHAPEFILE_READER_HPP
+
+
+#include <cstddef>
+#include <cstring>
+#include <ios>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/range/value_type.hpp>
+#include <boost/throw_exception.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/extensions/gis/io/shapefile/read.hpp>
+#include <boost/geometry/util/parallel_for.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+namespace detail { namespace shapefile
+{
+
+// Input stream over bytes in memory, implementing the part of the
+// std::istream interface used by the read policies
+class memory_stream
+{
+public :
+    static const std::ios_base::seekdir beg = std::ios_base::beg;
+    static const std::ios_base::seekdir cur = std::ios_base::cur;
+
+    inline memory_stream(char const* first, char const* last)
+        : m_first(first)
+        , m_it(first)
+        , m_last(last)
+        , m_good(true)
+    {}
+
+    inline memory_stream& read(char* s, std::size_t n)
+    {
+        if (std::size_t(m_last - m_it) < n)
+        {
+            m_it = m_last;
+            m_good = false;
+        }
+        else
+        {
+            std::memcpy(s, m_it, n);
+            m_it += n;
+        }
+        return *this;
+    }
+
+    inline memory_stream& seekg(std::ptrdiff_t offset, std::ios_base::seekdir dir)
+    {
+        char const* const base = dir == std::ios_base::beg ? m_first
+                               : dir == std::ios_base::cur ? m_it
+                               : m_last;
+        if (offset < m_first - base || offset > m_last - base)
+        {
+            m_good = false;
+        }
+        else
+        {
+            m_it = base + offset;
+        }
+        return *this;
+    }
+
+    inline memory_stream& seekg(std::ptrdiff_t position)
+    {
+        return seekg(position, std::ios_base::beg);
+    }
+
+    inline void clear() { m_good = true; }
+    inline bool good() const { return m_good; }
+
+private :
+    char const* m_first;
+    char const* m_it;
+    char const* m_last;
+    bool m_good;
+};
+
+template <typename T>
+inline T load_big(char const* bytes)
+{
+    T value;
+    std::memcpy(&value, bytes, sizeof(T));
+    boost::endian::big_to_native_inplace(value);
+    return value;
+}
+
+template <typename T>
+inline T load_little(char const* bytes)
+{
+    T value;
+    memory_stream stream(bytes, bytes + sizeof(T));
+    read_little(stream, value);
+    return value;
+}
+
+// Policy reading one record and how its geometries are added to the output
+template
+<
+    typename Geometry,
+    typename Tag = typename geometry::tag<Geometry>::type
+>
+struct record_reader
+    : not_implemented<Tag>
+{};
+
+template <typename Geometry>
+struct record_reader<Geometry, point_tag>
+{
+    static inline bool is_file_type(boost::int32_t type)
+    {
+        return type == shape_type::point
+            || type == shape_type::point_m
+            || type == shape_type::point_z
+            || type == shape_type::multipoint
+            || type == shape_type::multipoint_m
+            || type == shape_type::multipoint_z;
+    }
+
+    template <typename Range, typename Strategy>
+    static inline void apply(memory_stream& is, Range& output, boost::int32_t type,
+                             Strategy const& strategy)
+    {
+        if (type == shape_type::multipoint
+            || type == shape_type::multipoint_m
+            || type == shape_type::multipoint_z)
+        {
+            read_multipoint_policy::apply(is, output, type, strategy);
+        }
+        else
+        {
+            read_point_policy::apply(is, output, type, strategy);
+        }
+    }
+};
+
+template <typename Geometry>
+struct record_reader<Geometry, linestring_tag>
+{
+    static inline bool is_file_type(boost::int32_t type)
+    {
+        return type == shape_type::polyline
+            || type == shape_type::polyline_m
+            || type == shape_type::polyline_z;
+    }
+
+    template <typename Range, typename Strategy>
+    static inline void apply(memory_stream& is, Range& output, boost::int32_t type,
+                             Strategy const& strategy)
+    {
+        read_polyline_policy::apply(is, output, type, strategy);
+    }
+};
+
+template <typename Geometry>
+struct record_reader<Geometry, polygon_tag>
+{
+    static inline bool is_file_type(boost::int32_t type)
+    {
+        return type == shape_type::polygon
+            || type == shape_type::polygon_m
+            || type == shape_type::polygon_z;
+    }
+
+    template <typename Range, typename Strategy>
+    static inline void apply(memory_stream& is, Range& output, boost::int32_t type,
+                             Strategy const& strategy)
+    {
+        read_polygon_policy::apply(is, output, type, strategy);
+    }
+};
+
+// Each record is added as a new multi geometry
+template <typename Geometry>
+struct record_as_new_element_reader
+{
+    typedef record_reader<typename boost::range_value<Geometry>::type> single_reader;
+
+    static inline bool is_file_type(boost::int32_t type)
+    {
+        return single_reader::is_file_type(type);
+    }
+
+    template <typename Range, typename Strategy>
+    static inline void apply(memory_stream& is, Range& output, boost::int32_t type,
+                             Strategy const& strategy)
+    {
+        range::push_back(output, Geometry());
+        single_reader::apply(is, range::back(output), type, strategy);
+    }
+};
+
+template <typename Geometry>
+struct record_reader<Geometry, multi_point_tag>
+    : record_as_new_element_reader<Geometry>
+{};
+
+template <typename Geometry>
+struct record_reader<Geometry, multi_linestring_tag>
+    : record_as_new_element_reader<Geometry>
+{};
+
+template <typename Geometry>
+struct record_reader<Geometry, multi_polygon_tag>
+    : record_as_new_element_reader<Geometry>
+{};
+
+}} // namespace detail::shapefile
+
+
+/*!
+\brief Reads a shapefile by memory mapping the .shp file and its .shx index
+\ingroup shapefile
+\details The records are accessed directly, using the offsets of the index.
+    Therefore any record can be read without reading the records before it,
+    and ranges of records can be decoded in parallel. The bounding boxes
+    stored in the file can be queried without decoding the records. The
+    geometries are read by the same policies as read_shapefile.
+    A record of a null shape results in no geometry. A record read into
+    a multi geometry results in one multi geometry.
+*/
+class shapefile_reader
+{
+public :
+
+    /*!
+    \brief Maps the .shp file and the .shx file with the same name,
+        throws read_shapefile_exception if they are invalid
+    */
+    explicit inline shapefile_reader(std::string const& shp_path)
+    {
+        // .shp becomes .shx, keeping the case of the extension
+        std::string shx_path = shp_path;
+        if (! shx_path.empty())
+        {
+            char& c = shx_path[shx_path.size() - 1];
+            c = c == 'P' ? 'X' : 'x';
+        }
+        open(shp_path, shx_path);
+    }
+
+    inline shapefile_reader(std::string const& shp_path, std::string const& shx_path)
+    {
+        open(shp_path, shx_path);
+    }
+
+    //! Shape type of the file, e.g. 5 for polygons
+    inline boost::int32_t shape_type() const { return m_type; }
+
+    //! Number of records
+    inline std::size_t size() const { return m_count; }
+
+    //! Returns the bounds of the file, as stored in its header
+    template <typename Box>
+    inline void bounds(Box& box) const
+    {
+        assign_box(header_bytes(m_shp) + 36, box);
+    }
+
+    /*!
+    \brief Returns false for a null shape, or the bounding box of the record,
+        as stored in the file
+    */
+    template <typename Box>
+    inline bool envelope(std::size_t index, Box& box) const
+    {
+        record_box const b = stored_box(index);
+        if (b.empty)
+        {
+            return false;
+        }
+        set_box(box, b.min_x, b.min_y, b.max_x, b.max_y);
+        return true;
+    }
+
+    /*!
+    \brief Returns the indexes of the records of which the stored bounding box
+        intersects the box, without decoding them
+    */
+    template <typename Box>
+    inline std::vector<std::size_t> query(Box const& box) const
+    {
+        double const min_x = geometry::get<min_corner, 0>(box);
+        double const min_y = geometry::get<min_corner, 1>(box);
+        double const max_x = geometry::get<max_corner, 0>(box);
+        double const max_y = geometry::get<max_corner, 1>(box);
+
+        std::vector<std::size_t> result;
+        for (std::size_t i = 0; i < m_count; i++)
+        {
+            record_box const b = stored_box(i);
+            if (! b.empty
+                && b.min_x <= max_x && b.max_x >= min_x
+                && b.min_y <= max_y && b.max_y >= min_y)
+            {
+                result.push_back(i);
+            }
+        }
+        return result;
+    }
+
+    /*!
+    \brief Reads the geometries of the record and adds them to the output
+    */
+    template <typename RangeOfGeometries, typename Strategy>
+    inline void read(std::size_t index, RangeOfGeometries& output,
+                     Strategy const& strategy) const
+    {
+        typedef typename boost::range_value<RangeOfGeometries>::type geometry_type;
+        typedef detail::shapefile::record_reader<geometry_type> reader_type;
+
+        geometry::concepts::check<geometry_type>();
+
+        if (! reader_type::is_file_type(m_type))
+        {
+            BOOST_THROW_EXCEPTION(read_shapefile_exception("Geometry type different than file type"));
+        }
+
+        char const* const content = record_content(index);
+        boost::int32_t const length = record_length(index);
+        if (detail::shapefile::load_little<boost::int32_t>(content)
+                == detail::shapefile::shape_type::null_shape)
+        {
+            return;
+        }
+
+        detail::shapefile::memory_stream is(content, content + length);
+        reader_type::apply(is, output, m_type, strategy);
+    }
+
+    template <typename RangeOfGeometries>
+    inline void read(std::size_t index, RangeOfGeometries& output) const
+    {
+        read(index, output, default_strategy<RangeOfGeometries>());
+    }
+
+    /*!
+    \brief Reads the geometries of the records with the specified indexes,
+        in that order, using thread_count threads
+    \details The indexes are divided into blocks, each thread decoding its
+        own block into its own range, which are appended to the output.
+        If an exception is thrown the output is not changed.
+    */
+    template <typename Indexes, typename RangeOfGeometries, typename Strategy>
+    inline void read_records(Indexes const& indexes, RangeOfGeometries& output,
+                             std::size_t thread_count, Strategy const& strategy) const
+    {
+        std::vector<std::size_t> const list(boost::begin(indexes), boost::end(indexes));
+        if (thread_count < 1)
+        {
+            thread_count = 1;
+        }
+        std::size_t const block_count = (std::min)(thread_count, list.size());
+        if (block_count == 0)
+        {
+            return;
+        }
+
+        std::size_t const block_size = (list.size() + block_count - 1) / block_count;
+        std::vector<RangeOfGeometries> blocks(block_count);
+        detail::parallel_for(block_count, thread_count, [&](std::size_t b)
+        {
+            std::size_t const first = b * block_size;
+            std::size_t const last = (std::min)(first + block_size, list.size());
+            for (std::size_t i = first; i < last; i++)
+            {
+                read(list[i], blocks[b], strategy);
+            }
+        });
+
+        for (RangeOfGeometries& block : blocks)
+        {
+            for (auto& geometry : block)
+            {
+                range::push_back(output, std::move(geometry));
+            }
+        }
+    }
+
+    template <typename Indexes, typename RangeOfGeometries>
+    inline void read_records(Indexes const& indexes, RangeOfGeometries& output,
+                             std::size_t thread_count = 1) const
+    {
+        read_records(indexes, output, thread_count, default_strategy<RangeOfGeometries>());
+    }
+
+    //! Reads all records, using thread_count threads
+    template <typename RangeOfGeometries>
+    inline void read_all(RangeOfGeometries& output, std::size_t thread_count = 1) const
+    {
+        std::vector<std::size_t> indexes(m_count);
+        for (std::size_t i = 0; i < m_count; i++)
+        {
+            indexes[i] = i;
+        }
+        read_records(indexes, output, thread_count);
+    }
+
+private :
+
+    struct record_box
+    {
+        bool empty;
+        double min_x, min_y, max_x, max_y;
+    };
+
+    template <typename RangeOfGeometries>
+    static inline typename strategies::io::services::default_strategy
+        <
+            typename boost::range_value<RangeOfGeometries>::type
+        >::type default_strategy()
+    {
+        return typename strategies::io::services::default_strategy
+            <
+                typename boost::range_value<RangeOfGeometries>::type
+            >::type();
+    }
+
+    static inline bool is_point_type(boost::int32_t type)
+    {
+        return type == detail::shapefile::shape_type::point
+            || type == detail::shapefile::shape_type::point_m
+            || type == detail::shapefile::shape_type::point_z;
+    }
+
+    static inline char const* header_bytes(interprocess::mapped_region const& region)
+    {
+        return static_cast<char const*>(region.get_address());
+    }
+
+    template <typename Box>
+    static inline void set_box(Box& box, double min_x, double min_y,
+                               double max_x, double max_y)
+    {
+        typedef typename coordinate_type<Box>::type ct;
+        geometry::set<min_corner, 0>(box, ct(min_x));
+        geometry::set<min_corner, 1>(box, ct(min_y));
+        geometry::set<max_corner, 0>(box, ct(max_x));
+        geometry::set<max_corner, 1>(box, ct(max_y));
+    }
+
+    // Assigns min x, min y, max x, max y stored in little endian
+    template <typename Box>
+    static inline void assign_box(char const* bytes, Box& box)
+    {
+        namespace shp = detail::shapefile;
+        set_box(box, shp::load_little<double>(bytes), shp::load_little<double>(bytes + 8),
+                shp::load_little<double>(bytes + 16), shp::load_little<double>(bytes + 24));
+    }
+
+    inline record_box stored_box(std::size_t index) const
+    {
+        namespace shp = detail::shapefile;
+        char const* const content = record_content(index);
+        boost::int32_t const type = shp::load_little<boost::int32_t>(content);
+        record_box result = { type == shp::shape_type::null_shape, 0, 0, 0, 0 };
+        if (result.empty)
+        {
+            return result;
+        }
+
+        if (is_point_type(type))
+        {
+            result.min_x = result.max_x = shp::load_little<double>(content + 4);
+            result.min_y = result.max_y = shp::load_little<double>(content + 12);
+        }
+        else
+        {
+            result.min_x = shp::load_little<double>(content + 4);
+            result.min_y = shp::load_little<double>(content + 12);
+            result.max_x = shp::load_little<double>(content + 20);
+            result.max_y = shp::load_little<double>(content + 28);
+        }
+        return result;
+    }
+
+    // Record content (after its header), checked when the file was opened
+    inline char const* record_content(std::size_t index) const
+    {
+        char const* const index_record = header_bytes(m_shx) + 100 + index * 8;
+        boost::int32_t const offset
+            = detail::shapefile::load_big<boost::int32_t>(index_record);
+        return header_bytes(m_shp) + std::size_t(offset) * 2 + 8;
+    }
+
+    inline boost::int32_t record_length(std::size_t index) const
+    {
+        char const* const index_record = header_bytes(m_shx) + 100 + index * 8;
+        return detail::shapefile::load_big<boost::int32_t>(index_record + 4) * 2;
+    }
+
+    static inline void map(std::string const& path,
+                           interprocess::file_mapping& file,
+                           interprocess::mapped_region& region)
+    {
+        try
+        {
+            interprocess::file_mapping(path.c_str(), interprocess::read_only).swap(file);
+            interprocess::mapped_region(file, interprocess::read_only).swap(region);
+        }
+        catch (interprocess::interprocess_exception const& )
+        {
+            BOOST_THROW_EXCEPTION(read_shapefile_exception("Unable to map " + path));
+        }
+        if (region.get_size() < 100
+            || detail::shapefile::load_big<boost::int32_t>(header_bytes(region)) != 9994)
+        {
+            BOOST_THROW_EXCEPTION(read_shapefile_exception("Invalid header code"));
+        }
+    }
+
+    inline void open(std::string const& shp_path, std::string const& shx_path)
+    {
+        namespace shp = detail::shapefile;
+
+        shp::double_endianness_check();
+
+        map(shp_path, m_shp_file, m_shp);
+        map(shx_path, m_shx_file, m_shx);
+
+        m_type = shp::load_little<boost::int32_t>(header_bytes(m_shp) + 32);
+        m_count = (m_shx.get_size() - 100) / 8;
+
+        // Check all records once, so they can be accessed without checks
+        std::size_t const shp_size = m_shp.get_size();
+        for (std::size_t i = 0; i < m_count; i++)
+        {
+            char const* const index_record = header_bytes(m_shx) + 100 + i * 8;
+            boost::int32_t const offset = shp::load_big<boost::int32_t>(index_record);
+            boost::int32_t const length = shp::load_big<boost::int32_t>(index_record + 4);
+            if (offset < 50 || length < 2
+                || std::size_t(offset) * 2 + 8 + std::size_t(length) * 2 > shp_size)
+            {
+                BOOST_THROW_EXCEPTION(read_shapefile_exception("Invalid record offset or length"));
+            }
+
+            boost::int32_t const type = shp::load_little<boost::int32_t>(record_content(i));
+            std::size_t const required = type == shp::shape_type::null_shape ? 4
+                                       : is_point_type(type) ? 20
+                                       : 36;
+            if (std::size_t(length) * 2 < required
+                || (type != shp::shape_type::null_shape && type != m_type))
+            {
+                BOOST_THROW_EXCEPTION(read_shapefile_exception("Invalid record"));
+            }
+        }
+    }
+
+    interprocess::file_mapping m_shp_file;
+    interprocess::file_mapping m_shx_file;
+    interprocess::mapped_region m_shp;
+    interprocess::mapped_region m_shx;
+    boost::int32_t m_type;
+    std::size_t m_count;
+};
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_GIS_IO_SHAPEFILE_READER_HPP
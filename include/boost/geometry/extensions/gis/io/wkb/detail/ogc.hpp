@@ -9,8 +9,18 @@
 #ifndef BOOST_GEOMETRY_IO_WKB_DETAIL_OGC_HPP
 #define BOOST_GEOMETRY_IO_WKB_DETAIL_OGC_HPP
 
+#include <type_traits>
+
 #include <boost/cstdint.hpp>
 
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/geometry_types.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/util/sequence.hpp>
+#include <boost/geometry/algorithms/not_implemented.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/detail/endian.hpp>
+
 namespace boost { namespace geometry
 {
 
@@ -40,6 +50,10 @@ namespace boost { namespace geometry
 //   wkbMultiPolygon = 6,
 //   wkbGeometryCollection = 7
 // };
+//
+// Geometries with Z and/or M coordinates are supported in two flavours:
+// ISO WKB adds 1000, 2000 or 3000 to the type, PostGIS EWKB sets the high
+// bits of the type and may be followed by the SRID (uint32).
 
 #ifndef DOXYGEN_NO_DETAIL
 namespace detail { namespace wkb
@@ -62,6 +76,13 @@ struct byte_order_type
     };
 };
 
+inline byte_order_type::enum_t native_byte_order()
+{
+    return std::is_same<endian::native_endian_tag, endian::big_endian_tag>::value
+         ? byte_order_type::xdr
+         : byte_order_type::ndr;
+}
+
 struct geometry_type_ogc
 {
     enum enum_t
@@ -72,7 +93,19 @@ struct geometry_type_ogc
         multipoint = 4,
         multilinestring = 5,
         multipolygon = 6,
-        //collection = 7
+        collection = 7
+    };
+};
+
+// Flags of the geometry type in PostGIS extended WKB (EWKB), ISO WKB encodes
+// Z and M by adding 1000 (Z), 2000 (M) or 3000 (ZM) to the type instead
+struct geometry_type_ewkb_flags
+{
+    enum enum_t
+    {
+        z    = 0x80000000,
+        m    = 0x40000000,
+        srid = 0x20000000
     };
 };
 
@@ -122,6 +155,16 @@ struct geometry_type_impl
     {
         return OgcType;
     }
+
+    static geometry_type_ogc::enum_t base()
+    {
+        return OgcType;
+    }
+
+    static bool has_z()
+    {
+        return false;
+    }
 };
 
 template
@@ -140,6 +183,16 @@ struct geometry_type_impl<Geometry, OgcType, 3>
     {
         return 1000 + OgcType;
     }
+
+    static geometry_type_ogc::enum_t base()
+    {
+        return OgcType;
+    }
+
+    static bool has_z()
+    {
+        return true;
+    }
 };
 
 template
@@ -182,6 +235,23 @@ struct geometry_type<Geometry, CheckPolicy, multi_polygon_tag>
     : geometry_type_impl<Geometry, geometry_type_ogc::multipolygon>
 {};
 
+// The dimension of the first type of the collection is used,
+// as the dimension of the collection itself is not defined
+template <typename Geometry, typename CheckPolicy>
+struct geometry_type<Geometry, CheckPolicy, geometry_collection_tag>
+    : geometry_type_impl
+        <
+            Geometry, geometry_type_ogc::collection,
+            dimension
+                <
+                    typename util::sequence_front
+                        <
+                            typename traits::geometry_types<Geometry>::type
+                        >::type
+                >::value
+        >
+{};
+
 }} // namespace detail::wkb
 #endif // DOXYGEN_NO_IMPL
 
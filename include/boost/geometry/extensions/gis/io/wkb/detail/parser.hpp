@@ -16,14 +16,20 @@
 #include <algorithm>
 #include <cassert>
 #include <cstddef>
+#include <cstring>
 #include <iterator>
 #include <limits>
+#include <memory>
 #include <type_traits>
+#include <vector>
 
 #include <boost/geometry/core/exception.hpp>
 
 #include <boost/concept_check.hpp>
 #include <boost/cstdint.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
 #include <boost/static_assert.hpp>
 
 #include <boost/geometry/core/access.hpp>
@@ -32,8 +38,13 @@
 #include <boost/geometry/core/coordinate_type.hpp>
 #include <boost/geometry/core/exterior_ring.hpp>
 #include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/ring_type.hpp>
 #include <boost/geometry/extensions/gis/io/wkb/detail/endian.hpp>
 #include <boost/geometry/extensions/gis/io/wkb/detail/ogc.hpp>
+#include <boost/geometry/geometries/point.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/util/range.hpp>
 
 namespace boost { namespace geometry
 {
@@ -79,30 +90,62 @@ struct value_parser
         diff_type const required_size = sizeof(T);
         if (it != end && std::distance(it, end) >= required_size)
         {
-            typedef endian::endian_value<T> parsed_value_type;
-            parsed_value_type parsed_value;
-
-            // Decide on direcion of endianness translation, detault to native
-            if (byte_order_type::xdr == order)
-            {
-                parsed_value.template load<endian::big_endian_tag>(it);
-            }
-            else if (byte_order_type::ndr == order)
-            {
-                parsed_value.template load<endian::little_endian_tag>(it);
-            }
-            else
-            {
-                parsed_value.template load<endian::native_endian_tag>(it);
-            }
-
-            value = parsed_value;
-            std::advance(it, required_size);
+            load(it, value, order);
             return true;
         }
 
         return false;
     }
+
+    // Reads the value, the caller has to check that enough bytes are left
+    template <typename Iterator>
+    static inline void load(Iterator& it, T& value, byte_order_type::enum_t order)
+    {
+        load(it, value, order, std::is_pointer<Iterator>());
+    }
+
+private :
+
+    // Bytes in memory in the native byte order are copied
+    template <typename Iterator>
+    static inline void load(Iterator& it, T& value, byte_order_type::enum_t order,
+                            std::true_type)
+    {
+        if (order == native_byte_order())
+        {
+            std::memcpy(&value, it, sizeof(T));
+            it += sizeof(T);
+        }
+        else
+        {
+            load(it, value, order, std::false_type());
+        }
+    }
+
+    template <typename Iterator>
+    static inline void load(Iterator& it, T& value, byte_order_type::enum_t order,
+                            std::false_type)
+    {
+        typedef endian::endian_value<T> parsed_value_type;
+        parsed_value_type parsed_value;
+
+        // Decide on direcion of endianness translation, detault to native
+        if (byte_order_type::xdr == order)
+        {
+            parsed_value.template load<endian::big_endian_tag>(it);
+        }
+        else if (byte_order_type::ndr == order)
+        {
+            parsed_value.template load<endian::little_endian_tag>(it);
+        }
+        else
+        {
+            parsed_value.template load<endian::native_endian_tag>(it);
+        }
+
+        value = parsed_value;
+        std::advance(it, sizeof(T));
+    }
 };
 
 struct byte_order_parser
@@ -125,130 +168,269 @@ struct byte_order_parser
     }
 };
 
-template <typename Geometry>
-struct geometry_type_parser
+/*!
+\brief Internal, the header of a (sub)geometry: byte order, type and SRID
+\details The type is decoded from ISO WKB (1000 + type for Z, etc.) as well
+    as from PostGIS EWKB (flags in the high bits).
+*/
+struct geometry_header
 {
-    template <typename Iterator>
-    static bool parse(Iterator& it, Iterator end, 
-                byte_order_type::enum_t order)
+    geometry_header()
+        : order(byte_order_type::unknown)
+        , type(0)
+        , has_z(false)
+        , has_m(false)
+        , has_srid(false)
+        , srid(0)
+    {}
+
+    // Number of coordinates (doubles) of each point
+    inline std::size_t coordinate_count() const
     {
-        boost::uint32_t value;
-        if (value_parser<boost::uint32_t>::parse(it, end, value, order))
-        {
-            return geometry_type<Geometry>::check(value);
-        }
-        return false;
+        return 2 + (has_z ? 1 : 0) + (has_m ? 1 : 0);
     }
+
+    byte_order_type::enum_t order;
+    boost::uint32_t type; // geometry_type_ogc
+    bool has_z;
+    bool has_m;
+    bool has_srid;
+    boost::uint32_t srid;
 };
 
-template <typename P,
-          std::size_t I = 0,
-          std::size_t N = dimension<P>::value>
-struct parsing_assigner
+struct header_parser
 {
     template <typename Iterator>
-    static void run(Iterator& it, Iterator end, P& point, 
-                byte_order_type::enum_t order)
+    static bool parse(Iterator& it, Iterator end, geometry_header& header)
     {
-        typedef typename coordinate_type<P>::type coordinate_type;
+        if (! byte_order_parser::parse(it, end, header.order)
+            || header.order == byte_order_type::unknown)
+        {
+            return false;
+        }
 
-        // coordinate type in WKB is always double
-        double value(0);
-        if (value_parser<double>::parse(it, end, value, order))
+        boost::uint32_t value(0);
+        if (! value_parser<boost::uint32_t>::parse(it, end, value, header.order))
         {
-            // actual coordinate type of point may be different
-            set<I>(point, static_cast<coordinate_type>(value));
+            return false;
         }
-        else
+
+        boost::uint32_t const flags = geometry_type_ewkb_flags::z
+                                    | geometry_type_ewkb_flags::m
+                                    | geometry_type_ewkb_flags::srid;
+        boost::uint32_t const code = value & ~flags;
+        boost::uint32_t const iso = code / 1000;
+        if (iso > 3)
         {
-            // TODO: mloskot - Report premature termination at coordinate level
-            //throw failed to read coordinate value
+            return false;
+        }
+
+        header.type = code % 1000;
+        header.has_z = (value & geometry_type_ewkb_flags::z) != 0 || iso == 1 || iso == 3;
+        header.has_m = (value & geometry_type_ewkb_flags::m) != 0 || iso == 2 || iso == 3;
+        header.has_srid = (value & geometry_type_ewkb_flags::srid) != 0;
+        header.srid = 0;
 
-            // default initialized value as fallback
-            set<I>(point, coordinate_type());
+        if (header.type < geometry_type_ogc::point
+            || header.type > geometry_type_ogc::collection)
+        {
+            return false;
         }
-        parsing_assigner<P, I+1, N>::run(it, end, point, order);
+
+        return ! header.has_srid
+            || value_parser<boost::uint32_t>::parse(it, end, header.srid, header.order);
     }
 };
 
-template <typename P, std::size_t N>
-struct parsing_assigner<P, N, N>
+// Assigns x, y, z and m, read from WKB, to the coordinates of the point
+template
+<
+    typename Point,
+    std::size_t I = 0,
+    std::size_t N = dimension<Point>::value
+>
+struct parsing_assigner
 {
-    template <typename Iterator>
-    static void run(Iterator& /*it*/, Iterator /*end*/, P& /*point*/,
-                byte_order_type::enum_t /*order*/)
+    static inline void run(Point& point, double const* values)
+    {
+        typedef typename coordinate_type<Point>::type coordinate_type;
+
+        // actual coordinate type of point may be different
+        set<I>(point, I < 4
+                      ? static_cast<coordinate_type>(values[I < 4 ? I : 0])
+                      : coordinate_type());
+
+        parsing_assigner<Point, I + 1, N>::run(point, values);
+    }
+};
+
+template <typename Point, std::size_t N>
+struct parsing_assigner<Point, N, N>
+{
+    static inline void run(Point& , double const* )
     {
         // terminate
     }
 };
 
+template <typename Point>
+struct coordinates_parser
+{
+    // Reads the coordinates of one point, the caller has to check that
+    // enough bytes are left. Z and M are only assigned if the point has a
+    // third and fourth dimension, missing coordinates are set to zero.
+    template <typename Iterator>
+    static inline void load(Iterator& it, Point& point, geometry_header const& header)
+    {
+        // coordinate type in WKB is always double
+        double values[4] = { 0.0, 0.0, 0.0, 0.0 };
+        value_parser<double>::load(it, values[0], header.order);
+        value_parser<double>::load(it, values[1], header.order);
+        if (header.has_z)
+        {
+            value_parser<double>::load(it, values[2], header.order);
+        }
+        if (header.has_m)
+        {
+            value_parser<double>::load(it, values[3], header.order);
+        }
+        parsing_assigner<Point>::run(point, values);
+    }
+};
+
 template <typename P>
 struct point_parser
 {
     template <typename Iterator>
-    static bool parse(Iterator& it, Iterator end, P& point, 
-                byte_order_type::enum_t order)
+    static bool parse(Iterator& it, Iterator end, P& point,
+                geometry_header const& header)
     {
-        if (geometry_type_parser<P>::parse(it, end, order))
+        typedef typename std::iterator_traits<Iterator>::difference_type size_type;
+        size_type const point_size = header.coordinate_count() * sizeof(double);
+        if (std::distance(it, end) < point_size)
         {
-            if (it != end)
-            {
-                parsing_assigner<P>::run(it, end, point, order);
-            }
-            return true;
+            return false;
         }
-        return false;
+
+        coordinates_parser<P>::load(it, point, header);
+        return true;
     }
 };
 
+// Points stored as an array of doubles, having the layout of WKB coordinates
+template <typename Point>
+struct is_double_array_point
+    : std::false_type
+{};
+
+template <std::size_t DimensionCount, typename CoordinateSystem>
+struct is_double_array_point<model::point<double, DimensionCount, CoordinateSystem> >
+    : std::integral_constant
+        <
+            bool,
+            sizeof(model::point<double, DimensionCount, CoordinateSystem>)
+                == DimensionCount * sizeof(double)
+        >
+{};
+
+template <typename CoordinateSystem>
+struct is_double_array_point<model::d2::point_xy<double, CoordinateSystem> >
+    : std::integral_constant
+        <
+            bool,
+            sizeof(model::d2::point_xy<double, CoordinateSystem>) == 2 * sizeof(double)
+        >
+{};
+
+// Ranges of which the points are stored contiguously
+template <typename Range>
+struct is_contiguous_range
+{
+    typedef typename boost::range_value<Range>::type value_type;
+    typedef typename boost::range_iterator<Range>::type iterator_type;
+
+    static const bool value = std::is_pointer<iterator_type>::value
+        || std::is_same<iterator_type, typename std::vector<value_type>::iterator>::value;
+};
+
+template <typename Range>
+inline auto reserve_points(Range& range, std::size_t count, int)
+    -> decltype(range.reserve(count), void())
+{
+    range.reserve(boost::size(range) + count);
+}
+
+template <typename Range>
+inline void reserve_points(Range& , std::size_t , long)
+{}
+
 template <typename C>
 struct point_container_parser
 {
     template <typename Iterator>
-    static bool parse(Iterator& it, Iterator end, C& container, 
-                byte_order_type::enum_t order)
+    static bool parse(Iterator& it, Iterator end, C& container,
+                geometry_header const& header)
     {
-        typedef typename point_type<C>::type point_type;
-
         boost::uint32_t num_points(0);
-        if (!value_parser<boost::uint32_t>::parse(it, end, num_points, order))
+        if (!value_parser<boost::uint32_t>::parse(it, end, num_points, header.order))
         {
             return false;
         }
-        
+
         typedef typename std::iterator_traits<Iterator>::difference_type size_type;
-        if(num_points > (std::numeric_limits<boost::uint32_t>::max)() )
+        size_type const point_size = header.coordinate_count() * sizeof(double);
+
+        // Divided, to avoid overflow for corrupt numbers of points
+        if (std::distance(it, end) / point_size < static_cast<size_type>(num_points))
         {
-            throw boost::geometry::read_wkb_exception();
+            return false;
         }
 
-        size_type const container_size = static_cast<size_type>(num_points);
-        size_type const point_size = dimension<point_type>::value * sizeof(double);
+        typedef typename point_type<C>::type point_type;
+        static const bool can_copy = std::is_pointer<Iterator>::value
+            && is_double_array_point<point_type>::value
+            && is_contiguous_range<C>::value;
 
-        if (std::distance(it, end) >= (container_size * point_size))
-        {
-            point_type point_buffer;
+        load(it, container, num_points, header, std::integral_constant<bool, can_copy>());
+        return true;
+    }
 
-            // Read coordinates into point and append point to line (ring)
-            size_type points_parsed = 0;
-            while (points_parsed < container_size && it != end)
-            {
-                parsing_assigner<point_type>::run(it, end, point_buffer, order);
-                boost::geometry::append(container, point_buffer);
-                ++points_parsed;
-            }
+private :
 
-            if (container_size != points_parsed)
-            {
-                return false;
-            }
-        }
-        else
+    // The coordinates are copied at once if they have the same layout
+    // and byte order in WKB and in memory
+    template <typename Iterator>
+    static inline void load(Iterator& it, C& container, std::size_t num_points,
+                            geometry_header const& header, std::true_type)
+    {
+        typedef typename point_type<C>::type point_type;
+        if (header.order != native_byte_order()
+            || header.coordinate_count() != dimension<point_type>::value
+            || num_points == 0)
         {
-            return false;
+            load(it, container, num_points, header, std::false_type());
+            return;
         }
 
-        return true;
+        std::size_t const offset = boost::size(container);
+        std::size_t const byte_count = num_points * sizeof(point_type);
+        range::resize(container, offset + num_points);
+        std::memcpy(std::addressof(range::at(container, offset)), it, byte_count);
+        it += byte_count;
+    }
+
+    template <typename Iterator>
+    static inline void load(Iterator& it, C& container, std::size_t num_points,
+                            geometry_header const& header, std::false_type)
+    {
+        reserve_points(container, num_points, 0);
+
+        typename point_type<C>::type point_buffer;
+        for (std::size_t i = 0; i < num_points; i++)
+        {
+            coordinates_parser<typename point_type<C>::type>::load(it, point_buffer, header);
+            range::push_back(container, point_buffer);
+        }
     }
 };
 
@@ -256,20 +438,10 @@ template <typename L>
 struct linestring_parser
 {
     template <typename Iterator>
-    static bool parse(Iterator& it, Iterator end, L& linestring, 
-                byte_order_type::enum_t order)
+    static bool parse(Iterator& it, Iterator end, L& linestring,
+                geometry_header const& header)
     {
-        if (!geometry_type_parser<L>::parse(it, end, order))
-        {
-            return false;
-        }
-
-        if(it == end)
-        {
-            throw boost::geometry::read_wkb_exception();
-        }
-        
-        return point_container_parser<L>::parse(it, end, linestring, order);
+        return point_container_parser<L>::parse(it, end, linestring, header);
     }
 };
 
@@ -277,29 +449,23 @@ template <typename Polygon>
 struct polygon_parser
 {
     template <typename Iterator>
-    static bool parse(Iterator& it, Iterator end, Polygon& polygon, 
-                byte_order_type::enum_t order)
+    static bool parse(Iterator& it, Iterator end, Polygon& polygon,
+                geometry_header const& header)
     {
-        if (!geometry_type_parser<Polygon>::parse(it, end, order))
-        {
-            return false;
-        }
-
         boost::uint32_t num_rings(0);
-        if (!value_parser<boost::uint32_t>::parse(it, end, num_rings, order))
+        if (!value_parser<boost::uint32_t>::parse(it, end, num_rings, header.order))
         {
             return false;
         }
-        
-        typedef typename boost::geometry::ring_return_type<Polygon>::type ring_type;
 
-        std::size_t rings_parsed = 0;
-        while (rings_parsed < num_rings && it != end)
+        typedef typename boost::geometry::ring_type<Polygon>::type ring_type;
+
+        for (std::size_t rings_parsed = 0; rings_parsed < num_rings; ++rings_parsed)
         {
             if (0 == rings_parsed)
             {
-                ring_type ring0 = exterior_ring(polygon);
-                if (!point_container_parser<ring_type>::parse(it, end, ring0, order))
+                if (!point_container_parser<ring_type>::parse(it, end,
+                        exterior_ring(polygon), header))
                 {
                     return false;
                 }
@@ -307,21 +473,91 @@ struct polygon_parser
             else
             {
                 boost::geometry::range::resize(interior_rings(polygon), rings_parsed);
-                ring_type ringN = boost::geometry::range::back(interior_rings(polygon));
-                
-                if (!point_container_parser<ring_type>::parse(it, end, ringN, order))
+                if (!point_container_parser<ring_type>::parse(it, end,
+                        boost::geometry::range::back(interior_rings(polygon)), header))
                 {
                     return false;
                 }
             }
+        }
+
+        return true;
+    }
+};
+
+// Parses the members of a multi geometry, each with their own header
+template <typename MultiGeometry, typename Parser>
+struct multi_parser
+{
+    template <typename Iterator>
+    static bool parse(Iterator& it, Iterator end, MultiGeometry& multi,
+                geometry_header const& header)
+    {
+        typedef typename boost::range_value<MultiGeometry>::type item_type;
 
-            ++rings_parsed;
+        boost::uint32_t count(0);
+        if (!value_parser<boost::uint32_t>::parse(it, end, count, header.order))
+        {
+            return false;
+        }
+
+        // Each member has at least a header (byte order and type), do not
+        // allocate for corrupt counts
+        typedef typename std::iterator_traits<Iterator>::difference_type size_type;
+        if (std::distance(it, end) / 5 < static_cast<size_type>(count))
+        {
+            return false;
+        }
+
+        reserve_points(multi, count, 0);
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            geometry_header item_header;
+            if (!header_parser::parse(it, end, item_header)
+                || item_header.type != geometry_type<item_type>::base())
+            {
+                return false;
+            }
+
+            boost::geometry::range::resize(multi, boost::size(multi) + 1);
+            if (!Parser::parse(it, end, boost::geometry::range::back(multi), item_header))
+            {
+                return false;
+            }
         }
 
         return true;
     }
 };
 
+template <typename MultiPoint>
+struct multipoint_parser
+    : multi_parser
+        <
+            MultiPoint,
+            point_parser<typename boost::range_value<MultiPoint>::type>
+        >
+{};
+
+template <typename MultiLinestring>
+struct multilinestring_parser
+    : multi_parser
+        <
+            MultiLinestring,
+            linestring_parser<typename boost::range_value<MultiLinestring>::type>
+        >
+{};
+
+template <typename MultiPolygon>
+struct multipolygon_parser
+    : multi_parser
+        <
+            MultiPolygon,
+            polygon_parser<typename boost::range_value<MultiPolygon>::type>
+        >
+{};
+
 }} // namespace detail::wkb
 #endif // DOXYGEN_NO_IMPL
 
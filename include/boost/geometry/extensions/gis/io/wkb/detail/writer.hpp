@@ -24,6 +24,7 @@
 #include <boost/range/begin.hpp>
 #include <boost/range/end.hpp>
 #include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
 #include <boost/static_assert.hpp>
 
 #include <boost/geometry/core/access.hpp>
@@ -105,56 +106,120 @@ namespace detail { namespace wkb
         }
     };
 
-    template <typename Point>
-    struct point_writer
+    /*!
+    \brief Internal, options of the header of a (sub)geometry
+    \details ISO WKB writes Z by adding 1000 to the type, EWKB sets a flag
+        and can be followed by the SRID, which is only written for the
+        top-level geometry
+    */
+    struct write_options
+    {
+        write_options(byte_order_type::enum_t order,
+                      bool extended = false,
+                      boost::uint32_t srid = 0)
+            : byte_order(order)
+            , extended(extended)
+            , srid(srid)
+        {}
+
+        // Options of the members of a multi geometry or collection
+        inline write_options nested() const
+        {
+            return write_options(byte_order, extended, 0);
+        }
+
+        byte_order_type::enum_t byte_order;
+        bool extended;
+        boost::uint32_t srid;
+    };
+
+    template <typename Geometry>
+    struct header_writer
     {
         template <typename OutputIterator>
-        static bool write(Point const& point,
-                          OutputIterator& iter,
-                          byte_order_type::enum_t byte_order)
+        static void write(OutputIterator& iter, write_options const& options)
         {
+            typedef geometry_type<Geometry> type;
+
             // write endian type
-            value_writer<uint8_t>::write(byte_order, iter, byte_order);
+            value_writer<uint8_t>::write(options.byte_order, iter, options.byte_order);
 
             // write geometry type
-            uint32_t type = geometry_type<Point>::get();
-            value_writer<uint32_t>::write(type, iter, byte_order);
-
-            // write point's x, y, z
-            writer_assigner<Point>::run(point, iter, byte_order);
+            uint32_t code = type::get();
+            bool const has_srid = options.extended && options.srid != 0;
+            if (options.extended)
+            {
+                code = type::base();
+                if (type::has_z())
+                {
+                    code |= geometry_type_ewkb_flags::z;
+                }
+                if (has_srid)
+                {
+                    code |= geometry_type_ewkb_flags::srid;
+                }
+            }
+            value_writer<uint32_t>::write(code, iter, options.byte_order);
 
-            return true;
+            if (has_srid)
+            {
+                value_writer<uint32_t>::write(options.srid, iter, options.byte_order);
+            }
         }
     };
 
-    template <typename Linestring>
-    struct linestring_writer
+    template <typename Range>
+    struct points_writer
     {
         template <typename OutputIterator>
-        static bool write(Linestring const& linestring,
+        static void write(Range const& range,
                           OutputIterator& iter,
                           byte_order_type::enum_t byte_order)
         {
-            // write endian type
-            value_writer<uint8_t>::write(byte_order, iter, byte_order);
-
-            // write geometry type
-            uint32_t type = geometry_type<Linestring>::get();
-            value_writer<uint32_t>::write(type, iter, byte_order);
-
             // write num points
-            uint32_t num_points = boost::size(linestring);
+            uint32_t num_points = boost::size(range);
             value_writer<uint32_t>::write(num_points, iter, byte_order);
 
-            for(typename boost::range_iterator<Linestring const>::type
-                    point_iter = boost::begin(linestring);
-                point_iter != boost::end(linestring);
+            for(typename boost::range_iterator<Range const>::type
+                    point_iter = boost::begin(range);
+                point_iter != boost::end(range);
                 ++point_iter)
             {
                 // write point's x, y, z
-                writer_assigner<typename point_type<Linestring>::type>
+                writer_assigner<typename point_type<Range>::type>
                     ::run(*point_iter, iter, byte_order);
             }
+        }
+    };
+
+    template <typename Point>
+    struct point_writer
+    {
+        template <typename OutputIterator>
+        static bool write(Point const& point,
+                          OutputIterator& iter,
+                          write_options const& options)
+        {
+            header_writer<Point>::write(iter, options);
+
+            // write point's x, y, z
+            writer_assigner<Point>::run(point, iter, options.byte_order);
+
+            return true;
+        }
+    };
+
+    template <typename Linestring>
+    struct linestring_writer
+    {
+        template <typename OutputIterator>
+        static bool write(Linestring const& linestring,
+                          OutputIterator& iter,
+                          write_options const& options)
+        {
+            header_writer<Linestring>::write(iter, options);
+
+            points_writer<Linestring>::write(linestring, iter, options.byte_order);
 
             return true;
         }
@@ -166,39 +231,21 @@ namespace detail { namespace wkb
         template <typename OutputIterator>
         static bool write(Polygon const& polygon,
                           OutputIterator& iter,
-                          byte_order_type::enum_t byte_order)
+                          write_options const& options)
         {
-            // write endian type
-            value_writer<uint8_t>::write(byte_order, iter, byte_order);
-
-            // write geometry type
-            uint32_t type = geometry_type<Polygon>::get();
-            value_writer<uint32_t>::write(type, iter, byte_order);
+            header_writer<Polygon>::write(iter, options);
 
             // write num rings
             uint32_t num_rings = 1 + geometry::num_interior_rings(polygon);
-            value_writer<uint32_t>::write(num_rings, iter, byte_order);
+            value_writer<uint32_t>::write(num_rings, iter, options.byte_order);
 
-            // write exterior ring
             typedef typename geometry::ring_type<Polygon const>::type
                 ring_type;
 
-            typename geometry::ring_return_type<Polygon const>::type
-                exterior_ring = geometry::exterior_ring(polygon);
-
-            value_writer<uint32_t>::write(geometry::num_points(exterior_ring),
-                                          iter,
-                                          byte_order);
-
-            for(typename boost::range_iterator<ring_type const>::type
-                    point_iter = boost::begin(exterior_ring);
-                point_iter != boost::end(exterior_ring);
-                ++point_iter)
-            {
-                // write point's x, y, z
-                writer_assigner<typename point_type<Polygon>::type>
-                    ::run(*point_iter, iter, byte_order);
-            }
+            // write exterior ring
+            points_writer<ring_type>::write(geometry::exterior_ring(polygon),
+                                            iter,
+                                            options.byte_order);
 
             // write interor rings
             typedef typename geometry::interior_type<Polygon const>::type
@@ -212,25 +259,67 @@ namespace detail { namespace wkb
                 ring_iter != boost::end(interior_rings);
                 ++ring_iter)
             {
-                value_writer<uint32_t>::write(geometry::num_points(*ring_iter),
-                                              iter,
-                                              byte_order);
-
-                for(typename boost::range_iterator<ring_type const>::type
-                        point_iter = boost::begin(*ring_iter);
-                    point_iter != boost::end(*ring_iter); 
-                    ++point_iter)
-                {
-                    // write point's x, y, z
-                    writer_assigner<typename point_type<Polygon>::type>
-                        ::run(*point_iter, iter, byte_order);
-                }
+                points_writer<ring_type>::write(*ring_iter, iter, options.byte_order);
             }
 
             return true;
         }
     };
 
+    // Writes a multi geometry, of which each member has its own header
+    template <typename MultiGeometry, typename Writer>
+    struct multi_writer
+    {
+        template <typename OutputIterator>
+        static bool write(MultiGeometry const& multi,
+                          OutputIterator& iter,
+                          write_options const& options)
+        {
+            header_writer<MultiGeometry>::write(iter, options);
+
+            // write num geometries
+            uint32_t count = boost::size(multi);
+            value_writer<uint32_t>::write(count, iter, options.byte_order);
+
+            for(typename boost::range_iterator<MultiGeometry const>::type
+                    it = boost::begin(multi);
+                it != boost::end(multi);
+                ++it)
+            {
+                Writer::write(*it, iter, options.nested());
+            }
+
+            return true;
+        }
+    };
+
+    template <typename MultiPoint>
+    struct multipoint_writer
+        : multi_writer
+            <
+                MultiPoint,
+                point_writer<typename boost::range_value<MultiPoint>::type>
+            >
+    {};
+
+    template <typename MultiLinestring>
+    struct multilinestring_writer
+        : multi_writer
+            <
+                MultiLinestring,
+                linestring_writer<typename boost::range_value<MultiLinestring>::type>
+            >
+    {};
+
+    template <typename MultiPolygon>
+    struct multipolygon_writer
+        : multi_writer
+            <
+                MultiPolygon,
+                polygon_writer<typename boost::range_value<MultiPolygon>::type>
+            >
+    {};
+
 }} // namespace detail::wkb
 #endif // DOXYGEN_NO_IMPL
 
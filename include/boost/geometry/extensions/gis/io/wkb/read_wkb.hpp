@@ -15,11 +15,20 @@
 
 #include <iterator>
 #include <type_traits>
+#include <utility>
 
 #include <boost/static_assert.hpp>
 
+#include <boost/geometry/algorithms/clear.hpp>
+#include <boost/geometry/core/geometry_types.hpp>
+#include <boost/geometry/core/mutable_range.hpp>
+#include <boost/geometry/core/tag.hpp>
 #include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/core/visit.hpp>
 #include <boost/geometry/extensions/gis/io/wkb/detail/parser.hpp>
+#include <boost/geometry/util/range.hpp>
+#include <boost/geometry/util/sequence.hpp>
+#include <boost/geometry/util/type_traits.hpp>
 
 namespace boost { namespace geometry
 {
@@ -36,9 +45,9 @@ struct read_wkb<point_tag, Geometry>
 {
     template <typename Iterator>
     static inline bool parse(Iterator& it, Iterator end, Geometry& geometry,
-        detail::wkb::byte_order_type::enum_t order)
+        detail::wkb::geometry_header const& header)
     {
-        return detail::wkb::point_parser<Geometry>::parse(it, end, geometry, order);
+        return detail::wkb::point_parser<Geometry>::parse(it, end, geometry, header);
     }
 };
 
@@ -47,10 +56,10 @@ struct read_wkb<linestring_tag, Geometry>
 {
     template <typename Iterator>
     static inline bool parse(Iterator& it, Iterator end, Geometry& geometry,
-        detail::wkb::byte_order_type::enum_t order)
+        detail::wkb::geometry_header const& header)
     {
         geometry::clear(geometry);
-        return detail::wkb::linestring_parser<Geometry>::parse(it, end, geometry, order);
+        return detail::wkb::linestring_parser<Geometry>::parse(it, end, geometry, header);
     }
 };
 
@@ -59,10 +68,46 @@ struct read_wkb<polygon_tag, Geometry>
 {
     template <typename Iterator>
     static inline bool parse(Iterator& it, Iterator end, Geometry& geometry,
-        detail::wkb::byte_order_type::enum_t order)
+        detail::wkb::geometry_header const& header)
     {
         geometry::clear(geometry);
-        return detail::wkb::polygon_parser<Geometry>::parse(it, end, geometry, order);
+        return detail::wkb::polygon_parser<Geometry>::parse(it, end, geometry, header);
+    }
+};
+
+template <typename Geometry>
+struct read_wkb<multi_point_tag, Geometry>
+{
+    template <typename Iterator>
+    static inline bool parse(Iterator& it, Iterator end, Geometry& geometry,
+        detail::wkb::geometry_header const& header)
+    {
+        geometry::clear(geometry);
+        return detail::wkb::multipoint_parser<Geometry>::parse(it, end, geometry, header);
+    }
+};
+
+template <typename Geometry>
+struct read_wkb<multi_linestring_tag, Geometry>
+{
+    template <typename Iterator>
+    static inline bool parse(Iterator& it, Iterator end, Geometry& geometry,
+        detail::wkb::geometry_header const& header)
+    {
+        geometry::clear(geometry);
+        return detail::wkb::multilinestring_parser<Geometry>::parse(it, end, geometry, header);
+    }
+};
+
+template <typename Geometry>
+struct read_wkb<multi_polygon_tag, Geometry>
+{
+    template <typename Iterator>
+    static inline bool parse(Iterator& it, Iterator end, Geometry& geometry,
+        detail::wkb::geometry_header const& header)
+    {
+        geometry::clear(geometry);
+        return detail::wkb::multipolygon_parser<Geometry>::parse(it, end, geometry, header);
     }
 };
 
@@ -70,8 +115,175 @@ struct read_wkb<polygon_tag, Geometry>
 #endif // DOXYGEN_NO_DISPATCH
 
 
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkb
+{
+
+// Parses a geometry of which the header is read, if its type matches
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct geometry_parser
+{
+    template <typename Iterator>
+    static inline bool parse(Iterator& it, Iterator end, Geometry& geometry,
+                             geometry_header const& header)
+    {
+        return header.type == geometry_type<Geometry>::base()
+            && dispatch::read_wkb<Tag, Geometry>::parse(it, end, geometry, header);
+    }
+};
+
+struct dynamic_move_assign
+{
+    template <typename DynamicGeometry, typename Geometry>
+    static void apply(DynamicGeometry& dynamic_geometry, Geometry& geometry)
+    {
+        dynamic_geometry = std::move(geometry);
+    }
+};
+
+struct dynamic_move_emplace_back
+{
+    template <typename GeometryCollection, typename Geometry>
+    static void apply(GeometryCollection& geometry_collection, Geometry& geometry)
+    {
+        traits::emplace_back<GeometryCollection>::apply(geometry_collection, std::move(geometry));
+    }
+};
+
+// Parses a geometry, of which the header is read, into one of the types
+// of a dynamic geometry or a geometry collection
+template <typename Geometry, typename AppendPolicy>
+struct dynamic_parser
+{
+    template <typename Iterator>
+    static inline bool parse(Iterator& it, Iterator end, Geometry& geometry,
+                             geometry_header const& header)
+    {
+        switch (header.type)
+        {
+            case geometry_type_ogc::point :
+                return parse<util::is_point>(it, end, geometry, header);
+            case geometry_type_ogc::linestring :
+                return parse<util::is_linestring>(it, end, geometry, header);
+            case geometry_type_ogc::polygon :
+                return parse<util::is_polygon>(it, end, geometry, header);
+            case geometry_type_ogc::multipoint :
+                return parse<util::is_multi_point>(it, end, geometry, header);
+            case geometry_type_ogc::multilinestring :
+                return parse<util::is_multi_linestring>(it, end, geometry, header);
+            case geometry_type_ogc::multipolygon :
+                return parse<util::is_multi_polygon>(it, end, geometry, header);
+            case geometry_type_ogc::collection :
+                return parse<util::is_geometry_collection>(it, end, geometry, header);
+        }
+        return false;
+    }
+
+private:
+    template
+    <
+        template <typename> class UnaryPred,
+        typename Iterator,
+        typename Geom = typename util::sequence_find_if
+            <
+                typename traits::geometry_types<Geometry>::type, UnaryPred
+            >::type,
+        std::enable_if_t<! std::is_void<Geom>::value, int> = 0
+    >
+    static inline bool parse(Iterator& it, Iterator end, Geometry& geometry,
+                             geometry_header const& header)
+    {
+        Geom g;
+        if (! dispatch::read_wkb<typename tag<Geom>::type, Geom>::parse(it, end, g, header))
+        {
+            return false;
+        }
+        AppendPolicy::apply(geometry, g);
+        return true;
+    }
+
+    // The geometry type can not be stored in this geometry
+    template
+    <
+        template <typename> class UnaryPred,
+        typename Iterator,
+        typename Geom = typename util::sequence_find_if
+            <
+                typename traits::geometry_types<Geometry>::type, UnaryPred
+            >::type,
+        std::enable_if_t<std::is_void<Geom>::value, int> = 0
+    >
+    static inline bool parse(Iterator& , Iterator , Geometry& , geometry_header const& )
+    {
+        return false;
+    }
+};
+
+template <typename Geometry>
+struct geometry_parser<Geometry, dynamic_geometry_tag>
+    : dynamic_parser<Geometry, dynamic_move_assign>
+{};
+
+}} // namespace detail::wkb
+#endif // DOXYGEN_NO_DETAIL
+
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace dispatch
+{
+
+template <typename Geometry>
+struct read_wkb<geometry_collection_tag, Geometry>
+{
+    template <typename Iterator>
+    static inline bool parse(Iterator& it, Iterator end, Geometry& geometry,
+        detail::wkb::geometry_header const& header)
+    {
+        range::clear(geometry);
+
+        boost::uint32_t count(0);
+        if (! detail::wkb::value_parser<boost::uint32_t>::parse(it, end, count, header.order))
+        {
+            return false;
+        }
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            detail::wkb::geometry_header item_header;
+            if (! detail::wkb::header_parser::parse(it, end, item_header)
+                || ! detail::wkb::dynamic_parser
+                    <
+                        Geometry, detail::wkb::dynamic_move_emplace_back
+                    >::parse(it, end, geometry, item_header))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+} // namespace dispatch
+#endif // DOXYGEN_NO_DISPATCH
+
+
+/*!
+\brief Reads a geometry from (E)WKB
+\ingroup wkb
+\details Reads OGC WKB, ISO WKB with Z, M or ZM coordinates and PostGIS EWKB,
+    optionally with an SRID. Z and M are assigned to the third and fourth
+    dimension, if the point type has them. For points of model::point<double>
+    stored in std::vector, coordinates are copied at once if the byte order
+    matches and the bytes are passed as pointers.
+\param begin begin of the bytes
+\param end end of the bytes
+\param geometry the geometry, of any type, including dynamic geometries and
+    geometry collections
+\param srid the SRID of EWKB, 0 if the WKB does not have one
+\return true if the WKB could be read
+*/
 template <typename Iterator, typename Geometry>
-inline bool read_wkb(Iterator begin, Iterator end, Geometry& geometry)
+inline bool read_wkb(Iterator begin, Iterator end, Geometry& geometry, boost::uint32_t& srid)
 {
     // Stream of bytes can only be parsed using random access iterator.
     BOOST_STATIC_ASSERT((
@@ -81,19 +293,23 @@ inline bool read_wkb(Iterator begin, Iterator end, Geometry& geometry)
             const std::random_access_iterator_tag&
         >::value));
 
-    detail::wkb::byte_order_type::enum_t byte_order;
-    if (detail::wkb::byte_order_parser::parse(begin, end, byte_order))
+    detail::wkb::geometry_header header;
+    if (detail::wkb::header_parser::parse(begin, end, header))
     {
-        return dispatch::read_wkb
-            <
-            typename tag<Geometry>::type,
-            Geometry
-            >::parse(begin, end, geometry, byte_order);
+        srid = header.srid;
+        return detail::wkb::geometry_parser<Geometry>::parse(begin, end, geometry, header);
     }
 
     return false;
 }
 
+template <typename Iterator, typename Geometry>
+inline bool read_wkb(Iterator begin, Iterator end, Geometry& geometry)
+{
+    boost::uint32_t srid = 0;
+    return read_wkb(begin, end, geometry, srid);
+}
+
 template <typename ByteType, typename Geometry>
 inline bool read_wkb(ByteType const* bytes, std::size_t length, Geometry& geometry)
 {
@@ -106,6 +322,19 @@ inline bool read_wkb(ByteType const* bytes, std::size_t length, Geometry& geomet
     return read_wkb(begin, end, geometry);
 }
 
+template <typename ByteType, typename Geometry>
+inline bool read_wkb(ByteType const* bytes, std::size_t length, Geometry& geometry,
+                     boost::uint32_t& srid)
+{
+    BOOST_STATIC_ASSERT((std::is_integral<ByteType>::value));
+    BOOST_STATIC_ASSERT((sizeof(boost::uint8_t) == sizeof(ByteType)));
+
+    ByteType const* begin = bytes;
+    ByteType const* const end = bytes + length;
+
+    return read_wkb(begin, end, geometry, srid);
+}
+
 
 }} // namespace boost::geometry
 
@@ -0,0 +1,618 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_GIS_IO_WKB_WKB_VIEW_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_GIS_IO_WKB_WKB_VIEW_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/throw_exception.hpp>
+
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_order.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/detail/parser.hpp>
+#include <boost/geometry/geometries/point.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkb
+{
+
+typedef unsigned char const* byte_pointer;
+
+inline boost::uint32_t load_count(byte_pointer it, byte_order_type::enum_t order)
+{
+    boost::uint32_t count = 0;
+    value_parser<boost::uint32_t>::load(it, count, order);
+    return count;
+}
+
+inline std::size_t point_size(geometry_header const& header)
+{
+    return header.coordinate_count() * sizeof(double);
+}
+
+// Checks a sequence of points, starting at its count, and moves to its end
+inline bool skip_points(byte_pointer& it, byte_pointer end, geometry_header const& header)
+{
+    boost::uint32_t count = 0;
+    if (! value_parser<boost::uint32_t>::parse(it, end, count, header.order)
+        || static_cast<std::size_t>(end - it) / point_size(header) < count)
+    {
+        return false;
+    }
+    it += count * point_size(header);
+    return true;
+}
+
+// Checks the rings of a polygon, starting at the number of rings,
+// and moves to its end
+inline bool skip_rings(byte_pointer& it, byte_pointer end, geometry_header const& header)
+{
+    boost::uint32_t count = 0;
+    if (! value_parser<boost::uint32_t>::parse(it, end, count, header.order))
+    {
+        return false;
+    }
+    for (boost::uint32_t i = 0; i < count; i++)
+    {
+        if (! skip_points(it, end, header))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Iterates through the coordinates in WKB, decoding a point when dereferenced
+template <typename Point>
+class point_iterator
+    : public boost::iterator_facade
+        <
+            point_iterator<Point>,
+            Point,
+            std::random_access_iterator_tag,
+            Point
+        >
+{
+public :
+    inline point_iterator()
+        : m_it(nullptr)
+    {}
+
+    inline point_iterator(byte_pointer it, geometry_header const& header)
+        : m_it(it)
+        , m_header(header)
+    {}
+
+private :
+    friend class boost::iterator_core_access;
+
+    inline Point dereference() const
+    {
+        Point point;
+        byte_pointer it = m_it;
+        coordinates_parser<Point>::load(it, point, m_header);
+        return point;
+    }
+
+    inline bool equal(point_iterator const& other) const { return m_it == other.m_it; }
+    inline void increment() { m_it += point_size(m_header); }
+    inline void decrement() { m_it -= point_size(m_header); }
+    inline void advance(std::ptrdiff_t n) { m_it += n * std::ptrdiff_t(point_size(m_header)); }
+    inline std::ptrdiff_t distance_to(point_iterator const& other) const
+    {
+        return (other.m_it - m_it) / std::ptrdiff_t(point_size(m_header));
+    }
+
+    byte_pointer m_it;
+    geometry_header m_header;
+};
+
+// Iterates through the rings of a polygon, of which the points are counted
+// when incrementing
+template <typename Ring>
+class ring_iterator
+    : public boost::iterator_facade
+        <
+            ring_iterator<Ring>,
+            Ring,
+            std::forward_iterator_tag,
+            Ring
+        >
+{
+public :
+    inline ring_iterator()
+        : m_it(nullptr)
+    {}
+
+    inline ring_iterator(byte_pointer it, geometry_header const& header)
+        : m_it(it)
+        , m_header(header)
+    {}
+
+private :
+    friend class boost::iterator_core_access;
+
+    inline Ring dereference() const { return Ring(m_it, m_header); }
+    inline bool equal(ring_iterator const& other) const { return m_it == other.m_it; }
+    inline void increment()
+    {
+        m_it += sizeof(boost::uint32_t)
+              + load_count(m_it, m_header.order) * point_size(m_header);
+    }
+
+    byte_pointer m_it;
+    geometry_header m_header;
+};
+
+// Iterates through the polygons of a multi polygon, of which the positions
+// are stored by the view
+template <typename Polygon>
+class polygon_iterator
+    : public boost::iterator_facade
+        <
+            polygon_iterator<Polygon>,
+            Polygon,
+            std::random_access_iterator_tag,
+            Polygon
+        >
+{
+public :
+    inline polygon_iterator()
+        : m_it(nullptr)
+        , m_end(nullptr)
+    {}
+
+    inline polygon_iterator(byte_pointer const* it, byte_pointer end)
+        : m_it(it)
+        , m_end(end)
+    {}
+
+private :
+    friend class boost::iterator_core_access;
+
+    inline Polygon dereference() const
+    {
+        geometry_header header;
+        byte_pointer it = *m_it;
+        header_parser::parse(it, m_end, header);
+        return Polygon(it, m_end, header);
+    }
+
+    inline bool equal(polygon_iterator const& other) const { return m_it == other.m_it; }
+    inline void increment() { ++m_it; }
+    inline void decrement() { --m_it; }
+    inline void advance(std::ptrdiff_t n) { m_it += n; }
+    inline std::ptrdiff_t distance_to(polygon_iterator const& other) const
+    {
+        return other.m_it - m_it;
+    }
+
+    byte_pointer const* m_it;
+    byte_pointer m_end;
+};
+
+template <typename Geometry>
+inline byte_pointer parse_view_header(byte_pointer& it, byte_pointer end,
+                                      geometry_header& header)
+{
+    if (! header_parser::parse(it, end, header)
+        || header.type != geometry_type<Geometry>::base())
+    {
+        BOOST_THROW_EXCEPTION(read_wkb_exception());
+    }
+    return it;
+}
+
+}} // namespace detail::wkb
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Linestring viewing (the points of) a WKB linestring, without copying
+\ingroup wkb
+\details The points are decoded when the iterator is dereferenced, so they
+    are returned by value. Therefore the views support algorithms visiting
+    the points, such as area, length, envelope, centroid, distance and
+    within (for points), but not algorithms based on turns (e.g. intersects
+    between two views). The bytes should stay alive while the view is used.
+    WKB with Z and/or M is supported, they are assigned if Point has a
+    third and fourth dimension.
+\tparam Point point type, in which the points are decoded
+*/
+template <typename Point = model::point<double, 2, cs::cartesian> >
+class wkb_linestring_view
+{
+public :
+    typedef detail::wkb::point_iterator<Point> iterator;
+    typedef iterator const_iterator;
+
+    inline wkb_linestring_view()
+        : m_points(nullptr)
+        , m_count(0)
+    {}
+
+    //! Constructs from WKB of a linestring, throws read_wkb_exception if invalid
+    template <typename ByteType>
+    inline wkb_linestring_view(ByteType const* bytes, std::size_t length)
+    {
+        detail::wkb::byte_pointer it = reinterpret_cast<detail::wkb::byte_pointer>(bytes);
+        detail::wkb::byte_pointer const end = it + length;
+        detail::wkb::parse_view_header<wkb_linestring_view>(it, end, m_header);
+        assign(it, m_header);
+        if (! detail::wkb::skip_points(it, end, m_header))
+        {
+            BOOST_THROW_EXCEPTION(read_wkb_exception());
+        }
+    }
+
+    // Constructs from a checked sequence of points, starting at its count
+    inline wkb_linestring_view(detail::wkb::byte_pointer it,
+                               detail::wkb::geometry_header const& header)
+    {
+        assign(it, header);
+    }
+
+    inline const_iterator begin() const { return const_iterator(m_points, m_header); }
+    inline const_iterator end() const
+    {
+        return const_iterator(m_points + m_count * detail::wkb::point_size(m_header), m_header);
+    }
+    inline std::size_t size() const { return m_count; }
+    inline bool empty() const { return m_count == 0; }
+
+    //! The SRID of EWKB, or 0
+    inline boost::uint32_t srid() const { return m_header.srid; }
+
+private :
+    inline void assign(detail::wkb::byte_pointer it,
+                       detail::wkb::geometry_header const& header)
+    {
+        m_header = header;
+        m_count = detail::wkb::load_count(it, header.order);
+        m_points = it + sizeof(boost::uint32_t);
+    }
+
+    detail::wkb::byte_pointer m_points;
+    std::size_t m_count;
+    detail::wkb::geometry_header m_header;
+};
+
+
+/*!
+\brief Ring of a WKB polygon view
+\ingroup wkb
+*/
+template
+<
+    typename Point = model::point<double, 2, cs::cartesian>,
+    bool ClockWise = true, bool Closed = true
+>
+class wkb_ring_view
+    : public wkb_linestring_view<Point>
+{
+public :
+    inline wkb_ring_view()
+    {}
+
+    inline wkb_ring_view(detail::wkb::byte_pointer it,
+                         detail::wkb::geometry_header const& header)
+        : wkb_linestring_view<Point>(it, header)
+    {}
+};
+
+
+/*!
+\brief Range of the interior rings of a WKB polygon view
+\ingroup wkb
+*/
+template <typename Ring>
+class wkb_ring_range
+{
+public :
+    typedef detail::wkb::ring_iterator<Ring> iterator;
+    typedef iterator const_iterator;
+
+    inline wkb_ring_range()
+        : m_first(nullptr)
+        , m_end(nullptr)
+        , m_count(0)
+    {}
+
+    inline wkb_ring_range(detail::wkb::byte_pointer first, detail::wkb::byte_pointer end,
+                          std::size_t count, detail::wkb::geometry_header const& header)
+        : m_first(first)
+        , m_end(end)
+        , m_count(count)
+        , m_header(header)
+    {}
+
+    inline const_iterator begin() const { return const_iterator(m_first, m_header); }
+    inline const_iterator end() const { return const_iterator(m_end, m_header); }
+    inline std::size_t size() const { return m_count; }
+    inline bool empty() const { return m_count == 0; }
+
+private :
+    detail::wkb::byte_pointer m_first;
+    detail::wkb::byte_pointer m_end;
+    std::size_t m_count;
+    detail::wkb::geometry_header m_header;
+};
+
+
+/*!
+\brief Polygon viewing a WKB polygon, without copying
+\ingroup wkb
+\details See wkb_linestring_view
+\tparam Point point type, in which the points are decoded
+\tparam ClockWise true for clockwise direction, false for counter clockwise
+\tparam Closed true for closed rings, false for open rings
+*/
+template
+<
+    typename Point = model::point<double, 2, cs::cartesian>,
+    bool ClockWise = true, bool Closed = true
+>
+class wkb_polygon_view
+{
+public :
+    typedef wkb_ring_view<Point, ClockWise, Closed> ring_type;
+    typedef wkb_ring_range<ring_type> ring_range_type;
+
+    inline wkb_polygon_view()
+        : m_rings(nullptr)
+        , m_end(nullptr)
+    {}
+
+    //! Constructs from WKB of a polygon, throws read_wkb_exception if invalid
+    template <typename ByteType>
+    inline wkb_polygon_view(ByteType const* bytes, std::size_t length)
+    {
+        detail::wkb::byte_pointer it = reinterpret_cast<detail::wkb::byte_pointer>(bytes);
+        detail::wkb::byte_pointer const end = it + length;
+        detail::wkb::geometry_header header;
+        detail::wkb::parse_view_header<wkb_polygon_view>(it, end, header);
+        m_rings = it;
+        m_header = header;
+        if (! detail::wkb::skip_rings(it, end, m_header))
+        {
+            BOOST_THROW_EXCEPTION(read_wkb_exception());
+        }
+        m_end = it;
+    }
+
+    // Constructs from a checked polygon, starting at its number of rings
+    inline wkb_polygon_view(detail::wkb::byte_pointer it, detail::wkb::byte_pointer end,
+                            detail::wkb::geometry_header const& header)
+        : m_rings(it)
+        , m_header(header)
+    {
+        detail::wkb::skip_rings(it, end, header);
+        m_end = it;
+    }
+
+    inline std::size_t ring_count() const
+    {
+        return m_rings == nullptr ? 0 : detail::wkb::load_count(m_rings, m_header.order);
+    }
+
+    inline ring_type outer() const
+    {
+        return ring_count() == 0
+            ? ring_type()
+            : ring_type(m_rings + sizeof(boost::uint32_t), m_header);
+    }
+
+    inline ring_range_type inners() const
+    {
+        std::size_t const count = ring_count();
+        if (count <= 1)
+        {
+            return ring_range_type();
+        }
+        detail::wkb::byte_pointer first = m_rings + sizeof(boost::uint32_t);
+        detail::wkb::skip_points(first, m_end, m_header);
+        return ring_range_type(first, m_end, count - 1, m_header);
+    }
+
+    //! The SRID of EWKB, or 0
+    inline boost::uint32_t srid() const { return m_header.srid; }
+
+private :
+    detail::wkb::byte_pointer m_rings;
+    detail::wkb::byte_pointer m_end;
+    detail::wkb::geometry_header m_header;
+};
+
+
+/*!
+\brief Multi polygon viewing a WKB multi polygon, without copying
+\ingroup wkb
+\details See wkb_linestring_view
+\tparam Point point type, in which the points are decoded
+\tparam ClockWise true for clockwise direction, false for counter clockwise
+\tparam Closed true for closed rings, false for open rings
+*/
+template
+<
+    typename Point = model::point<double, 2, cs::cartesian>,
+    bool ClockWise = true, bool Closed = true
+>
+class wkb_multi_polygon_view
+{
+public :
+    typedef wkb_polygon_view<Point, ClockWise, Closed> polygon_type;
+    typedef detail::wkb::polygon_iterator<polygon_type> iterator;
+    typedef iterator const_iterator;
+
+    inline wkb_multi_polygon_view()
+        : m_end(nullptr)
+        , m_srid(0)
+    {}
+
+    //! Constructs from WKB of a multi polygon, throws read_wkb_exception if invalid
+    template <typename ByteType>
+    inline wkb_multi_polygon_view(ByteType const* bytes, std::size_t length)
+    {
+        detail::wkb::byte_pointer it = reinterpret_cast<detail::wkb::byte_pointer>(bytes);
+        detail::wkb::byte_pointer const end = it + length;
+        detail::wkb::geometry_header header;
+        detail::wkb::parse_view_header<wkb_multi_polygon_view>(it, end, header);
+        m_srid = header.srid;
+
+        boost::uint32_t count = 0;
+        if (! detail::wkb::value_parser<boost::uint32_t>::parse(it, end, count, header.order))
+        {
+            BOOST_THROW_EXCEPTION(read_wkb_exception());
+        }
+
+        if (static_cast<std::size_t>(end - it) / 9 < count)
+        {
+            BOOST_THROW_EXCEPTION(read_wkb_exception());
+        }
+
+        m_polygons.reserve(count);
+        for (boost::uint32_t i = 0; i < count; i++)
+        {
+            m_polygons.push_back(it);
+            detail::wkb::geometry_header polygon_header;
+            detail::wkb::parse_view_header<polygon_type>(it, end, polygon_header);
+            if (! detail::wkb::skip_rings(it, end, polygon_header))
+            {
+                BOOST_THROW_EXCEPTION(read_wkb_exception());
+            }
+        }
+        m_end = it;
+    }
+
+    inline const_iterator begin() const { return const_iterator(m_polygons.data(), m_end); }
+    inline const_iterator end() const
+    {
+        return const_iterator(m_polygons.data() + m_polygons.size(), m_end);
+    }
+    inline std::size_t size() const { return m_polygons.size(); }
+    inline bool empty() const { return m_polygons.empty(); }
+
+    //! The SRID of EWKB, or 0
+    inline boost::uint32_t srid() const { return m_srid; }
+
+private :
+    // Only the positions of the polygons are stored, to access them randomly
+    std::vector<detail::wkb::byte_pointer> m_polygons;
+    detail::wkb::byte_pointer m_end;
+    boost::uint32_t m_srid;
+};
+
+
+#ifndef DOXYGEN_NO_TRAITS_SPECIALIZATIONS
+namespace traits
+{
+
+template <typename Point>
+struct tag<wkb_linestring_view<Point> >
+{
+    typedef linestring_tag type;
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct tag<wkb_ring_view<Point, ClockWise, Closed> >
+{
+    typedef ring_tag type;
+};
+
+template <typename Point, bool Closed>
+struct point_order<wkb_ring_view<Point, false, Closed> >
+{
+    static const order_selector value = counterclockwise;
+};
+
+template <typename Point, bool ClockWise>
+struct closure<wkb_ring_view<Point, ClockWise, false> >
+{
+    static const closure_selector value = open;
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct tag<wkb_polygon_view<Point, ClockWise, Closed> >
+{
+    typedef polygon_tag type;
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct ring_const_type<wkb_polygon_view<Point, ClockWise, Closed> >
+{
+    typedef wkb_ring_view<Point, ClockWise, Closed> type;
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct ring_mutable_type<wkb_polygon_view<Point, ClockWise, Closed> >
+{
+    typedef wkb_ring_view<Point, ClockWise, Closed> type;
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct interior_const_type<wkb_polygon_view<Point, ClockWise, Closed> >
+{
+    typedef wkb_ring_range<wkb_ring_view<Point, ClockWise, Closed> > type;
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct interior_mutable_type<wkb_polygon_view<Point, ClockWise, Closed> >
+{
+    typedef wkb_ring_range<wkb_ring_view<Point, ClockWise, Closed> > type;
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct exterior_ring<wkb_polygon_view<Point, ClockWise, Closed> >
+{
+    typedef wkb_polygon_view<Point, ClockWise, Closed> polygon_type;
+
+    static inline typename polygon_type::ring_type get(polygon_type const& p)
+    {
+        return p.outer();
+    }
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct interior_rings<wkb_polygon_view<Point, ClockWise, Closed> >
+{
+    typedef wkb_polygon_view<Point, ClockWise, Closed> polygon_type;
+
+    static inline typename polygon_type::ring_range_type get(polygon_type const& p)
+    {
+        return p.inners();
+    }
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct tag<wkb_multi_polygon_view<Point, ClockWise, Closed> >
+{
+    typedef multi_polygon_tag type;
+};
+
+} // namespace traits
+#endif // DOXYGEN_NO_TRAITS_SPECIALIZATIONS
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_GIS_IO_WKB_WKB_VIEW_HPP
@@ -18,8 +18,11 @@
 
 #include <boost/static_assert.hpp>
 
+#include <boost/geometry/core/tag.hpp>
 #include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/core/visit.hpp>
 #include <boost/geometry/extensions/gis/io/wkb/detail/writer.hpp>
+#include <boost/geometry/util/type_traits.hpp>
 
 namespace boost { namespace geometry
 {
@@ -37,10 +40,10 @@ template <typename G>
 struct write_wkb<point_tag, G>
 {
     template <typename OutputIterator>
-    static inline bool write(const G& geometry, OutputIterator iter,
-                       detail::wkb::byte_order_type::enum_t byte_order)
+    static inline bool write(const G& geometry, OutputIterator& iter,
+                       detail::wkb::write_options const& options)
     {
-        return detail::wkb::point_writer<G>::write(geometry, iter, byte_order);
+        return detail::wkb::point_writer<G>::write(geometry, iter, options);
     }
 };
 
@@ -48,10 +51,10 @@ template <typename G>
 struct write_wkb<linestring_tag, G>
 {
     template <typename OutputIterator>
-    static inline bool write(const G& geometry, OutputIterator iter,
-                       detail::wkb::byte_order_type::enum_t byte_order)
+    static inline bool write(const G& geometry, OutputIterator& iter,
+                       detail::wkb::write_options const& options)
     {
-        return detail::wkb::linestring_writer<G>::write(geometry, iter, byte_order);
+        return detail::wkb::linestring_writer<G>::write(geometry, iter, options);
     }
 };
 
@@ -59,16 +62,102 @@ template <typename G>
 struct write_wkb<polygon_tag, G>
 {
     template <typename OutputIterator>
-    static inline bool write(const G& geometry, OutputIterator iter,
-                       detail::wkb::byte_order_type::enum_t byte_order)
+    static inline bool write(const G& geometry, OutputIterator& iter,
+                       detail::wkb::write_options const& options)
     {
-        return detail::wkb::polygon_writer<G>::write(geometry, iter, byte_order);
+        return detail::wkb::polygon_writer<G>::write(geometry, iter, options);
+    }
+};
+
+template <typename G>
+struct write_wkb<multi_point_tag, G>
+{
+    template <typename OutputIterator>
+    static inline bool write(const G& geometry, OutputIterator& iter,
+                       detail::wkb::write_options const& options)
+    {
+        return detail::wkb::multipoint_writer<G>::write(geometry, iter, options);
+    }
+};
+
+template <typename G>
+struct write_wkb<multi_linestring_tag, G>
+{
+    template <typename OutputIterator>
+    static inline bool write(const G& geometry, OutputIterator& iter,
+                       detail::wkb::write_options const& options)
+    {
+        return detail::wkb::multilinestring_writer<G>::write(geometry, iter, options);
+    }
+};
+
+template <typename G>
+struct write_wkb<multi_polygon_tag, G>
+{
+    template <typename OutputIterator>
+    static inline bool write(const G& geometry, OutputIterator& iter,
+                       detail::wkb::write_options const& options)
+    {
+        return detail::wkb::multipolygon_writer<G>::write(geometry, iter, options);
+    }
+};
+
+template <typename G>
+struct write_wkb<dynamic_geometry_tag, G>
+{
+    template <typename OutputIterator>
+    static inline bool write(const G& geometry, OutputIterator& iter,
+                       detail::wkb::write_options const& options)
+    {
+        bool result = false;
+        traits::visit<G>::apply([&](auto const& g)
+        {
+            using geom_t = util::remove_cref_t<decltype(g)>;
+            result = write_wkb<typename tag<geom_t>::type, geom_t>
+                        ::write(g, iter, options);
+        }, geometry);
+        return result;
+    }
+};
+
+template <typename G>
+struct write_wkb<geometry_collection_tag, G>
+{
+    template <typename OutputIterator>
+    static inline bool write(const G& geometry, OutputIterator& iter,
+                       detail::wkb::write_options const& options)
+    {
+        detail::wkb::header_writer<G>::write(iter, options);
+
+        // write num geometries
+        boost::uint32_t count = boost::size(geometry);
+        detail::wkb::value_writer<boost::uint32_t>::write(count, iter, options.byte_order);
+
+        bool result = true;
+        for (auto it = boost::begin(geometry); it != boost::end(geometry); ++it)
+        {
+            traits::iter_visit<G>::apply([&](auto const& g)
+            {
+                using geom_t = util::remove_cref_t<decltype(g)>;
+                result = write_wkb<typename tag<geom_t>::type, geom_t>
+                            ::write(g, iter, options.nested()) && result;
+            }, it);
+        }
+        return result;
     }
 };
 
 } // namespace dispatch
 #endif // DOXYGEN_NO_DISPATCH
 
+/*!
+\brief Writes a geometry as ISO WKB, in the native byte order
+\ingroup wkb
+\details Geometries with three dimensions are written with Z (type + 1000).
+\param geometry the geometry, of any type, including dynamic geometries and
+    geometry collections
+\param iter output iterator to which the bytes are written
+*/
 template <typename G, typename OutputIterator>
 inline bool write_wkb(const G& geometry, OutputIterator iter)
 {
@@ -80,53 +169,44 @@ inline bool write_wkb(const G& geometry, OutputIterator iter)
         const std::output_iterator_tag&
         >::value));
 
-// Will write in the native byte order
-#ifdef BOOST_BIG_ENDIAN
-        detail::wkb::byte_order_type::enum_t byte_order =  detail::wkb::byte_order_type::xdr;
-#else
-        detail::wkb::byte_order_type::enum_t byte_order =  detail::wkb::byte_order_type::ndr;
-#endif
+    // Will write in the native byte order
+    detail::wkb::write_options const options(detail::wkb::native_byte_order());
 
-    if
-        (!dispatch::write_wkb
+    return dispatch::write_wkb
         <
         typename tag<G>::type,
         G
-        >::write(geometry, iter, byte_order))
-    {
-        return false;
-    }
-
-    return true;
+        >::write(geometry, iter, options);
 }
 
-// 	template <typename G, typename OutputIterator>
-// 	inline bool write_wkb(G& geometry, OutputIterator iter, 
-// 		detail::wkb::byte_order_type::enum_t source_byte_order, 
-// 		detail::wkb::byte_order_type::enum_t target_byte_order)
-// 	{
-// 		// The WKB is written to an OutputIterator.
-// 		BOOST_STATIC_ASSERT((
-// 			std::is_convertible
-// 			<
-// 			typename std::iterator_traits<OutputIterator>::iterator_category,
-// 			const std::output_iterator_tag&
-// 			>::value));
-// 
-// 		if
-// 			(
-// 			!dispatch::write_wkb
-// 			<
-// 			typename tag<G>::type,
-// 			G
-// 			>::write(geometry, iter, byte_order)
-// 			)
-// 		{
-// 			return false;
-// 		}
-// 
-// 		return true;
-// 	}
+/*!
+\brief Writes a geometry as PostGIS EWKB, in the native byte order
+\ingroup wkb
+\details Geometries with three dimensions are written with the Z flag. The
+    SRID is written if it is not 0.
+\param geometry the geometry, of any type, including dynamic geometries and
+    geometry collections
+\param iter output iterator to which the bytes are written
+\param srid the SRID
+*/
+template <typename G, typename OutputIterator>
+inline bool write_ewkb(const G& geometry, OutputIterator iter, boost::uint32_t srid = 0)
+{
+    BOOST_STATIC_ASSERT((
+        std::is_convertible
+        <
+        typename std::iterator_traits<OutputIterator>::iterator_category,
+        const std::output_iterator_tag&
+        >::value));
+
+    detail::wkb::write_options const options(detail::wkb::native_byte_order(), true, srid);
+
+    return dispatch::write_wkb
+        <
+        typename tag<G>::type,
+        G
+        >::write(geometry, iter, options);
+}
 
 }} // namespace boost::geometry
 #endif // BOOST_GEOMETRY_IO_WKB_WRITE_WKB_HPP
@@ -0,0 +1,527 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_VIEWS_FLAT_VIEW_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_VIEWS_FLAT_VIEW_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include <boost/iterator/iterator_facade.hpp>
+
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_order.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/point.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace flat_view
+{
+
+// Random access iterator over the elements of a flat view, which are views
+// themselves and returned by value. It contains a copy of the (small) range,
+// such that it stays valid if the range is a temporary.
+template <typename Range, typename Value>
+class index_iterator
+    : public boost::iterator_facade
+        <
+            index_iterator<Range, Value>,
+            Value,
+            std::random_access_iterator_tag,
+            Value
+        >
+{
+public :
+    inline index_iterator()
+        : m_index(0)
+    {}
+
+    inline index_iterator(Range const& range, std::ptrdiff_t index)
+        : m_range(range)
+        , m_index(index)
+    {}
+
+private :
+    friend class boost::iterator_core_access;
+
+    inline Value dereference() const { return m_range.at(m_index); }
+    inline bool equal(index_iterator const& other) const { return m_index == other.m_index; }
+    inline void increment() { ++m_index; }
+    inline void decrement() { --m_index; }
+    inline void advance(std::ptrdiff_t n) { m_index += n; }
+    inline std::ptrdiff_t distance_to(index_iterator const& other) const
+    {
+        return other.m_index - m_index;
+    }
+
+    Range m_range;
+    std::ptrdiff_t m_index;
+};
+
+// The points of the buffer are accessed as an array of Point, which
+// therefore should be an array of coordinates itself: a standard layout
+// (and trivially copyable) type, without padding, having the alignment of
+// its coordinates. Its first member, the coordinates, then has the address
+// of the point itself, as for model::point.
+template <typename Point>
+struct check_point
+{
+    typedef typename coordinate_type<Point>::type coordinate_type;
+
+    static_assert(std::is_standard_layout<Point>::value
+                  && std::is_trivially_copyable<Point>::value,
+                  "The point type should be a standard layout type");
+    static_assert(sizeof(Point) == dimension<Point>::value * sizeof(coordinate_type)
+                  && alignof(Point) == alignof(coordinate_type),
+                  "The point type should consist of its coordinates only");
+};
+
+}} // namespace detail::flat_view
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Linestring viewing a flat buffer of coordinates (x0, y0, x1, y1, ...)
+\ingroup views
+\details The coordinates are not copied: the points are accessed as an array
+    of Point in the buffer, which should stay alive while the view is used.
+    Point should consist of its coordinates only, such as model::point.
+\tparam Point point type, defining the coordinate type and the dimension
+*/
+template <typename Point = model::point<double, 2, cs::cartesian> >
+class flat_linestring_view
+    : detail::flat_view::check_point<Point>
+{
+public :
+    typedef Point const* iterator;
+    typedef Point const* const_iterator;
+    typedef typename coordinate_type<Point>::type coordinate_type;
+
+    inline flat_linestring_view()
+        : m_begin(nullptr)
+        , m_end(nullptr)
+    {}
+
+    inline flat_linestring_view(Point const* begin, Point const* end)
+        : m_begin(begin)
+        , m_end(end)
+    {}
+
+    inline flat_linestring_view(coordinate_type const* coordinates, std::size_t point_count)
+        : m_begin(reinterpret_cast<Point const*>(coordinates))
+        , m_end(m_begin + point_count)
+    {}
+
+    inline const_iterator begin() const { return m_begin; }
+    inline const_iterator end() const { return m_end; }
+    inline std::size_t size() const { return m_end - m_begin; }
+    inline bool empty() const { return m_begin == m_end; }
+
+private :
+    Point const* m_begin;
+    Point const* m_end;
+};
+
+
+/*!
+\brief Ring viewing a flat buffer of coordinates
+\ingroup views
+\details See flat_linestring_view
+\tparam Point point type
+\tparam ClockWise true for clockwise direction, false for counter clockwise
+\tparam Closed true for closed rings, false for open rings
+*/
+template
+<
+    typename Point = model::point<double, 2, cs::cartesian>,
+    bool ClockWise = true, bool Closed = true
+>
+class flat_ring_view
+    : public flat_linestring_view<Point>
+{
+    typedef flat_linestring_view<Point> base;
+
+public :
+    inline flat_ring_view()
+    {}
+
+    inline flat_ring_view(Point const* begin, Point const* end)
+        : base(begin, end)
+    {}
+
+    inline flat_ring_view(typename base::coordinate_type const* coordinates,
+                          std::size_t point_count)
+        : base(coordinates, point_count)
+    {}
+};
+
+
+/*!
+\brief Range of rings of a flat buffer, ring i consists of the points
+    [offsets[i], offsets[i + 1])
+\ingroup views
+*/
+template <typename Ring, typename Offset = std::size_t>
+class flat_ring_range
+{
+    typedef typename point_type<Ring>::type point_type;
+
+public :
+    typedef detail::flat_view::index_iterator<flat_ring_range, Ring> iterator;
+    typedef iterator const_iterator;
+
+    inline flat_ring_range()
+        : m_points(nullptr)
+        , m_offsets(nullptr)
+        , m_count(0)
+    {}
+
+    inline flat_ring_range(point_type const* points, Offset const* offsets, std::size_t count)
+        : m_points(points)
+        , m_offsets(offsets)
+        , m_count(count)
+    {}
+
+    inline Ring at(std::size_t index) const
+    {
+        return Ring(m_points + m_offsets[index], m_points + m_offsets[index + 1]);
+    }
+
+    inline const_iterator begin() const { return const_iterator(*this, 0); }
+    inline const_iterator end() const { return const_iterator(*this, m_count); }
+    inline std::size_t size() const { return m_count; }
+    inline bool empty() const { return m_count == 0; }
+
+private :
+    point_type const* m_points;
+    Offset const* m_offsets;
+    std::size_t m_count;
+};
+
+
+/*!
+\brief Polygon viewing a flat buffer of coordinates and ring offsets
+\ingroup views
+\details The layout is as in Apache Arrow (GeoArrow): the points of ring i
+    are [ring_offsets[i], ring_offsets[i + 1]), where the first ring is the
+    exterior ring. Neither coordinates nor offsets are copied.
+\tparam Point point type
+\tparam ClockWise true for clockwise direction, false for counter clockwise
+\tparam Closed true for closed rings, false for open rings
+\tparam Offset type of the offsets
+*/
+template
+<
+    typename Point = model::point<double, 2, cs::cartesian>,
+    bool ClockWise = true, bool Closed = true,
+    typename Offset = std::size_t
+>
+class flat_polygon_view
+    : detail::flat_view::check_point<Point>
+{
+public :
+    typedef flat_ring_view<Point, ClockWise, Closed> ring_type;
+    typedef flat_ring_range<ring_type, Offset> ring_range_type;
+    typedef typename coordinate_type<Point>::type coordinate_type;
+
+    inline flat_polygon_view()
+        : m_points(nullptr)
+        , m_ring_offsets(nullptr)
+        , m_ring_count(0)
+    {}
+
+    inline flat_polygon_view(Point const* points, Offset const* ring_offsets,
+                             std::size_t ring_count)
+        : m_points(points)
+        , m_ring_offsets(ring_offsets)
+        , m_ring_count(ring_count)
+    {}
+
+    // ring_offsets should contain ring_count + 1 values
+    inline flat_polygon_view(coordinate_type const* coordinates,
+                             Offset const* ring_offsets, std::size_t ring_count)
+        : m_points(reinterpret_cast<Point const*>(coordinates))
+        , m_ring_offsets(ring_offsets)
+        , m_ring_count(ring_count)
+    {}
+
+    inline ring_type outer() const
+    {
+        return m_ring_count == 0
+            ? ring_type()
+            : ring_type(m_points + m_ring_offsets[0], m_points + m_ring_offsets[1]);
+    }
+
+    inline ring_range_type inners() const
+    {
+        return m_ring_count <= 1
+            ? ring_range_type()
+            : ring_range_type(m_points, m_ring_offsets + 1, m_ring_count - 1);
+    }
+
+private :
+    Point const* m_points;
+    Offset const* m_ring_offsets;
+    std::size_t m_ring_count;
+};
+
+
+/*!
+\brief Multi linestring viewing a flat buffer of coordinates and offsets
+\ingroup views
+\details The points of linestring i are [offsets[i], offsets[i + 1]).
+    Neither coordinates nor offsets are copied.
+\tparam Point point type
+\tparam Offset type of the offsets
+*/
+template
+<
+    typename Point = model::point<double, 2, cs::cartesian>,
+    typename Offset = std::size_t
+>
+class flat_multi_linestring_view
+    : detail::flat_view::check_point<Point>
+{
+public :
+    typedef flat_linestring_view<Point> linestring_type;
+    typedef detail::flat_view::index_iterator<flat_multi_linestring_view, linestring_type> iterator;
+    typedef iterator const_iterator;
+    typedef typename coordinate_type<Point>::type coordinate_type;
+
+    inline flat_multi_linestring_view()
+        : m_points(nullptr)
+        , m_offsets(nullptr)
+        , m_count(0)
+    {}
+
+    inline flat_multi_linestring_view(Point const* points, Offset const* offsets,
+                                      std::size_t linestring_count)
+        : m_points(points)
+        , m_offsets(offsets)
+        , m_count(linestring_count)
+    {}
+
+    // offsets should contain linestring_count + 1 values
+    inline flat_multi_linestring_view(coordinate_type const* coordinates,
+                                      Offset const* offsets, std::size_t linestring_count)
+        : m_points(reinterpret_cast<Point const*>(coordinates))
+        , m_offsets(offsets)
+        , m_count(linestring_count)
+    {}
+
+    inline linestring_type at(std::size_t index) const
+    {
+        return linestring_type(m_points + m_offsets[index], m_points + m_offsets[index + 1]);
+    }
+
+    inline const_iterator begin() const { return const_iterator(*this, 0); }
+    inline const_iterator end() const { return const_iterator(*this, m_count); }
+    inline std::size_t size() const { return m_count; }
+    inline bool empty() const { return m_count == 0; }
+
+    inline Point const* points() const { return m_points; }
+    inline Offset const* offsets() const { return m_offsets; }
+
+private :
+    Point const* m_points;
+    Offset const* m_offsets;
+    std::size_t m_count;
+};
+
+
+/*!
+\brief Multi polygon viewing a flat buffer of coordinates, ring offsets
+    and polygon offsets
+\ingroup views
+\details The layout is as in Apache Arrow (GeoArrow): the rings of polygon i
+    are [polygon_offsets[i], polygon_offsets[i + 1]), the points of ring j
+    are [ring_offsets[j], ring_offsets[j + 1]).
+\tparam Point point type
+\tparam ClockWise true for clockwise direction, false for counter clockwise
+\tparam Closed true for closed rings, false for open rings
+\tparam Offset type of the offsets
+*/
+template
+<
+    typename Point = model::point<double, 2, cs::cartesian>,
+    bool ClockWise = true, bool Closed = true,
+    typename Offset = std::size_t
+>
+class flat_multi_polygon_view
+    : detail::flat_view::check_point<Point>
+{
+public :
+    typedef flat_polygon_view<Point, ClockWise, Closed, Offset> polygon_type;
+    typedef detail::flat_view::index_iterator<flat_multi_polygon_view, polygon_type> iterator;
+    typedef iterator const_iterator;
+    typedef typename coordinate_type<Point>::type coordinate_type;
+
+    inline flat_multi_polygon_view()
+        : m_points(nullptr)
+        , m_ring_offsets(nullptr)
+        , m_polygon_offsets(nullptr)
+        , m_count(0)
+    {}
+
+    inline flat_multi_polygon_view(Point const* points,
+                                   Offset const* ring_offsets,
+                                   Offset const* polygon_offsets,
+                                   std::size_t polygon_count)
+        : m_points(points)
+        , m_ring_offsets(ring_offsets)
+        , m_polygon_offsets(polygon_offsets)
+        , m_count(polygon_count)
+    {}
+
+    // polygon_offsets should contain polygon_count + 1 values
+    inline flat_multi_polygon_view(coordinate_type const* coordinates,
+                                   Offset const* ring_offsets,
+                                   Offset const* polygon_offsets,
+                                   std::size_t polygon_count)
+        : m_points(reinterpret_cast<Point const*>(coordinates))
+        , m_ring_offsets(ring_offsets)
+        , m_polygon_offsets(polygon_offsets)
+        , m_count(polygon_count)
+    {}
+
+    inline polygon_type at(std::size_t index) const
+    {
+        return polygon_type(m_points,
+                            m_ring_offsets + m_polygon_offsets[index],
+                            m_polygon_offsets[index + 1] - m_polygon_offsets[index]);
+    }
+
+    inline const_iterator begin() const { return const_iterator(*this, 0); }
+    inline const_iterator end() const { return const_iterator(*this, m_count); }
+    inline std::size_t size() const { return m_count; }
+    inline bool empty() const { return m_count == 0; }
+
+    inline Point const* points() const { return m_points; }
+    inline Offset const* ring_offsets() const { return m_ring_offsets; }
+    inline Offset const* polygon_offsets() const { return m_polygon_offsets; }
+
+private :
+    Point const* m_points;
+    Offset const* m_ring_offsets;
+    Offset const* m_polygon_offsets;
+    std::size_t m_count;
+};
+
+
+#ifndef DOXYGEN_NO_TRAITS_SPECIALIZATIONS
+namespace traits
+{
+
+template <typename Point>
+struct tag<flat_linestring_view<Point> >
+{
+    typedef linestring_tag type;
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct tag<flat_ring_view<Point, ClockWise, Closed> >
+{
+    typedef ring_tag type;
+};
+
+template <typename Point, bool Closed>
+struct point_order<flat_ring_view<Point, false, Closed> >
+{
+    static const order_selector value = counterclockwise;
+};
+
+template <typename Point, bool ClockWise>
+struct closure<flat_ring_view<Point, ClockWise, false> >
+{
+    static const closure_selector value = open;
+};
+
+template <typename Point, bool ClockWise, bool Closed, typename Offset>
+struct tag<flat_polygon_view<Point, ClockWise, Closed, Offset> >
+{
+    typedef polygon_tag type;
+};
+
+template <typename Point, bool ClockWise, bool Closed, typename Offset>
+struct ring_const_type<flat_polygon_view<Point, ClockWise, Closed, Offset> >
+{
+    typedef flat_ring_view<Point, ClockWise, Closed> type;
+};
+
+template <typename Point, bool ClockWise, bool Closed, typename Offset>
+struct ring_mutable_type<flat_polygon_view<Point, ClockWise, Closed, Offset> >
+{
+    typedef flat_ring_view<Point, ClockWise, Closed> type;
+};
+
+template <typename Point, bool ClockWise, bool Closed, typename Offset>
+struct interior_const_type<flat_polygon_view<Point, ClockWise, Closed, Offset> >
+{
+    typedef flat_ring_range<flat_ring_view<Point, ClockWise, Closed>, Offset> type;
+};
+
+template <typename Point, bool ClockWise, bool Closed, typename Offset>
+struct interior_mutable_type<flat_polygon_view<Point, ClockWise, Closed, Offset> >
+{
+    typedef flat_ring_range<flat_ring_view<Point, ClockWise, Closed>, Offset> type;
+};
+
+template <typename Point, bool ClockWise, bool Closed, typename Offset>
+struct exterior_ring<flat_polygon_view<Point, ClockWise, Closed, Offset> >
+{
+    typedef flat_polygon_view<Point, ClockWise, Closed, Offset> polygon_type;
+
+    static inline typename polygon_type::ring_type get(polygon_type const& p)
+    {
+        return p.outer();
+    }
+};
+
+template <typename Point, bool ClockWise, bool Closed, typename Offset>
+struct interior_rings<flat_polygon_view<Point, ClockWise, Closed, Offset> >
+{
+    typedef flat_polygon_view<Point, ClockWise, Closed, Offset> polygon_type;
+
+    static inline typename polygon_type::ring_range_type get(polygon_type const& p)
+    {
+        return p.inners();
+    }
+};
+
+template <typename Point, typename Offset>
+struct tag<flat_multi_linestring_view<Point, Offset> >
+{
+    typedef multi_linestring_tag type;
+};
+
+template <typename Point, bool ClockWise, bool Closed, typename Offset>
+struct tag<flat_multi_polygon_view<Point, ClockWise, Closed, Offset> >
+{
+    typedef multi_polygon_tag type;
+};
+
+} // namespace traits
+#endif // DOXYGEN_NO_TRAITS_SPECIALIZATIONS
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_VIEWS_FLAT_VIEW_HPP
@@ -343,13 +343,22 @@ public:
     }
 
     static inline CT trapezoidal_formula(CT lat1r, CT lat2r, CT lon21r)
+    {
+        CT const c2 = CT(2);
+
+        return trapezoidal_formula_tan(tan(lat1r / c2), tan(lat2r / c2), tan(lon21r / c2));
+    }
+
+    /*
+        The trapezoidal formula given the tangents of the halves of the
+        latitudes and of the difference of longitudes
+    */
+    static inline CT trapezoidal_formula_tan(CT tan_lat1, CT tan_lat2, CT tan_lon21)
     {
         CT const c1 = CT(1);
         CT const c2 = CT(2);
-        CT const tan_lat1 = tan(lat1r / c2);
-        CT const tan_lat2 = tan(lat2r / c2);
 
-        return c2 * atan(((tan_lat1 + tan_lat2) / (c1 + tan_lat1 * tan_lat2))* tan(lon21r / c2));
+        return c2 * atan(((tan_lat1 + tan_lat2) / (c1 + tan_lat1 * tan_lat2)) * tan_lon21);
     }
 
     /*
@@ -417,6 +426,34 @@ public:
         CT ellipsoidal_term;
     };
 
+    /*
+        The terms of the ellipsoidal correction depending on one endpoint of
+        a segment only
+    */
+    struct point_terms
+    {
+        CT lat;     // the latitude in radians
+        CT sin_bet; // the sine of the reduced latitude
+        CT cos_bet; // the cosine of the reduced latitude
+    };
+
+    static inline point_terms make_point_terms(CT const& latr, CT const& one_minus_f)
+    {
+        /*
+        CT sin_bet = sin(latr);
+        CT cos_bet = cos(latr);
+
+        sin_bet *= one_minus_f;
+        normalize(sin_bet, cos_bet);
+        */
+
+        CT const tan_bet = tan(latr) * one_minus_f;
+        CT const cos_bet = cos(atan(tan_bet));
+
+        point_terms const result = { latr, tan_bet * cos_bet, cos_bet };
+        return result;
+    }
+
     /*
         Compute the ellipsoidal correction of a geodesic (or shperical) segment
     */
@@ -430,8 +467,6 @@ public:
                                    PointOfSegment const& p2,
                                    SpheroidConst const& spheroid_const)
     {
-        return_type_ellipsoidal result;
-
         CT const lon1r = get_as_radian<0>(p1);
         CT const lat1r = get_as_radian<1>(p1);
         CT const lon2r = get_as_radian<0>(p2);
@@ -440,7 +475,46 @@ public:
         // Azimuth Approximation
 
         using inverse_type = Inverse<CT, true, true, true, false, false>;
-        auto i_res = inverse_type::apply(lon1r, lat1r, lon2r, lat2r, spheroid_const.m_spheroid);
+        auto i_res = inverse_type::apply(lon1r, lat1r, lon2r, lat2r,
+                                         spheroid_const.m_formula_model.get(spheroid_const.m_spheroid));
+
+        // Basic trigonometric computations
+        // TODO: optimization: those quantities are already computed in inverse formula
+        // at least in some inverse formulas, so do not compute them again here
+        CT const one_minus_f = CT(1) - spheroid_const.m_f;
+
+        CT lon12r = lon2r - lon1r;
+        math::normalize_longitude<radian, CT>(lon12r);
+
+        return ellipsoidal(lon12r,
+                           make_point_terms(lat1r, one_minus_f),
+                           make_point_terms(lat2r, one_minus_f),
+                           i_res,
+                           [&]() { return trapezoidal_formula(lat1r, lat2r, lon12r); },
+                           spheroid_const);
+    }
+
+    /*
+        Compute the ellipsoidal correction of a segment given the normalized
+        difference of longitudes, the terms of its endpoints, the result of
+        the inverse formula and a function returning the trapezoidal excess,
+        called for short segments only. Used by the algorithms calculating
+        the terms of each vertex once for both adjacent segments.
+    */
+    template
+    <
+        typename InverseResult,
+        typename Trapezoid,
+        typename SpheroidConst
+    >
+    static inline return_type_ellipsoidal ellipsoidal(CT const& lon12r,
+                                                      point_terms const& t1,
+                                                      point_terms const& t2,
+                                                      InverseResult const& i_res,
+                                                      Trapezoid const& trapezoid,
+                                                      SpheroidConst const& spheroid_const)
+    {
+        return_type_ellipsoidal result;
 
         CT const alp1 = i_res.azimuth;
         CT const alp2 = i_res.reverse_azimuth;
@@ -453,30 +527,13 @@ public:
         CT const pi = math::pi<CT>();
         CT const half_pi = pi / c2;
         CT const ep = spheroid_const.m_ep;
-        CT const one_minus_f = c1 - spheroid_const.m_f;
-
-        // Basic trigonometric computations
-        // the compiler could optimize here using sincos function
-        // TODO: optimization: those quantities are already computed in inverse formula
-        // at least in some inverse formulas, so do not compute them again here
-        /*
-        CT sin_bet1 = sin(lat1r);
-        CT cos_bet1 = cos(lat1r);
-        CT sin_bet2 = sin(lat2r);
-        CT cos_bet2 = cos(lat2r);
-
-        sin_bet1 *= one_minus_f;
-        sin_bet2 *= one_minus_f;
-        normalize(sin_bet1, cos_bet1);
-        normalize(sin_bet2, cos_bet2);
-        */
 
-        CT const tan_bet1 = tan(lat1r) * one_minus_f;
-        CT const tan_bet2 = tan(lat2r) * one_minus_f;
-        CT const cos_bet1 = cos(atan(tan_bet1));
-        CT const cos_bet2 = cos(atan(tan_bet2));
-        CT const sin_bet1 = tan_bet1 * cos_bet1;
-        CT const sin_bet2 = tan_bet2 * cos_bet2;
+        CT const lat1r = t1.lat;
+        CT const lat2r = t2.lat;
+        CT const cos_bet1 = t1.cos_bet;
+        CT const cos_bet2 = t2.cos_bet;
+        CT const sin_bet1 = t1.sin_bet;
+        CT const sin_bet2 = t2.sin_bet;
 
         CT const sin_alp1 = sin(alp1);
         CT const cos_alp1 = cos(alp1);
@@ -487,9 +544,6 @@ public:
 
         CT excess;
 
-        CT lon12r = lon2r - lon1r;
-        math::normalize_longitude<radian, CT>(lon12r);
-
         // Comparing with "==" works with all test cases here, but could potential create numerical issues
         if (lon12r == pi || lon12r == -pi)
         {
@@ -504,7 +558,7 @@ public:
             if (!meridian && (i_res.distance)
                 < mean_radius<CT>(spheroid_const.m_spheroid) / CT(638))  // short segment
             {
-                excess = trapezoidal_formula(lat1r, lat2r, lon12r);
+                excess = trapezoid();
             }
             else
             {
@@ -0,0 +1,259 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_FORMULAS_INVERSE_BATCH_HPP
+#define BOOST_GEOMETRY_FORMULAS_INVERSE_BATCH_HPP
+
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+#include <boost/geometry/core/radius.hpp>
+
+#include <boost/geometry/formulas/andoyer_inverse.hpp>
+#include <boost/geometry/formulas/flattening.hpp>
+#include <boost/geometry/formulas/thomas_inverse.hpp>
+
+#include <boost/geometry/util/math.hpp>
+
+
+namespace boost { namespace geometry { namespace formula
+{
+
+/*!
+\brief The solution of the inverse problem of geodesics for many pairs of
+       points at once, distances only.
+\details The coordinates of the pairs are passed in four arrays of count
+         longitudes and latitudes in radians and the distances are written
+         to an array of count values. By default the formula is applied to
+         each pair. The distances of andoyer_inverse and thomas_inverse are
+         calculated in blocks by loops without branches, which can be
+         vectorized if the compiler has vector versions of the trigonometric
+         functions, e.g. GCC with glibc and -O3 -ffast-math. The results are
+         the same as these of the formula up to the rounding of these
+         functions.
+         The iterative formulas, vincenty_inverse and karney_inverse, take
+         different numbers of iterations for different pairs and are applied
+         to each pair.
+\tparam Inverse the formula, e.g. andoyer_inverse<double, true, false>
+*/
+template <typename Inverse>
+struct inverse_batch
+{
+    template <typename T1, typename Spheroid, typename CT>
+    static inline void apply(T1 const* lon1, T1 const* lat1,
+                             T1 const* lon2, T1 const* lat2,
+                             std::size_t count,
+                             Spheroid const& spheroid,
+                             CT* distances)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            distances[i] = Inverse::apply(lon1[i], lat1[i], lon2[i], lat2[i], spheroid).distance;
+        }
+    }
+};
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+// The pairs are processed in blocks, the trigonometric functions of the
+// coordinates are calculated in separate loops over a block. Otherwise the
+// compiler calculates sin and cos of the same angle with sincos, which has
+// no vector version.
+static const std::size_t inverse_batch_block_size = 64;
+
+template <typename CT, typename T1>
+inline void inverse_batch_sin_cos(T1 const* angles, std::size_t count, CT* sin_angles, CT* cos_angles)
+{
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        sin_angles[i] = std::sin(CT(angles[i]));
+    }
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        cos_angles[i] = std::cos(CT(angles[i]));
+    }
+}
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
+template <typename CT>
+struct inverse_batch<andoyer_inverse<CT, true, false, false, false, false> >
+{
+    template <typename T1, typename Spheroid>
+    static inline void apply(T1 const* lon1, T1 const* lat1,
+                             T1 const* lon2, T1 const* lat2,
+                             std::size_t count,
+                             Spheroid const& spheroid,
+                             CT* distances)
+    {
+        static const std::size_t block_size = detail::inverse_batch_block_size;
+
+        CT const c0 = CT(0);
+        CT const c1 = CT(1);
+        CT const c3 = CT(3);
+        CT const eps = std::numeric_limits<CT>::epsilon();
+        CT const f_4 = formula::flattening<CT>(spheroid) / CT(4);
+        CT const a = CT(get_radius<0>(spheroid));
+
+        CT sin_lat1[block_size], cos_lat1[block_size];
+        CT sin_lat2[block_size], cos_lat2[block_size];
+        CT cos_dlon[block_size];
+
+        for (std::size_t first = 0; first < count; first += block_size)
+        {
+            std::size_t const n = (std::min)(block_size, count - first);
+
+            detail::inverse_batch_sin_cos(lat1 + first, n, sin_lat1, cos_lat1);
+            detail::inverse_batch_sin_cos(lat2 + first, n, sin_lat2, cos_lat2);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                cos_dlon[i] = std::cos(CT(lon2[first + i]) - CT(lon1[first + i]));
+            }
+
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                // As in andoyer_inverse, 0 for the same points, cos_d
+                // calculated for them may be less than 1
+                CT const la1 = CT(lat1[first + i]);
+                CT const la2 = CT(lat2[first + i]);
+                CT const lo1 = CT(lon1[first + i]);
+                CT const lo2 = CT(lon2[first + i]);
+                bool const same = std::abs(la1 - la2) <= eps * (std::max)({std::abs(la1), std::abs(la2), c1})
+                                & std::abs(lo1 - lo2) <= eps * (std::max)({std::abs(lo1), std::abs(lo2), c1});
+
+                CT cos_d = sin_lat1[i] * sin_lat2[i] + cos_lat1[i] * cos_lat2[i] * cos_dlon[i];
+                cos_d = cos_d < -c1 ? -c1 : cos_d;
+                cos_d = cos_d > c1 ? c1 : cos_d;
+
+                CT const d = std::acos(cos_d);
+                CT const three_sin_d = c3 * std::sin(d);
+                CT const K = math::sqr(sin_lat1[i] - sin_lat2[i]);
+                CT const L = math::sqr(sin_lat1[i] + sin_lat2[i]);
+
+                // As in andoyer_inverse, H and G are 0 for the same and for
+                // antipodal points
+                CT const one_minus_cos_d = c1 - cos_d;
+                CT const one_plus_cos_d = c1 + cos_d;
+                CT const H = one_minus_cos_d <= eps ? c0 : (d + three_sin_d) / one_minus_cos_d;
+                CT const G = one_plus_cos_d <= eps ? c0 : (d - three_sin_d) / one_plus_cos_d;
+
+                CT const distance = a * (d - f_4 * (H * K + G * L));
+                distances[first + i] = same ? c0 : distance;
+            }
+        }
+    }
+};
+
+template <typename CT>
+struct inverse_batch<thomas_inverse<CT, true, false, false, false, false> >
+{
+    template <typename T1, typename Spheroid>
+    static inline void apply(T1 const* lon1, T1 const* lat1,
+                             T1 const* lon2, T1 const* lat2,
+                             std::size_t count,
+                             Spheroid const& spheroid,
+                             CT* distances)
+    {
+        static const std::size_t block_size = detail::inverse_batch_block_size;
+
+        CT const c0 = 0;
+        CT const c1 = 1;
+        CT const c2 = 2;
+        CT const c4 = 4;
+        CT const eps = std::numeric_limits<CT>::epsilon();
+        CT const pi_half = math::pi<CT>() / c2;
+        CT const pi_half_eps = pi_half * eps;
+        CT const f = formula::flattening<CT>(spheroid);
+        CT const one_minus_f = c1 - f;
+        CT const f_4 = f / c4;
+        CT const f_sqr_per_64 = math::sqr(f) / CT(64);
+        CT const a = CT(get_radius<0>(spheroid));
+
+        CT theta_m[block_size], d_theta_m[block_size];
+        CT sin_theta_m[block_size], cos_theta_m[block_size];
+        CT sin_d_theta_m[block_size], cos_d_theta_m[block_size];
+        CT sin_d_lambda_m[block_size];
+
+        for (std::size_t first = 0; first < count; first += block_size)
+        {
+            std::size_t const n = (std::min)(block_size, count - first);
+
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                CT const la1 = CT(lat1[first + i]);
+                CT const la2 = CT(lat2[first + i]);
+
+                // The reduced latitudes, the same at the poles
+                CT const t1 = std::atan(one_minus_f * std::tan(la1));
+                CT const t2 = std::atan(one_minus_f * std::tan(la2));
+                CT const theta1 = std::abs(std::abs(la1) - pi_half) <= pi_half_eps ? la1 : t1;
+                CT const theta2 = std::abs(std::abs(la2) - pi_half) <= pi_half_eps ? la2 : t2;
+
+                theta_m[i] = (theta1 + theta2) / c2;
+                d_theta_m[i] = (theta2 - theta1) / c2;
+                sin_d_lambda_m[i] = std::sin((CT(lon2[first + i]) - CT(lon1[first + i])) / c2);
+            }
+
+            detail::inverse_batch_sin_cos(theta_m, n, sin_theta_m, cos_theta_m);
+            detail::inverse_batch_sin_cos(d_theta_m, n, sin_d_theta_m, cos_d_theta_m);
+
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                CT const sin2_theta_m = math::sqr(sin_theta_m[i]);
+                CT const cos2_theta_m = math::sqr(cos_theta_m[i]);
+                CT const sin2_d_theta_m = math::sqr(sin_d_theta_m[i]);
+                CT const cos2_d_theta_m = math::sqr(cos_d_theta_m[i]);
+                CT const sin2_d_lambda_m = math::sqr(sin_d_lambda_m[i]);
+
+                CT const H = cos2_theta_m - sin2_d_theta_m;
+                CT const L = sin2_d_theta_m + H * sin2_d_lambda_m;
+                CT const cos_d = c1 - c2 * L;
+                CT const d = std::acos(cos_d);
+                CT const sin_d = std::sin(d);
+                CT const one_minus_L = c1 - L;
+
+                // As in thomas_inverse, 0 for the same, very close and
+                // antipodal points, the values calculated for them below are
+                // not used
+                bool const degenerate = std::abs(sin_d) <= eps
+                                      | std::abs(L) <= eps
+                                      | std::abs(one_minus_L) <= eps;
+
+                CT const U = c2 * sin2_theta_m * cos2_d_theta_m / one_minus_L;
+                CT const V = c2 * sin2_d_theta_m * cos2_theta_m / L;
+                CT const X = U + V;
+                CT const Y = U - V;
+                CT const T = d / sin_d;
+                CT const D = c4 * math::sqr(T);
+                CT const E = c2 * cos_d;
+                CT const A = D * E;
+                CT const B = c2 * D;
+                CT const C = T - (A - E) / c2;
+
+                CT const n1 = X * (A + C * X);
+                CT const n2 = Y * (B + E * Y);
+                CT const n3 = D * X * Y;
+
+                CT const delta1d = f_4 * (T * X - Y);
+                CT const delta2d = f_sqr_per_64 * (n1 - n2 + n3);
+
+                CT const distance = a * sin_d * (T - delta1d + delta2d);
+                distances[first + i] = degenerate ? c0 : distance;
+            }
+        }
+    }
+};
+
+}}} // namespace boost::geometry::formula
+
+
+#endif // BOOST_GEOMETRY_FORMULAS_INVERSE_BATCH_HPP
@@ -0,0 +1,354 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_FORMULAS_INVERSE_MATRIX_HPP
+#define BOOST_GEOMETRY_FORMULAS_INVERSE_MATRIX_HPP
+
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include <boost/geometry/core/radius.hpp>
+
+#include <boost/geometry/formulas/andoyer_inverse.hpp>
+#include <boost/geometry/formulas/flattening.hpp>
+#include <boost/geometry/formulas/thomas_inverse.hpp>
+#include <boost/geometry/formulas/vincenty_inverse.hpp>
+
+#include <boost/geometry/util/math.hpp>
+#include <boost/geometry/util/parallel_for.hpp>
+
+
+namespace boost { namespace geometry { namespace formula
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+// The number of distances of a row calculated by one task
+static const std::size_t inverse_matrix_block_size = 256;
+
+template <typename CT>
+struct inverse_matrix_lon_lat
+{
+    CT lon;
+    CT lat;
+};
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief The solution of the inverse problem of geodesics between all points of
+       one set and all points of another set, distances only.
+\details The terms of the formula depending on one point only, e.g. the sines
+         and cosines of the latitudes or of the reduced latitudes, are
+         calculated once for each point by prepare() and the distances of the
+         pairs are calculated from the prepared points by apply_row(). By
+         default the prepared point is the longitude and the latitude and
+         the formula is applied to each pair, as for karney_inverse. The
+         terms are hoisted for andoyer_inverse, thomas_inverse and
+         vincenty_inverse.
+\tparam Inverse the formula, e.g. andoyer_inverse<double, true, false>
+*/
+template <typename Inverse>
+struct inverse_matrix
+{
+    typedef decltype(typename Inverse::result_type().distance) calc_t;
+    typedef detail::inverse_matrix_lon_lat<calc_t> point_type;
+
+    template <typename T, typename Spheroid>
+    static inline point_type prepare(T const& lon, T const& lat, Spheroid const& )
+    {
+        point_type const result = { calc_t(lon), calc_t(lat) };
+        return result;
+    }
+
+    template <typename Spheroid, typename CT>
+    static inline void apply_row(point_type const& point1,
+                                 point_type const* points2, std::size_t count2,
+                                 Spheroid const& spheroid,
+                                 CT* distances)
+    {
+        for (std::size_t j = 0; j < count2; ++j)
+        {
+            distances[j] = Inverse::apply(point1.lon, point1.lat,
+                                          points2[j].lon, points2[j].lat,
+                                          spheroid).distance;
+        }
+    }
+};
+
+template <typename CT>
+struct inverse_matrix<andoyer_inverse<CT, true, false, false, false, false> >
+{
+    struct point_type
+    {
+        CT lon, lat;
+        CT sin_lon, cos_lon;
+        CT sin_lat, cos_lat;
+    };
+
+    template <typename T, typename Spheroid>
+    static inline point_type prepare(T const& lon, T const& lat, Spheroid const& )
+    {
+        point_type const result = { CT(lon), CT(lat),
+                                    sin(CT(lon)), cos(CT(lon)),
+                                    sin(CT(lat)), cos(CT(lat)) };
+        return result;
+    }
+
+    template <typename Spheroid>
+    static inline void apply_row(point_type const& p1,
+                                 point_type const* points2, std::size_t count2,
+                                 Spheroid const& spheroid,
+                                 CT* distances)
+    {
+        CT const c0 = CT(0);
+        CT const c1 = CT(1);
+        CT const c3 = CT(3);
+        CT const f_4 = formula::flattening<CT>(spheroid) / CT(4);
+        CT const a = CT(get_radius<0>(spheroid));
+
+        for (std::size_t j = 0; j < count2; ++j)
+        {
+            point_type const& p2 = points2[j];
+
+            // As in andoyer_inverse
+            if ( math::equals(p1.lon, p2.lon) && math::equals(p1.lat, p2.lat) )
+            {
+                distances[j] = c0;
+                continue;
+            }
+
+            // cos(lon2 - lon1)
+            CT const cos_dlon = p2.cos_lon * p1.cos_lon + p2.sin_lon * p1.sin_lon;
+
+            CT cos_d = p1.sin_lat * p2.sin_lat + p1.cos_lat * p2.cos_lat * cos_dlon;
+            if (cos_d < -c1)
+                cos_d = -c1;
+            else if (cos_d > c1)
+                cos_d = c1;
+
+            CT const d = acos(cos_d);
+            CT const three_sin_d = c3 * sin(d);
+            CT const K = math::sqr(p1.sin_lat - p2.sin_lat);
+            CT const L = math::sqr(p1.sin_lat + p2.sin_lat);
+
+            CT const one_minus_cos_d = c1 - cos_d;
+            CT const one_plus_cos_d = c1 + cos_d;
+            CT const H = math::equals(one_minus_cos_d, c0) ?
+                            c0 :
+                            (d + three_sin_d) / one_minus_cos_d;
+            CT const G = math::equals(one_plus_cos_d, c0) ?
+                            c0 :
+                            (d - three_sin_d) / one_plus_cos_d;
+
+            distances[j] = a * (d - f_4 * (H * K + G * L));
+        }
+    }
+};
+
+template <typename CT>
+struct inverse_matrix<thomas_inverse<CT, true, false, false, false, false> >
+{
+    // The sines and cosines of the halves of the reduced latitude and of the
+    // longitude, those of the half sums and differences used by the formula
+    // are calculated from them
+    struct point_type
+    {
+        CT lon, lat;
+        CT sin_half_lon, cos_half_lon;
+        CT sin_half_theta, cos_half_theta;
+    };
+
+    template <typename T, typename Spheroid>
+    static inline point_type prepare(T const& lon, T const& lat, Spheroid const& spheroid)
+    {
+        CT const pi_half = math::pi<CT>() / CT(2);
+        CT const one_minus_f = CT(1) - formula::flattening<CT>(spheroid);
+
+        CT const theta = math::equals(CT(lat), pi_half) ? CT(lat) :
+                         math::equals(CT(lat), -pi_half) ? CT(lat) :
+                         atan(one_minus_f * tan(CT(lat)));
+
+        point_type const result = { CT(lon), CT(lat),
+                                    sin(CT(lon) / CT(2)), cos(CT(lon) / CT(2)),
+                                    sin(theta / CT(2)), cos(theta / CT(2)) };
+        return result;
+    }
+
+    template <typename Spheroid>
+    static inline void apply_row(point_type const& p1,
+                                 point_type const* points2, std::size_t count2,
+                                 Spheroid const& spheroid,
+                                 CT* distances)
+    {
+        CT const c0 = 0;
+        CT const c1 = 1;
+        CT const c2 = 2;
+        CT const c4 = 4;
+        CT const f = formula::flattening<CT>(spheroid);
+        CT const f_sqr_per_64 = math::sqr(f) / CT(64);
+        CT const a = get_radius<0>(spheroid);
+
+        for (std::size_t j = 0; j < count2; ++j)
+        {
+            point_type const& p2 = points2[j];
+
+            distances[j] = c0;
+
+            // As in thomas_inverse
+            if ( math::equals(p1.lon, p2.lon) && math::equals(p1.lat, p2.lat) )
+            {
+                continue;
+            }
+
+            // theta_m = (theta1 + theta2) / 2, d_theta_m = (theta2 - theta1) / 2
+            // and d_lambda_m = (lon2 - lon1) / 2
+            CT const sin_theta_m = p1.sin_half_theta * p2.cos_half_theta
+                                 + p1.cos_half_theta * p2.sin_half_theta;
+            CT const cos_theta_m = p1.cos_half_theta * p2.cos_half_theta
+                                 - p1.sin_half_theta * p2.sin_half_theta;
+            CT const sin_d_theta_m = p2.sin_half_theta * p1.cos_half_theta
+                                   - p2.cos_half_theta * p1.sin_half_theta;
+            CT const cos_d_theta_m = p2.cos_half_theta * p1.cos_half_theta
+                                   + p2.sin_half_theta * p1.sin_half_theta;
+            CT const sin_d_lambda_m = p2.sin_half_lon * p1.cos_half_lon
+                                    - p2.cos_half_lon * p1.sin_half_lon;
+
+            CT const sin2_theta_m = math::sqr(sin_theta_m);
+            CT const cos2_theta_m = math::sqr(cos_theta_m);
+            CT const sin2_d_theta_m = math::sqr(sin_d_theta_m);
+            CT const cos2_d_theta_m = math::sqr(cos_d_theta_m);
+            CT const sin2_d_lambda_m = math::sqr(sin_d_lambda_m);
+
+            CT const H = cos2_theta_m - sin2_d_theta_m;
+            CT const L = sin2_d_theta_m + H * sin2_d_lambda_m;
+            CT const cos_d = c1 - c2 * L;
+            CT const d = acos(cos_d);
+            CT const sin_d = sin(d);
+
+            CT const one_minus_L = c1 - L;
+
+            if ( math::equals(sin_d, c0)
+              || math::equals(L, c0)
+              || math::equals(one_minus_L, c0) )
+            {
+                continue;
+            }
+
+            CT const U = c2 * sin2_theta_m * cos2_d_theta_m / one_minus_L;
+            CT const V = c2 * sin2_d_theta_m * cos2_theta_m / L;
+            CT const X = U + V;
+            CT const Y = U - V;
+            CT const T = d / sin_d;
+            CT const D = c4 * math::sqr(T);
+            CT const E = c2 * cos_d;
+            CT const A = D * E;
+            CT const B = c2 * D;
+            CT const C = T - (A - E) / c2;
+
+            CT const n1 = X * (A + C*X);
+            CT const n2 = Y * (B + E*Y);
+            CT const n3 = D*X*Y;
+
+            CT const delta1d = f * (T*X-Y) / c4;
+            CT const delta2d = f_sqr_per_64 * (n1 - n2 + n3);
+
+            distances[j] = a * sin_d * (T - delta1d + delta2d);
+        }
+    }
+};
+
+template <typename CT>
+struct inverse_matrix<vincenty_inverse<CT, true, false, false, false, false> >
+{
+    typedef vincenty_inverse<CT, true, false, false, false, false> inverse_type;
+
+    struct point_type
+    {
+        CT lon, lat;
+        CT sin_U, cos_U;
+    };
+
+    template <typename T, typename Spheroid>
+    static inline point_type prepare(T const& lon, T const& lat, Spheroid const& spheroid)
+    {
+        point_type result = { CT(lon), CT(lat), CT(0), CT(0) };
+        inverse_type::reduced_latitude(result.lat, spheroid, result.sin_U, result.cos_U);
+        return result;
+    }
+
+    template <typename Spheroid>
+    static inline void apply_row(point_type const& p1,
+                                 point_type const* points2, std::size_t count2,
+                                 Spheroid const& spheroid,
+                                 CT* distances)
+    {
+        for (std::size_t j = 0; j < count2; ++j)
+        {
+            point_type const& p2 = points2[j];
+            distances[j] = inverse_type::apply(p1.lon, p1.lat, p1.sin_U, p1.cos_U,
+                                               p2.lon, p2.lat, p2.sin_U, p2.cos_U,
+                                               spheroid).distance;
+        }
+    }
+};
+
+
+/*!
+\brief Calculates the distances between all points of one set and all points
+       of another set, written row by row to a dense matrix.
+\details distances[i * count2 + j] is the distance between the point i of the
+         first set and the point j of the second set. The coordinates are
+         passed in arrays of longitudes and latitudes in radians. The rows
+         are divided into blocks calculated by thread_count threads, see
+         inverse_matrix.
+\tparam Inverse the formula, e.g. andoyer_inverse<double, true, false>
+*/
+template <typename Inverse, typename T1, typename T2, typename Spheroid, typename CT>
+inline void inverse_distance_matrix(T1 const* lon1, T1 const* lat1, std::size_t count1,
+                                    T2 const* lon2, T2 const* lat2, std::size_t count2,
+                                    Spheroid const& spheroid,
+                                    CT* distances,
+                                    std::size_t thread_count = 1)
+{
+    typedef inverse_matrix<Inverse> matrix_type;
+    typedef typename matrix_type::point_type point_type;
+
+    std::vector<point_type> points1, points2;
+    points1.reserve(count1);
+    points2.reserve(count2);
+    for (std::size_t i = 0; i < count1; ++i)
+    {
+        points1.push_back(matrix_type::prepare(lon1[i], lat1[i], spheroid));
+    }
+    for (std::size_t j = 0; j < count2; ++j)
+    {
+        points2.push_back(matrix_type::prepare(lon2[j], lat2[j], spheroid));
+    }
+
+    std::size_t const block_size = detail::inverse_matrix_block_size;
+    std::size_t const blocks = (count2 + block_size - 1) / block_size;
+    geometry::detail::parallel_for(count1 * blocks, thread_count, [&](std::size_t task)
+    {
+        std::size_t const i = task / blocks;
+        std::size_t const first = (task % blocks) * block_size;
+        std::size_t const count = (std::min)(block_size, count2 - first);
+        matrix_type::apply_row(points1[i], points2.data() + first, count,
+                               spheroid, distances + i * count2 + first);
+    });
+}
+
+}}} // namespace boost::geometry::formula
+
+
+#endif // BOOST_GEOMETRY_FORMULAS_INVERSE_MATRIX_HPP
@@ -0,0 +1,97 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_FORMULAS_KARNEY_CONSTANTS_HPP
+#define BOOST_GEOMETRY_FORMULAS_KARNEY_CONSTANTS_HPP
+
+
+#include <cstddef>
+
+#include <boost/geometry/core/radius.hpp>
+
+#include <boost/geometry/formulas/flattening.hpp>
+
+#include <boost/geometry/util/series_expansion.hpp>
+
+
+namespace boost { namespace geometry { namespace formula
+{
+
+/*!
+\brief The parameters of the spheroid and the coefficients of the series
+       expansions used by karney_inverse and karney_direct which depend only
+       on the spheroid.
+\details The formulas calculate them for each call if they are passed the
+         spheroid. They can be calculated once and passed instead of the
+         spheroid, e.g. by the geographic strategies. The constructor is
+         constexpr so the constants of a spheroid known at compile time
+         can be calculated at compile time, e.g. these of WGS84 returned
+         by karney_constants_wgs84().
+\tparam CT the calculation type
+\tparam SeriesOrder the order of the series expansions
+*/
+template <typename CT, std::size_t SeriesOrder = 8>
+struct karney_constants
+{
+    constexpr karney_constants(CT const& a, CT const& b)
+        : karney_constants(a, b, (a - b) / a)
+    {}
+
+    template <typename Spheroid>
+    explicit karney_constants(Spheroid const& spheroid)
+        : karney_constants(CT(get_radius<0>(spheroid)),
+                           CT(get_radius<2>(spheroid)),
+                           formula::flattening<CT>(spheroid))
+    {}
+
+    template <typename OtherCT>
+    explicit karney_constants(karney_constants<OtherCT, SeriesOrder> const& other)
+        : karney_constants(CT(other.m_a), CT(other.m_b), CT(other.m_f))
+    {}
+
+    CT m_a;   // equatorial radius
+    CT m_b;   // polar radius
+    CT m_f;   // flattening
+    CT m_n;   // third flattening
+    CT m_e2;  // squared eccentricity
+    CT m_ep2; // squared second eccentricity
+
+    // The coefficients of the series depending only on the third flattening.
+    // Index zero element of m_coeffs_C1 is unused.
+    series_expansion::coeffs_C1<SeriesOrder, CT> m_coeffs_C1;
+    series_expansion::coeffs_A3<SeriesOrder, CT> m_coeffs_A3;
+    series_expansion::coeffs_C3x<SeriesOrder, CT> m_coeffs_C3x;
+
+private:
+    constexpr karney_constants(CT const& a, CT const& b, CT const& f)
+        : m_a(a)
+        , m_b(b)
+        , m_f(f)
+        , m_n(f / (CT(2) - f))
+        , m_e2(f * (CT(2) - f))
+        , m_ep2(m_e2 / ((CT(1) - f) * (CT(1) - f)))
+        , m_coeffs_C1(m_n)
+        , m_coeffs_A3(m_n)
+        , m_coeffs_C3x(m_n)
+    {}
+};
+
+/*!
+\brief The constants of WGS84, the default spheroid of srs::spheroid
+\details E.g. constexpr auto wgs84 = karney_constants_wgs84<double>();
+\tparam CT the calculation type
+\tparam SeriesOrder the order of the series expansions
+*/
+template <typename CT, std::size_t SeriesOrder = 8>
+constexpr inline karney_constants<CT, SeriesOrder> karney_constants_wgs84()
+{
+    return karney_constants<CT, SeriesOrder>(CT(6378137.0), CT(6356752.3142451793));
+}
+
+}}} // namespace boost::geometry::formula
+
+
+#endif // BOOST_GEOMETRY_FORMULAS_KARNEY_CONSTANTS_HPP
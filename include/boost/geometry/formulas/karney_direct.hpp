@@ -37,6 +37,7 @@
 #include <boost/math/special_functions/hypot.hpp>
 
 #include <boost/geometry/formulas/flattening.hpp>
+#include <boost/geometry/formulas/karney_constants.hpp>
 #include <boost/geometry/formulas/result_direct.hpp>
 
 #include <boost/geometry/util/condition.hpp>
@@ -73,6 +74,7 @@ class karney_direct
 
 public:
     typedef result_direct<CT> result_type;
+    typedef karney_constants<CT, SeriesOrder> constants_type;
 
     template <typename T, typename Dist, typename Azi, typename Spheroid>
     static inline result_type apply(T const& lo1,
@@ -80,6 +82,18 @@ public:
                                     Dist const& distance,
                                     Azi const& azimuth12,
                                     Spheroid const& spheroid)
+    {
+        return apply(lo1, la1, distance, azimuth12, constants_type(spheroid));
+    }
+
+    // The same with the terms depending only on the spheroid calculated
+    // once, e.g. by the geographic strategies
+    template <typename T, typename Dist, typename Azi>
+    static inline result_type apply(T const& lo1,
+                                    T const& la1,
+                                    Dist const& distance,
+                                    Azi const& azimuth12,
+                                    constants_type const& constants)
     {
         result_type result;
 
@@ -93,14 +107,10 @@ public:
         CT const c1 = 1;
         CT const c2 = 2;
 
-        CT const b = CT(get_radius<2>(spheroid));
-        CT const f = formula::flattening<CT>(spheroid);
+        CT const b = constants.m_b;
+        CT const f = constants.m_f;
         CT const one_minus_f = c1 - f;
-        CT const two_minus_f = c2 - f;
-
-        CT const n = f / two_minus_f;
-        CT const e2 = f * two_minus_f;
-        CT const ep2 = e2 / math::sqr(one_minus_f);
+        CT const ep2 = constants.m_ep2;
 
         CT sin_alpha1, cos_alpha1;
         math::sin_cos_degrees<CT>(azi12, sin_alpha1, cos_alpha1);
@@ -186,12 +196,12 @@ public:
             CT const omega12 = atan2(sin_omega2 * cos_omega1 - cos_omega2 * sin_omega1,
                                      cos_omega2 * cos_omega1 + sin_omega2 * sin_omega1);
 
-            se::coeffs_A3<SeriesOrder, CT> const coeffs_A3(n);
+            se::coeffs_A3<SeriesOrder, CT> const& coeffs_A3 = constants.m_coeffs_A3;
 
             CT const A3 = math::horner_evaluate(epsilon, coeffs_A3.begin(), coeffs_A3.end());
             CT const A3c = -f * sin_alpha0 * A3;
 
-            se::coeffs_C3<SeriesOrder, CT> const coeffs_C3(n, epsilon);
+            se::coeffs_C3<SeriesOrder, CT> const coeffs_C3(constants.m_coeffs_C3x, epsilon);
 
             CT const B31 = se::sin_cos_series(sin_sigma1, cos_sigma1, coeffs_C3);
 
@@ -41,6 +41,7 @@
 #include <boost/geometry/util/normalize_spheroidal_coordinates.hpp>
 
 #include <boost/geometry/formulas/flattening.hpp>
+#include <boost/geometry/formulas/karney_constants.hpp>
 #include <boost/geometry/formulas/result_inverse.hpp>
 
 
@@ -97,6 +98,7 @@ class karney_inverse
 
 public:
     typedef result_inverse<CT> result_type;
+    typedef karney_constants<CT, SeriesOrder> constants_type;
 
     template <typename T1, typename T2, typename Spheroid>
     static inline result_type apply(T1 const& lo1,
@@ -104,6 +106,18 @@ public:
                                     T2 const& lo2,
                                     T2 const& la2,
                                     Spheroid const& spheroid)
+    {
+        return apply(lo1, la1, lo2, la2, constants_type(spheroid));
+    }
+
+    // The same with the terms depending only on the spheroid calculated
+    // once, e.g. by the geographic strategies
+    template <typename T1, typename T2>
+    static inline result_type apply(T1 const& lo1,
+                                    T1 const& la1,
+                                    T2 const& lo2,
+                                    T2 const& la2,
+                                    constants_type const& constants)
     {
         static CT const c0 = 0;
         static CT const c0_001 = 0.001;
@@ -128,11 +142,10 @@ public:
         CT lon1 = lo1 * r2d;
         CT lon2 = lo2 * r2d;
 
-        CT const a = CT(get_radius<0>(spheroid));
-        CT const b = CT(get_radius<2>(spheroid));
-        CT const f = formula::flattening<CT>(spheroid);
+        CT const a = constants.m_a;
+        CT const b = constants.m_b;
+        CT const f = constants.m_f;
         CT const one_minus_f = c1 - f;
-        CT const two_minus_f = c2 - f;
 
         CT const tol0 = std::numeric_limits<CT>::epsilon();
         CT const tol1 = c200 * tol0;
@@ -146,9 +159,8 @@ public:
 
         CT tiny = std::sqrt((std::numeric_limits<CT>::min)());
 
-        CT const n = f / two_minus_f;
-        CT const e2 = f * two_minus_f;
-        CT const ep2 = e2 / math::sqr(one_minus_f);
+        CT const n = constants.m_n;
+        CT const ep2 = constants.m_ep2;
 
         // Compute the longitudinal difference.
         CT lon12_error;
@@ -242,7 +254,7 @@ public:
         CT M21;
 
         // Index zero element of coeffs_C1 is unused.
-        se::coeffs_C1<SeriesOrder, CT> const coeffs_C1(n);
+        se::coeffs_C1<SeriesOrder, CT> const& coeffs_C1 = constants.m_coeffs_C1;
 
         bool meridian = lat1 == -90 || sin_lam12 == 0;
 
@@ -270,12 +282,17 @@ public:
             CT sigma12 = std::atan2((std::max)(c0, cos_sigma1 * sin_sigma2 - sin_sigma1 * cos_sigma2),
                                                    cos_sigma1 * cos_sigma2 + sin_sigma1 * sin_sigma2);
 
+            // The reduced length is needed below, also if it is not
+            // calculated by the formula.
             CT dummy;
-            meridian_length(n, ep2, sigma12, sin_sigma1, cos_sigma1, dn1,
-                                             sin_sigma2, cos_sigma2, dn2,
-                                             cos_beta1, cos_beta2, s12x,
-                                             m12x, dummy, result.geodesic_scale,
-                                             M21, coeffs_C1);
+            meridian_length
+                <
+                    true, true, EnableGeodesicScale
+                >(n, ep2, sigma12, sin_sigma1, cos_sigma1, dn1,
+                                   sin_sigma2, cos_sigma2, dn2,
+                                   cos_beta1, cos_beta2, s12x,
+                                   m12x, dummy, result.geodesic_scale,
+                                   M21, coeffs_C1);
 
             if (sigma12 < c1 || m12x >= c0)
             {
@@ -324,7 +341,7 @@ public:
                                    lam12, sin_lam12, cos_lam12,
                                    sin_alpha1, cos_alpha1,
                                    sin_alpha2, cos_alpha2,
-                                   dnm, coeffs_C1, ep2,
+                                   dnm, coeffs_C1, constants.m_coeffs_A3, ep2,
                                    tol1, tol2, etol2,
                                    n, f);
 
@@ -370,7 +387,8 @@ public:
                                     sin_sigma2, cos_sigma2,
                                     eps, diff_omega12,
                                     iteration < max_iterations,
-                                    dv, f, n, ep2, tiny, coeffs_C1);
+                                    dv, f, ep2, tiny,
+                                    constants.m_coeffs_A3, constants.m_coeffs_C3x);
 
                     // Reversed test to allow escape with NaNs.
                     if (tripb || !(std::abs(v) >= (tripn ? c8 : c1) * tol0))
@@ -484,7 +502,15 @@ public:
         return result;
     }
 
-    template <typename CoeffsC1>
+    // The distance, the reduced length and the geodesic scale are calculated
+    // if the corresponding flags are set, by default these of the formula.
+    template
+    <
+        bool CalcDistance = EnableDistance,
+        bool CalcReducedLength = EnableReducedLength,
+        bool CalcGeodesicScale = EnableGeodesicScale,
+        typename CoeffsC1
+    >
     static inline void meridian_length(CT const& epsilon, CT const& ep2, CT const& sigma12,
                                        CT const& sin_sigma1, CT const& cos_sigma1, CT const& dn1,
                                        CT const& sin_sigma2, CT const& cos_sigma2, CT const& dn2,
@@ -501,16 +527,16 @@ public:
         // Evaluate the coefficients for C2.
         se::coeffs_C2<SeriesOrder, CT> coeffs_C2(epsilon);
 
-        if (BOOST_GEOMETRY_CONDITION(EnableDistance) ||
-            BOOST_GEOMETRY_CONDITION(EnableReducedLength) ||
-            BOOST_GEOMETRY_CONDITION(EnableGeodesicScale))
+        if (BOOST_GEOMETRY_CONDITION(CalcDistance) ||
+            BOOST_GEOMETRY_CONDITION(CalcReducedLength) ||
+            BOOST_GEOMETRY_CONDITION(CalcGeodesicScale))
         {
             // Find the coefficients for A1 by computing the
             // series expansion using Horner scehme.
             expansion_A1 = se::evaluate_A1<SeriesOrder>(epsilon);
 
-            if (BOOST_GEOMETRY_CONDITION(EnableReducedLength) ||
-                BOOST_GEOMETRY_CONDITION(EnableGeodesicScale))
+            if (BOOST_GEOMETRY_CONDITION(CalcReducedLength) ||
+                BOOST_GEOMETRY_CONDITION(CalcGeodesicScale))
             {
                 // Find the coefficients for A2 by computing the
                 // series expansion using Horner scehme.
@@ -522,15 +548,15 @@ public:
             expansion_A1 += c1;
         }
 
-        if (BOOST_GEOMETRY_CONDITION(EnableDistance))
+        if (BOOST_GEOMETRY_CONDITION(CalcDistance))
         {
             CT B1 = se::sin_cos_series(sin_sigma2, cos_sigma2, coeffs_C1)
                   - se::sin_cos_series(sin_sigma1, cos_sigma1, coeffs_C1);
 
             s12x = expansion_A1 * (sigma12 + B1);
 
-            if (BOOST_GEOMETRY_CONDITION(EnableReducedLength) ||
-                BOOST_GEOMETRY_CONDITION(EnableGeodesicScale))
+            if (BOOST_GEOMETRY_CONDITION(CalcReducedLength) ||
+                BOOST_GEOMETRY_CONDITION(CalcGeodesicScale))
             {
                 CT B2 = se::sin_cos_series(sin_sigma2, cos_sigma2, coeffs_C2)
                       - se::sin_cos_series(sin_sigma1, cos_sigma1, coeffs_C2);
@@ -538,8 +564,8 @@ public:
                 J12 = A12x * sigma12 + (expansion_A1 * B1 - expansion_A2 * B2);
             }
         }
-        else if (BOOST_GEOMETRY_CONDITION(EnableReducedLength) ||
-                 BOOST_GEOMETRY_CONDITION(EnableGeodesicScale))
+        else if (BOOST_GEOMETRY_CONDITION(CalcReducedLength) ||
+                 BOOST_GEOMETRY_CONDITION(CalcGeodesicScale))
         {
             for (size_t i = 1; i <= SeriesOrder; ++i)
             {
@@ -552,7 +578,7 @@ public:
                   - se::sin_cos_series(sin_sigma1, cos_sigma1, coeffs_C2));
         }
 
-        if (BOOST_GEOMETRY_CONDITION(EnableReducedLength))
+        if (BOOST_GEOMETRY_CONDITION(CalcReducedLength))
         {
             m0 = A12x;
 
@@ -561,7 +587,7 @@ public:
                    cos_sigma1 * cos_sigma2 * J12;
         }
 
-        if (BOOST_GEOMETRY_CONDITION(EnableGeodesicScale))
+        if (BOOST_GEOMETRY_CONDITION(CalcGeodesicScale))
         {
             CT cos_sigma12 = cos_sigma1 * cos_sigma2 + sin_sigma1 * sin_sigma2;
             CT t = ep2 * (cos_beta1 - cos_beta2) *
@@ -578,13 +604,14 @@ public:
      doesn't need to be used, return also sin_alpha2 and
      cos_alpha2 and function value is sig12.
     */
-    template <typename CoeffsC1>
+    template <typename CoeffsC1, typename CoeffsA3>
     static inline CT newton_start(CT const& sin_beta1, CT const& cos_beta1, CT const& dn1,
                                   CT const& sin_beta2, CT const& cos_beta2, CT dn2,
                                   CT const& lam12, CT const& sin_lam12, CT const& cos_lam12,
                                   CT& sin_alpha1, CT& cos_alpha1,
                                   CT& sin_alpha2, CT& cos_alpha2,
-                                  CT& dnm, CoeffsC1 const& coeffs_C1, CT const& ep2,
+                                  CT& dnm, CoeffsC1 const& coeffs_C1,
+                                  CoeffsA3 const& coeffs_A3, CT const& ep2,
                                   CT const& tol1, CT const& tol2, CT const& etol2, CT const& n,
                                   CT const& f)
     {
@@ -678,8 +705,6 @@ public:
                 CT k2 = math::sqr(sin_beta1) * ep2;
                 CT eps = k2 / (c2 * (c1 + sqrt(c1 + k2)) + k2);
 
-                se::coeffs_A3<SeriesOrder, CT> const coeffs_A3(n);
-
                 CT const A3 = math::horner_evaluate(eps, coeffs_A3.begin(), coeffs_A3.end());
 
                 lambda_scale = f * cos_beta1 * A3 * pi;
@@ -696,11 +721,14 @@ public:
                 CT m12b = c0;
                 CT m0 = c1;
                 CT dummy;
-                meridian_length(n, ep2, pi + beta12a,
-                                sin_beta1, -cos_beta1, dn1,
-                                sin_beta2, cos_beta2, dn2,
-                                cos_beta1, cos_beta2, dummy,
-                                m12b, m0, dummy, dummy, coeffs_C1);
+                meridian_length
+                    <
+                        false, true, false
+                    >(n, ep2, pi + beta12a,
+                      sin_beta1, -cos_beta1, dn1,
+                      sin_beta2, cos_beta2, dn2,
+                      cos_beta1, cos_beta2, dummy,
+                      m12b, m0, dummy, dummy, coeffs_C1);
 
                 x = -c1 + m12b / (cos_beta1 * cos_beta2 * m0 * pi);
                 beta_scale = x < -c0_01
@@ -836,7 +864,7 @@ public:
         return k;
     }
 
-    template <typename CoeffsC1>
+    template <typename CoeffsA3, typename CoeffsC3x>
     static inline CT lambda12(CT const& sin_beta1, CT const& cos_beta1, CT const& dn1,
                               CT const& sin_beta2, CT const& cos_beta2, CT const& dn2,
                               CT const& sin_alpha1, CT cos_alpha1,
@@ -847,8 +875,8 @@ public:
                               CT& sin_sigma2, CT& cos_sigma2,
                               CT& eps, CT& diff_omega12,
                               bool diffp, CT& diff_lam12,
-                              CT const& f, CT const& n, CT const& ep2, CT const& tiny,
-                              CoeffsC1 const& coeffs_C1)
+                              CT const& f, CT const& ep2, CT const& tiny,
+                              CoeffsA3 const& coeffs_A3, CoeffsC3x const& coeffs_C3x)
     {
         static CT const c0 = 0;
         static CT const c1 = 1;
@@ -920,13 +948,11 @@ public:
 
         eps = k2 / (c2 * (c1 + std::sqrt(c1 + k2)) + k2);
 
-        se::coeffs_C3<SeriesOrder, CT> const coeffs_C3(n, eps);
+        se::coeffs_C3<SeriesOrder, CT> const coeffs_C3(coeffs_C3x, eps);
 
         B312 = se::sin_cos_series(sin_sigma2, cos_sigma2, coeffs_C3)
              - se::sin_cos_series(sin_sigma1, cos_sigma1, coeffs_C3);
 
-        se::coeffs_A3<SeriesOrder, CT> const coeffs_A3(n);
-
         CT const A3 = math::horner_evaluate(eps, coeffs_A3.begin(), coeffs_A3.end());
 
         diff_omega12 = -f * A3 * sin_alpha0 * (sigma12 + B312);
@@ -940,12 +966,18 @@ public:
             }
             else
             {
+                // The derivative is calculated from the reduced length, also
+                // if it is not calculated by the formula.
                 CT dummy;
-                meridian_length(eps, ep2, sigma12, sin_sigma1, cos_sigma1, dn1,
-                                                   sin_sigma2, cos_sigma2, dn2,
-                                                   cos_beta1, cos_beta2, dummy,
-                                                   diff_lam12, dummy, dummy,
-                                                   dummy, coeffs_C1);
+                se::coeffs_C1<SeriesOrder, CT> const coeffs_C1(eps);
+                meridian_length
+                    <
+                        false, true, false
+                    >(eps, ep2, sigma12, sin_sigma1, cos_sigma1, dn1,
+                                         sin_sigma2, cos_sigma2, dn2,
+                                         cos_beta1, cos_beta2, dummy,
+                                         diff_lam12, dummy, dummy,
+                                         dummy, coeffs_C1);
 
                 diff_lam12 *= one_minus_f / (cos_alpha2 * cos_beta2);
             }
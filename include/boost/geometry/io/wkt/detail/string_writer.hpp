@@ -0,0 +1,142 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKT_DETAIL_STRING_WRITER_HPP
+#define BOOST_GEOMETRY_IO_WKT_DETAIL_STRING_WRITER_HPP
+
+#include <clocale>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <locale>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+#include <boost/config.hpp>
+
+#ifndef BOOST_NO_CXX17_HDR_CHARCONV
+#include <charconv>
+#endif
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkt
+{
+
+// Appends a number in the shortest form which reads back to the same value,
+// independent of the locale
+template <typename T, typename Enable = void>
+struct append_number
+{
+    // Other types, such as multi-precision numbers, are streamed
+    static inline void apply(std::string& output, T const& value)
+    {
+        std::ostringstream out;
+        out.imbue(std::locale::classic());
+        out.precision(std::numeric_limits<T>::max_digits10);
+        out << value;
+        output += out.str();
+    }
+};
+
+template <typename T>
+struct append_number<T, std::enable_if_t<std::is_integral<T>::value> >
+{
+    static inline void apply(std::string& output, T const& value)
+    {
+        output += std::to_string(value);
+    }
+};
+
+template <typename T>
+struct append_number<T, std::enable_if_t<std::is_floating_point<T>::value> >
+{
+    static inline void apply(std::string& output, T const& value)
+    {
+        char buffer[64];
+#if defined(__cpp_lib_to_chars)
+        auto const r = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        output.append(buffer, r.ptr);
+#else
+        // Try increasing precisions until the value reads back the same
+        long double const ld = value;
+        int length = 0;
+        for (int digits = std::numeric_limits<T>::digits10;
+             digits <= std::numeric_limits<T>::max_digits10; digits++)
+        {
+            length = std::snprintf(buffer, sizeof(buffer), "%.*Lg", digits, ld);
+            if (static_cast<T>(std::strtold(buffer, nullptr)) == value)
+            {
+                break;
+            }
+        }
+
+        // The decimal point of the C locale might be different
+        char const point = *std::localeconv()->decimal_point;
+        if (point != '.')
+        {
+            char* p = std::strchr(buffer, point);
+            if (p != nullptr)
+            {
+                *p = '.';
+            }
+        }
+        output.append(buffer, length);
+#endif
+    }
+};
+
+
+/*!
+\brief Internal, appends WKT to a string, used instead of an output stream
+\details Supports the part of the stream interface used by the WKT writer.
+    Numbers are written in their shortest form which reads back to the
+    same value (using std::to_chars if available), independent of any locale.
+*/
+class string_writer
+{
+public :
+    explicit inline string_writer(std::string& output)
+        : m_output(output)
+    {}
+
+    inline string_writer& operator<<(char const* s)
+    {
+        m_output += s;
+        return *this;
+    }
+
+    inline string_writer& operator<<(char c)
+    {
+        m_output += c;
+        return *this;
+    }
+
+    template <typename T>
+    inline string_writer& operator<<(T const& value)
+    {
+        append_number<T>::apply(m_output, value);
+        return *this;
+    }
+
+private :
+    std::string& m_output;
+};
+
+
+}} // namespace detail::wkt
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_WKT_DETAIL_STRING_WRITER_HPP
@@ -0,0 +1,284 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKT_DETAIL_TOKENIZER_HPP
+#define BOOST_GEOMETRY_IO_WKT_DETAIL_TOKENIZER_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+#include <boost/config.hpp>
+
+#ifndef BOOST_NO_CXX17_HDR_CHARCONV
+#include <charconv>
+#endif
+
+#include <boost/lexical_cast.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/throw_exception.hpp>
+
+#include <boost/geometry/util/coordinate_cast.hpp>
+
+// Floating point from_chars is not available in all standard libraries
+// supporting <charconv>, __cpp_lib_to_chars is only defined if it is
+#if ! defined(BOOST_GEOMETRY_NO_FROM_CHARS) && defined(__cpp_lib_to_chars)
+#define BOOST_GEOMETRY_WKT_USE_FROM_CHARS
+#endif
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkt
+{
+
+/*!
+\brief Internal, a token of WKT, referring to the characters of the WKT
+    string without copying them
+*/
+class token_view
+{
+public :
+    using const_iterator = char const*;
+    using iterator = char const*;
+
+    inline token_view()
+        : m_begin(nullptr)
+        , m_end(nullptr)
+    {}
+
+    inline token_view(char const* begin, char const* end)
+        : m_begin(begin)
+        , m_end(end)
+    {}
+
+    inline char const* begin() const { return m_begin; }
+    inline char const* end() const { return m_end; }
+    inline std::size_t size() const { return m_end - m_begin; }
+
+    inline std::string str() const { return std::string(m_begin, m_end); }
+
+    // Compares with a zero-terminated string, such as "("
+    inline bool operator==(char const* s) const
+    {
+        std::size_t const n = size();
+        return std::strncmp(m_begin, s, n) == 0 && s[n] == '\0';
+    }
+
+    inline bool operator!=(char const* s) const
+    {
+        return ! operator==(s);
+    }
+
+private :
+    char const* m_begin;
+    char const* m_end;
+};
+
+
+/*!
+\brief Internal, iterates through the tokens of WKT, separated by whitespace,
+    where "(", ")" and "," are tokens themselves.
+\details Behaves as boost::tokenizer with char_separator(" \n\t\r", ",()"),
+    but does not allocate.
+*/
+class token_iterator
+{
+public :
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = token_view;
+    using difference_type = std::ptrdiff_t;
+    using pointer = token_view const*;
+    using reference = token_view const&;
+
+    inline token_iterator()
+        : m_next(nullptr)
+        , m_last(nullptr)
+    {}
+
+    inline token_iterator(char const* first, char const* last)
+        : m_next(first)
+        , m_last(last)
+    {
+        increment();
+    }
+
+    inline reference operator*() const { return m_token; }
+    inline pointer operator->() const { return &m_token; }
+
+    inline token_iterator& operator++()
+    {
+        increment();
+        return *this;
+    }
+
+    inline token_iterator operator++(int)
+    {
+        token_iterator result = *this;
+        increment();
+        return result;
+    }
+
+    inline bool operator==(token_iterator const& other) const
+    {
+        return m_token.begin() == other.m_token.begin();
+    }
+
+    inline bool operator!=(token_iterator const& other) const
+    {
+        return ! operator==(other);
+    }
+
+    // Returns the number of points in the coordinate sequence starting
+    // at the current "(", by counting commas until the first ")"
+    inline std::size_t count_points() const
+    {
+        std::size_t count = 1;
+        for (char const* it = m_token.end(); it != m_last && *it != ')'; ++it)
+        {
+            if (*it == ',')
+            {
+                count++;
+            }
+        }
+        return count;
+    }
+
+private :
+
+    static inline bool is_space(char c)
+    {
+        return c == ' ' || c == '\n' || c == '\t' || c == '\r';
+    }
+
+    static inline bool is_punctuation(char c)
+    {
+        return c == ',' || c == '(' || c == ')';
+    }
+
+    inline void increment()
+    {
+        while (m_next != m_last && is_space(*m_next))
+        {
+            ++m_next;
+        }
+        if (m_next == m_last)
+        {
+            // End, compares equal with the default constructed iterator
+            m_token = token_view();
+            return;
+        }
+
+        char const* const begin = m_next++;
+        if (! is_punctuation(*begin))
+        {
+            while (m_next != m_last && ! is_space(*m_next) && ! is_punctuation(*m_next))
+            {
+                ++m_next;
+            }
+        }
+        m_token = token_view(begin, m_next);
+    }
+
+    token_view m_token;
+    char const* m_next;
+    char const* m_last;
+};
+
+
+struct token_range
+{
+    using iterator = token_iterator;
+    using const_iterator = token_iterator;
+
+    inline token_iterator begin() const { return token_iterator(m_first, m_last); }
+    inline token_iterator end() const { return token_iterator(); }
+
+    char const* m_first;
+    char const* m_last;
+};
+
+inline token_range make_tokenizer(char const* first, char const* last)
+{
+    return token_range{first, last};
+}
+
+inline token_range make_tokenizer(std::string const& wkt)
+{
+    return make_tokenizer(wkt.data(), wkt.data() + wkt.size());
+}
+
+
+// Converts a token to a coordinate, by default using coordinate_cast
+template <typename CoordinateType, typename Enable = void>
+struct token_to_coordinate
+{
+    template <typename Token>
+    static inline CoordinateType apply(Token const& token)
+    {
+        return coordinate_cast<CoordinateType>::apply(
+            std::string(boost::begin(token), boost::end(token)));
+    }
+};
+
+#ifdef BOOST_GEOMETRY_WKT_USE_FROM_CHARS
+
+// For fundamental types, from_chars is used, which is faster and
+// independent of the locale
+template <typename CoordinateType>
+struct token_to_coordinate
+    <
+        CoordinateType,
+        std::enable_if_t
+            <
+                std::is_arithmetic<CoordinateType>::value
+                && ! std::is_same<CoordinateType, bool>::value
+            >
+    >
+{
+    static inline CoordinateType apply(token_view const& token)
+    {
+        char const* first = token.begin();
+        char const* const last = token.end();
+        if (first != last && *first == '+')
+        {
+            // Allowed in WKT, not by from_chars
+            ++first;
+        }
+
+        CoordinateType result = CoordinateType();
+        auto const r = std::from_chars(first, last, result);
+        if (r.ec != std::errc() || r.ptr != last)
+        {
+            // For consistency with lexical_cast, used otherwise
+            BOOST_THROW_EXCEPTION(boost::bad_lexical_cast());
+        }
+        return result;
+    }
+
+    static inline CoordinateType apply(std::string const& token)
+    {
+        return apply(token_view(token.data(), token.data() + token.size()));
+    }
+};
+
+#endif // BOOST_GEOMETRY_WKT_USE_FROM_CHARS
+
+
+}} // namespace detail::wkt
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_WKT_DETAIL_TOKENIZER_HPP
@@ -22,10 +22,11 @@
 #define BOOST_GEOMETRY_IO_WKT_READ_HPP
 
 #include <cstddef>
+#include <istream>
+#include <iterator>
 #include <string>
 
 #include <boost/lexical_cast.hpp>
-#include <boost/tokenizer.hpp>
 
 #include <boost/algorithm/string.hpp>
 #include <boost/range/begin.hpp>
@@ -55,6 +56,7 @@
 #include <boost/geometry/geometries/concepts/check.hpp>
 
 #include <boost/geometry/io/wkt/detail/prefix.hpp>
+#include <boost/geometry/io/wkt/detail/tokenizer.hpp>
 
 #include <boost/geometry/strategies/io/cartesian.hpp>
 #include <boost/geometry/strategies/io/geographic.hpp>
@@ -85,7 +87,7 @@ struct read_wkt_exception : public geometry::exception
         if (it != end)
         {
             source = " at '";
-            source += it->c_str();
+            source.append(boost::begin(*it), boost::end(*it));
             source += "'";
         }
         complete = message + source + " in '" + wkt.substr(0, 100) + "'";
@@ -117,14 +119,6 @@ private :
 namespace detail { namespace wkt
 {
 
-inline auto make_tokenizer(std::string const& wkt)
-{
-    using separator = boost::char_separator<char>;
-    using tokenizer = boost::tokenizer<separator>;
-    const tokenizer tokens(wkt, separator(" \n\t\r", ",()"));
-    return tokens;
-}
-
 template <typename Point,
           std::size_t Dimension = 0,
           std::size_t DimensionCount = geometry::dimension<Point>::value>
@@ -145,13 +139,11 @@ struct parsing_assigner
         {
             // Initialize missing coordinates to default constructor (zero)
             // OR
-            // Use lexical_cast for conversion to double/int
-            // Note that it is much slower than atof. However, it is more standard
-            // and in parsing the change in performance falls probably away against
-            // the tokenizing
+            // Use from_chars (if available) or lexical_cast for conversion
+            // to double/int, both are locale independent
             set<Dimension>(point, finished
                     ? coordinate_type()
-                    : coordinate_cast<coordinate_type>::apply(*it));
+                    : token_to_coordinate<coordinate_type>::apply(*it));
         }
         catch(boost::bad_lexical_cast const& blc)
         {
@@ -329,6 +321,34 @@ private:
     point_type first_point;
 };
 
+template <typename Range>
+inline auto reserve_points(Range& range, std::size_t count, int)
+    -> decltype(range.reserve(count), void())
+{
+    range.reserve(boost::size(range) + count);
+}
+
+template <typename Range>
+inline void reserve_points(Range& , std::size_t , long)
+{}
+
+// Reserves the points of the coordinate sequence, if the tokenizer can count
+// them and the range can reserve them
+template <typename Range>
+inline void reserve_points(token_iterator const& it, token_iterator const& end,
+                           Range& range)
+{
+    if (it != end && *it == "(")
+    {
+        reserve_points(range, it.count_points(), 0);
+    }
+}
+
+template <typename TokenizerIterator, typename Range>
+inline void reserve_points(TokenizerIterator const& , TokenizerIterator const& ,
+                           Range& )
+{}
+
 // Geometry is a value-type or reference-type
 template <typename Geometry>
 struct container_appender
@@ -341,6 +361,8 @@ struct container_appender
                              std::string const& wkt,
                              Geometry out)
     {
+        reserve_points(it, end, out);
+
         handle_open_parenthesis(it, end, wkt);
 
         stateful_range_appender<Geometry> appender;
@@ -1123,6 +1145,18 @@ struct read_wkt<DynamicGeometry, dynamic_geometry_tag>
         auto tokens{detail::wkt::make_tokenizer(wkt)};
         auto it = tokens.begin();
         auto end = tokens.end();
+
+        apply(it, end, wkt, dynamic_geometry);
+
+        detail::wkt::check_end(it, end, wkt);
+    }
+
+    template <typename TokenizerIterator>
+    static inline void apply(TokenizerIterator& it,
+                             TokenizerIterator const& end,
+                             std::string const& wkt,
+                             DynamicGeometry& dynamic_geometry)
+    {
         if (it == end)
         {
             BOOST_THROW_EXCEPTION(read_wkt_exception(
@@ -1134,8 +1168,6 @@ struct read_wkt<DynamicGeometry, dynamic_geometry_tag>
             <
                 DynamicGeometry, dispatch::read_wkt, detail::wkt::dynamic_move_assign
             >::apply(it, end, wkt, dynamic_geometry);
-
-        detail::wkt::check_end(it, end, wkt);
     }
 };
 
@@ -1224,6 +1256,67 @@ inline Geometry from_wkt(std::string const& wkt)
     return geometry;
 }
 
+/*!
+\brief Reads many geometries, in \ref WKT, from one buffer or stream
+\ingroup wkt
+\details The geometries are separated by whitespace, for example one
+    geometry per line. The buffer is parsed in one pass, without copying
+    tokens. A buffer passed as pointers or string is not copied and should
+    stay valid while reading, a stream is read into a buffer first.
+\tparam Geometry \tparam_geometry
+*/
+template <typename Geometry>
+class wkt_reader
+{
+    using tokenizer_type = detail::wkt::token_range;
+    using iterator_type = typename tokenizer_type::iterator;
+
+public :
+
+    wkt_reader(char const* first, char const* last)
+        : m_it(detail::wkt::make_tokenizer(first, last).begin())
+    {}
+
+    explicit wkt_reader(std::string const& buffer)
+        : wkt_reader(buffer.data(), buffer.data() + buffer.size())
+    {}
+
+    // The string is not copied, so a temporary would be destructed
+    // before reading
+    explicit wkt_reader(std::string&& buffer) = delete;
+
+    explicit wkt_reader(std::istream& stream)
+        : m_buffer(std::istreambuf_iterator<char>(stream),
+                   std::istreambuf_iterator<char>())
+        , m_it(detail::wkt::make_tokenizer(m_buffer).begin())
+    {}
+
+    wkt_reader(wkt_reader const&) = delete;
+    wkt_reader& operator=(wkt_reader const&) = delete;
+
+    //! Reads the next geometry, returns false if there are no more geometries
+    inline bool read(Geometry& geometry)
+    {
+        geometry::concepts::check<Geometry>();
+
+        if (m_it == m_end)
+        {
+            return false;
+        }
+
+        // The buffer is not passed as context for exceptions, those mention
+        // the token where parsing failed
+        geometry::clear(geometry);
+        dispatch::read_wkt<Geometry>::apply(m_it, m_end, std::string(), geometry);
+        return true;
+    }
+
+private :
+    std::string m_buffer;
+    iterator_type m_it;
+    iterator_type m_end;
+};
+
 }} // namespace boost::geometry
 
 #endif // BOOST_GEOMETRY_IO_WKT_READ_HPP
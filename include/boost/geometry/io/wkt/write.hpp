@@ -47,6 +47,7 @@
 #include <boost/geometry/geometries/ring.hpp>
 
 #include <boost/geometry/io/wkt/detail/prefix.hpp>
+#include <boost/geometry/io/wkt/detail/string_writer.hpp>
 
 #include <boost/geometry/strategies/io/cartesian.hpp>
 #include <boost/geometry/strategies/io/geographic.hpp>
@@ -72,8 +73,8 @@ namespace detail { namespace wkt
 template <typename P, int I, int Count>
 struct stream_coordinate
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os, P const& p)
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os, P const& p)
     {
         os << (I > 0 ? " " : "") << get<I>(p);
         stream_coordinate<P, I + 1, Count>::apply(os, p);
@@ -83,8 +84,8 @@ struct stream_coordinate
 template <typename P, int Count>
 struct stream_coordinate<P, Count, Count>
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>&, P const&)
+    template <typename OutputStream>
+    static inline void apply(OutputStream&, P const&)
     {}
 };
 
@@ -94,8 +95,8 @@ struct stream_coordinate<P, Count, Count>
 template <typename Point, typename Policy>
 struct wkt_point
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os, Point const& p, bool)
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os, Point const& p, bool)
     {
         os << Policy::apply() << "(";
         stream_coordinate<Point, 0, dimension<Point>::type::value>::apply(os, p);
@@ -115,8 +116,8 @@ template
 >
 struct wkt_range
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 Range const& range, bool force_closure = ForceClosurePossible)
     {
         using stream_type = stream_coordinate
@@ -195,8 +196,8 @@ struct wkt_sequence
 template <typename Polygon, typename PrefixPolicy>
 struct wkt_poly
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 Polygon const& poly, bool force_closure)
     {
         using ring = typename ring_type<Polygon const>::type;
@@ -231,8 +232,8 @@ struct wkt_poly
 template <typename Multi, typename StreamPolicy, typename PrefixPolicy>
 struct wkt_multi
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 Multi const& geometry, bool force_closure)
     {
         os << PrefixPolicy::apply();
@@ -256,8 +257,8 @@ struct wkt_box
 {
     using point_type = typename point_type<Box>::type;
 
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 Box const& box, bool force_closure)
     {
         // Convert to a clockwire ring, then stream.
@@ -281,8 +282,8 @@ struct wkt_box
             //assert_dimension<B, 2>();
         }
 
-        template <typename RingType, typename Char, typename Traits>
-        static inline void do_apply(std::basic_ostream<Char, Traits>& os,
+        template <typename RingType, typename OutputStream>
+        static inline void do_apply(OutputStream& os,
                     Box const& box)
         {
             RingType ring;
@@ -300,8 +301,8 @@ struct wkt_segment
 {
     using point_type = typename point_type<Segment>::type;
 
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 Segment const& segment, bool)
     {
         // Convert to two points, then stream
@@ -588,6 +589,48 @@ inline std::string to_wkt(Geometry const& geometry, int significant_digits)
     return ss.str();
 }
 
+/*!
+\brief Appends the \ref WKT of a geometry to a string
+\details Faster than streaming. Coordinates are written in their shortest
+    form which reads back to the same value (using std::to_chars if
+    available), independent of any locale.
+\tparam Geometry \tparam_geometry
+\param output string to which the WKT is appended
+\param geometry \param_geometry
+\ingroup wkt
+*/
+template <typename Geometry>
+inline void append_wkt(std::string& output, Geometry const& geometry)
+{
+    concepts::check<Geometry const>();
+
+    // As wkt(), close polygons explicitly, but not rings
+    detail::wkt::string_writer writer(output);
+    dispatch::wkt<Geometry>::apply(writer, geometry,
+                                   ! util::is_ring<Geometry>::value);
+}
+
+/*!
+\brief Appends the \ref WKT of all geometries in a range to a string
+\details Each geometry is followed by the separator, by default a newline,
+    such that the output can be read by wkt_reader. See also append_wkt.
+\tparam Geometries range of geometries
+\param output string to which the WKT is appended
+\param geometries range of geometries
+\param separator text written after each geometry
+\ingroup wkt
+*/
+template <typename Geometries>
+inline void append_wkt_all(std::string& output, Geometries const& geometries,
+                           char const* separator = "\n")
+{
+    for (auto const& geometry : geometries)
+    {
+        append_wkt(output, geometry);
+        output += separator;
+    }
+}
+
 #if defined(_MSC_VER)
 #pragma warning(pop)  
 #endif
@@ -13,6 +13,7 @@
 #ifndef BOOST_GEOMETRY_POLICIES_ROBUSTNESS_SEGMENT_RATIO_HPP
 #define BOOST_GEOMETRY_POLICIES_ROBUSTNESS_SEGMENT_RATIO_HPP
 
+#include <limits>
 #include <type_traits>
 
 #include <boost/config.hpp>
@@ -29,10 +30,12 @@ namespace boost { namespace geometry
 namespace detail { namespace segment_ratio
 {
 
+// Also Boost.Multiprecision integers, used for promoted integral coordinates,
+// are compared as rationals
 template
 <
     typename Type,
-    bool IsIntegral = std::is_integral<Type>::type::value
+    bool IsIntegral = std::numeric_limits<Type>::is_integer
 >
 struct less {};
 
@@ -65,7 +68,7 @@ struct less<Type, false>
 template
 <
     typename Type,
-    bool IsIntegral = std::is_integral<Type>::type::value
+    bool IsIntegral = std::numeric_limits<Type>::is_integer
 >
 struct equal {};
 
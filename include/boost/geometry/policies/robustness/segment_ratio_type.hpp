@@ -20,6 +20,7 @@
 
 #include <boost/config.hpp>
 
+#include <boost/geometry/core/coordinate_promotion.hpp>
 #include <boost/geometry/core/coordinate_type.hpp>
 #include <boost/geometry/policies/robustness/rescale_policy_tags.hpp>
 
@@ -31,7 +32,9 @@ template <typename Point, typename Policy>
 struct segment_ratio_type
 {
     // Type in segment ratio is either the coordinate type, or for
-    // deprecated robust point types it is a long_long type
+    // deprecated robust point types it is a long_long type.
+    // Signed integral coordinates are promoted, because the numerator
+    // and denominator are products of coordinate differences.
     typedef std::conditional_t
         <
             std::is_same
@@ -39,7 +42,10 @@ struct segment_ratio_type
                     typename rescale_policy_type<Policy>::type,
                     no_rescale_policy_tag
                 >::value,
-            typename geometry::coordinate_type<Point>::type,
+            typename promoted_to_exact_integral
+                <
+                    typename geometry::coordinate_type<Point>::type
+                >::type,
             boost::long_long_type
         > coordinate_type;
 
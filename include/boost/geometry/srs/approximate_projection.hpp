@@ -0,0 +1,417 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_SRS_APPROXIMATE_PROJECTION_HPP
+#define BOOST_GEOMETRY_SRS_APPROXIMATE_PROJECTION_HPP
+
+
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/radian_access.hpp>
+#include <boost/geometry/core/static_assert.hpp>
+#include <boost/geometry/geometries/point.hpp>
+#include <boost/geometry/srs/projection.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+namespace srs
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+// Quadtree of cells covering a region of lon / lat in radians. Each leaf
+// stores the projected corners of the cell and is either interpolated
+// bilinearly or, if the interpolation is not accurate enough at the maximum
+// depth or the projection fails inside the cell, projected exactly.
+template <typename CT>
+class approximate_projection_grid
+{
+    // The points at which the interpolation is compared with the projection,
+    // as fractions of the cell. The first five are the centers of the edges
+    // and the center of the cell, the corners of the children.
+    static const std::size_t probe_count = 9;
+
+    struct node
+    {
+        CT x[4];
+        CT y[4];
+        // first of 4 children, 0 if interpolated, -1 if projected exactly
+        int children;
+    };
+
+public:
+    approximate_projection_grid()
+        : m_lon0(0), m_lat0(0), m_lon1(0), m_lat1(0)
+    {}
+
+    // Project is called as project(coords, count) with count points stored
+    // as lon / lat in radians, projected in place, HUGE_VAL if not projected
+    template <typename Project>
+    approximate_projection_grid(CT const& lon0, CT const& lat0,
+                                CT const& lon1, CT const& lat1,
+                                CT const& max_error, std::size_t max_depth,
+                                Project const& project)
+        : m_lon0(lon0), m_lat0(lat0), m_lon1(lon1), m_lat1(lat1)
+    {
+        if (! (lon0 < lon1 && lat0 < lat1))
+        {
+            return;
+        }
+
+        CT coords[8] = { lon0, lat0, lon1, lat0, lon0, lat1, lon1, lat1 };
+        project(coords, 4);
+
+        m_nodes.resize(1);
+        build(0, lon0, lat0, lon1, lat1, coords, max_error * max_error, max_depth, project);
+    }
+
+    // Returns false if the point has to be projected exactly
+    inline bool apply(CT const& lon, CT const& lat, CT & x, CT & y) const
+    {
+        if (m_nodes.empty()
+            || ! (lon >= m_lon0 && lon <= m_lon1 && lat >= m_lat0 && lat <= m_lat1))
+        {
+            return false;
+        }
+
+        CT lon0 = m_lon0, lat0 = m_lat0, lon1 = m_lon1, lat1 = m_lat1;
+        node const* n = &m_nodes.front();
+        while (n->children > 0)
+        {
+            CT const lon_mid = (lon0 + lon1) / 2;
+            CT const lat_mid = (lat0 + lat1) / 2;
+            int q = 0;
+            if (lon < lon_mid) { lon1 = lon_mid; } else { lon0 = lon_mid; q += 1; }
+            if (lat < lat_mid) { lat1 = lat_mid; } else { lat0 = lat_mid; q += 2; }
+            n = &m_nodes[n->children + q];
+        }
+
+        if (n->children < 0)
+        {
+            return false;
+        }
+
+        interpolate(*n, (lon - lon0) / (lon1 - lon0), (lat - lat0) / (lat1 - lat0), x, y);
+        return true;
+    }
+
+private:
+    static inline void interpolate(node const& n, CT const& u, CT const& v, CT & x, CT & y)
+    {
+        CT const w0 = (1 - u) * (1 - v);
+        CT const w1 = u * (1 - v);
+        CT const w2 = (1 - u) * v;
+        CT const w3 = u * v;
+        x = w0 * n.x[0] + w1 * n.x[1] + w2 * n.x[2] + w3 * n.x[3];
+        y = w0 * n.y[0] + w1 * n.y[1] + w2 * n.y[2] + w3 * n.y[3];
+    }
+
+    // corners contains the projected corners, (lon0, lat0), (lon1, lat0),
+    // (lon0, lat1) and (lon1, lat1)
+    template <typename Project>
+    void build(std::size_t index, CT const& lon0, CT const& lat0,
+               CT const& lon1, CT const& lat1, CT const* corners,
+               CT const& max_error_sqr, std::size_t depth, Project const& project)
+    {
+        static const CT probe_u[probe_count] = { 0.5, 0, 1, 0.5, 0.5, 0.25, 0.75, 0.25, 0.75 };
+        static const CT probe_v[probe_count] = { 0, 0.5, 0.5, 1, 0.5, 0.25, 0.25, 0.75, 0.75 };
+
+        node n;
+        std::size_t invalid_corners = 0;
+        for (std::size_t i = 0; i < 4; i++)
+        {
+            n.x[i] = corners[2 * i];
+            n.y[i] = corners[2 * i + 1];
+            if (n.x[i] == HUGE_VAL)
+            {
+                invalid_corners++;
+            }
+        }
+
+        // Outside of the domain of the projection, not divided further
+        if (invalid_corners == 4)
+        {
+            n.children = -1;
+            m_nodes[index] = n;
+            return;
+        }
+        bool valid = invalid_corners == 0;
+
+        CT probes[2 * probe_count];
+        for (std::size_t i = 0; i < probe_count; i++)
+        {
+            probes[2 * i] = lon0 + probe_u[i] * (lon1 - lon0);
+            probes[2 * i + 1] = lat0 + probe_v[i] * (lat1 - lat0);
+        }
+        project(probes, probe_count);
+
+        for (std::size_t i = 0; i < probe_count && valid; i++)
+        {
+            CT x, y;
+            interpolate(n, probe_u[i], probe_v[i], x, y);
+            CT const dx = x - probes[2 * i];
+            CT const dy = y - probes[2 * i + 1];
+            // Also false for HUGE_VAL and NaN
+            valid = dx * dx + dy * dy <= max_error_sqr;
+        }
+
+        if (valid || depth == 0)
+        {
+            n.children = valid ? 0 : -1;
+            m_nodes[index] = n;
+            return;
+        }
+
+        std::size_t const children = m_nodes.size();
+        n.children = static_cast<int>(children);
+        m_nodes[index] = n;
+        m_nodes.resize(children + 4);
+
+        // The corners of the children, 3 x 3 points from (lon0, lat0)
+        CT const lattice[18] = {
+            n.x[0], n.y[0], probes[0], probes[1], n.x[1], n.y[1],
+            probes[2], probes[3], probes[8], probes[9], probes[4], probes[5],
+            n.x[2], n.y[2], probes[6], probes[7], n.x[3], n.y[3]
+        };
+        CT const lon_mid = (lon0 + lon1) / 2;
+        CT const lat_mid = (lat0 + lat1) / 2;
+        for (std::size_t q = 0; q < 4; q++)
+        {
+            std::size_t const i = q % 2;
+            std::size_t const j = q / 2;
+            CT const child_corners[8] = {
+                lattice[2 * (3 * j + i)], lattice[2 * (3 * j + i) + 1],
+                lattice[2 * (3 * j + i + 1)], lattice[2 * (3 * j + i + 1) + 1],
+                lattice[2 * (3 * (j + 1) + i)], lattice[2 * (3 * (j + 1) + i) + 1],
+                lattice[2 * (3 * (j + 1) + i + 1)], lattice[2 * (3 * (j + 1) + i + 1) + 1]
+            };
+            build(children + q,
+                  i == 0 ? lon0 : lon_mid, j == 0 ? lat0 : lat_mid,
+                  i == 0 ? lon_mid : lon1, j == 0 ? lat_mid : lat1,
+                  child_corners, max_error_sqr, depth - 1, project);
+        }
+    }
+
+    CT m_lon0, m_lat0, m_lon1, m_lat1;
+    std::vector<node> m_nodes;
+};
+
+// The interface of the internal projection used by project_geometry
+template <typename Projection, typename CT>
+class approximate_forward_projection
+{
+    typedef model::point<CT, 2, cs::geographic<radian> > ll_type;
+    typedef model::point<CT, 2, cs::cartesian> xy_type;
+
+public:
+    struct calc_params
+    {
+        typedef CT type;
+    };
+
+    approximate_forward_projection(Projection const& projection,
+                                   approximate_projection_grid<CT> const& grid)
+        : m_projection(projection)
+        , m_grid(grid)
+    {}
+
+    calc_params params() const
+    {
+        return calc_params();
+    }
+
+    template <typename LL, typename XY>
+    inline bool forward(LL const& ll, XY & xy) const
+    {
+        CT x, y;
+        if (m_grid.apply(geometry::get_as_radian<0>(ll), geometry::get_as_radian<1>(ll), x, y))
+        {
+            geometry::set<0>(xy, x);
+            geometry::set<1>(xy, y);
+            return true;
+        }
+        return m_projection.forward(ll, xy);
+    }
+
+    inline void forward_n(CT* coords, std::size_t count) const
+    {
+        for (std::size_t i = 0; i < count; i++)
+        {
+            CT & x = coords[2 * i];
+            CT & y = coords[2 * i + 1];
+            if (! m_grid.apply(x, y, x, y))
+            {
+                xy_type xy;
+                if (m_projection.forward(ll_type(x, y), xy))
+                {
+                    x = geometry::get<0>(xy);
+                    y = geometry::get<1>(xy);
+                }
+                else
+                {
+                    x = y = HUGE_VAL;
+                }
+            }
+        }
+    }
+
+private:
+    Projection const& m_projection;
+    approximate_projection_grid<CT> const& m_grid;
+};
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+    \brief Approximate projection
+    \details Projects points forward by bilinear interpolation of the
+        projection in a grid covering a region of Latitude-Longitude, like the
+        approximate transformer of GDAL. The grid is built once, cells are
+        divided until the interpolation differs from the projection by at most
+        the maximum error at the centers of the edges and other points of the
+        cells, or the maximum depth is reached. The points outside of the
+        region and in the cells which are not accurate enough at the maximum
+        depth, or where the projection fails, are projected exactly. The
+        inverse projection is always exact.
+    \ingroup projection
+    \tparam Parameters default dynamic tag or static projection parameters
+    \tparam CT calculation type used internally
+*/
+template
+<
+    typename Parameters = srs::dynamic,
+    typename CT = double
+>
+class approximate_projection
+{
+public:
+    typedef srs::projection<Parameters, CT> projection_type;
+
+    /*!
+    \brief Builds the grid of the projection covering the region
+    \param projection the projection which is approximated
+    \param region the box of Latitude-Longitude covered by the grid
+    \param max_error the maximum distance between the interpolated and the
+        projected point, in the units of the projection
+    \param max_depth the maximum number of times the region is divided,
+        at most 4^max_depth cells are created
+    */
+    template <typename Box>
+    approximate_projection(projection_type const& projection,
+                           Box const& region,
+                           CT const& max_error,
+                           std::size_t max_depth = 10)
+        : m_projection(projection)
+        , m_grid(geometry::get_as_radian<min_corner, 0>(region),
+                 geometry::get_as_radian<min_corner, 1>(region),
+                 geometry::get_as_radian<max_corner, 0>(region),
+                 geometry::get_as_radian<max_corner, 1>(region),
+                 max_error, max_depth,
+                 [&](CT* coords, std::size_t count)
+                 {
+                     std::vector<ll_type> ll;
+                     ll.reserve(count);
+                     for (std::size_t i = 0; i < count; i++)
+                     {
+                         ll.emplace_back(coords[2 * i], coords[2 * i + 1]);
+                     }
+                     std::vector<xy_type> xy(count);
+                     m_projection.forward(ll.begin(), ll.end(), xy.begin());
+                     for (std::size_t i = 0; i < count; i++)
+                     {
+                         coords[2 * i] = geometry::get<0>(xy[i]);
+                         coords[2 * i + 1] = geometry::get<1>(xy[i]);
+                     }
+                 })
+    {}
+
+    /// Approximate forward projection, from Latitude-Longitude to Cartesian
+    template <typename LL, typename XY>
+    inline bool forward(LL const& ll, XY& xy) const
+    {
+        BOOST_GEOMETRY_STATIC_ASSERT(
+            (projections::detail::same_tags<LL, XY>::value),
+            "Not supported combination of Geometries.",
+            LL, XY);
+
+        concepts::check_concepts_and_equal_dimensions<LL const, XY>();
+
+        return projections::detail::project_geometry
+                <
+                    LL,
+                    projections::detail::forward_point_projection_policy
+                >::apply(ll, xy, forward_projection());
+    }
+
+    /// Approximate forward projection of a range of points, from
+    /// Latitude-Longitude to Cartesian, written to the points starting at out
+    template <typename LLIt, typename XYIt>
+    inline bool forward(LLIt first, LLIt last, XYIt out) const
+    {
+        typedef typename std::iterator_traits<LLIt>::value_type ll_type;
+        typedef typename std::iterator_traits<XYIt>::value_type xy_type;
+
+        concepts::check_concepts_and_equal_dimensions<ll_type const, xy_type>();
+
+        return projections::detail::project_points
+                <
+                    projections::detail::forward_point_projection_policy
+                >::apply(first, last, out, forward_projection());
+    }
+
+    /// Exact inverse projection, from Cartesian to Latitude-Longitude
+    template <typename XY, typename LL>
+    inline bool inverse(XY const& xy, LL& ll) const
+    {
+        return m_projection.inverse(xy, ll);
+    }
+
+    /// Exact inverse projection of a range of points, from Cartesian to
+    /// Latitude-Longitude, written to the points starting at out
+    template <typename XYIt, typename LLIt>
+    inline bool inverse(XYIt first, XYIt last, LLIt out) const
+    {
+        return m_projection.inverse(first, last, out);
+    }
+
+    /// Returns the exact projection
+    projection_type const& projection() const
+    {
+        return m_projection;
+    }
+
+private:
+    typedef model::point<CT, 2, cs::geographic<radian> > ll_type;
+    typedef model::point<CT, 2, cs::cartesian> xy_type;
+
+    detail::approximate_forward_projection<projection_type, CT> forward_projection() const
+    {
+        return detail::approximate_forward_projection<projection_type, CT>(m_projection, m_grid);
+    }
+
+    projection_type m_projection;
+    detail::approximate_projection_grid<CT> m_grid;
+};
+
+
+} // namespace srs
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_SRS_APPROXIMATE_PROJECTION_HPP
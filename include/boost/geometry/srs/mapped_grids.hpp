@@ -0,0 +1,149 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_SRS_MAPPED_GRIDS_HPP
+#define BOOST_GEOMETRY_SRS_MAPPED_GRIDS_HPP
+
+
+#include <boost/geometry/srs/projections/grids.hpp>
+
+#include <boost/interprocess/exceptions.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+
+namespace boost { namespace geometry
+{
+
+namespace srs
+{
+
+/*!
+    \brief Grids memory mapped from their files and decoded lazily
+    \details The headers of a grid file are read by the stream policy of
+        the grids storage when the grids are initialized. If the stream
+        policy is ifstream_policy the file is then mapped, with the grid
+        name as its path, and the shift values are decoded in tiles of rows
+        when a point falls into them. Looking up the grids and the shift
+        values does not lock, so the grids can be used by several threads
+        at once, e.g. by a parallel transformation. Grids read by other
+        stream policies, or which can not be mapped, are loaded completely
+        when they are initialized.
+    \ingroup srs
+*/
+class mapped_grids
+{
+    typedef projections::detail::pj_gridinfo gridinfo_type;
+
+public:
+    typedef projections::detail::mapped_grids_tag tag;
+    typedef std::shared_ptr<interprocess::mapped_region const> mapped_file_ptr;
+
+    mapped_grids()
+    {
+        m_versions.emplace_back(new gridinfo_type);
+        m_published.store(m_versions.back().get(), std::memory_order_release);
+    }
+
+    std::size_t size() const
+    {
+        return published_gridinfo().size();
+    }
+
+    bool empty() const
+    {
+        return published_gridinfo().empty();
+    }
+
+    // The grids published last, which are not modified anymore
+    gridinfo_type & published_gridinfo() const
+    {
+        return *m_published.load(std::memory_order_acquire);
+    }
+
+    // Only the files opened by ifstream_policy are mapped, with the grid
+    // name as their path. The grids read by other stream policies can not
+    // be mapped so they are loaded completely.
+    template <typename StreamPolicy>
+    static mapped_file_ptr map_file(StreamPolicy const& ,
+                                    std::string const& )
+    {
+        return mapped_file_ptr();
+    }
+
+    static mapped_file_ptr map_file(srs::ifstream_policy const& ,
+                                    std::string const& filename)
+    {
+        try
+        {
+            interprocess::file_mapping file(filename.c_str(), interprocess::read_only);
+            return std::make_shared<interprocess::mapped_region>(file, interprocess::read_only);
+        }
+        catch (interprocess::interprocess_exception const&)
+        {
+            return mapped_file_ptr();
+        }
+    }
+
+    static char const* file_data(interprocess::mapped_region const& file)
+    {
+        return static_cast<char const*>(file.get_address());
+    }
+
+    static std::size_t file_size(interprocess::mapped_region const& file)
+    {
+        return file.get_size();
+    }
+
+    // Copy of the published grids, published again by publish()
+    struct write_locked
+    {
+        write_locked(mapped_grids & g)
+            : m_lock(g.m_mutex)
+            , m_grids(g)
+            , m_gridinfo(new gridinfo_type(g.published_gridinfo()))
+            , gridinfo(*m_gridinfo)
+        {}
+
+        void publish()
+        {
+            m_grids.m_versions.push_back(std::move(m_gridinfo));
+            m_grids.m_published.store(m_grids.m_versions.back().get(),
+                                      std::memory_order_release);
+        }
+
+    private:
+        std::lock_guard<std::mutex> m_lock;
+        mapped_grids & m_grids;
+        std::unique_ptr<gridinfo_type> m_gridinfo;
+
+    public:
+        gridinfo_type & gridinfo;
+    };
+
+private:
+    // The previous versions are kept because other threads may still use
+    // them, they only contain the headers and share the decoded values
+    std::vector<std::unique_ptr<gridinfo_type> > m_versions;
+    std::atomic<gridinfo_type *> m_published;
+    std::mutex m_mutex;
+};
+
+
+} // namespace srs
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_SRS_MAPPED_GRIDS_HPP
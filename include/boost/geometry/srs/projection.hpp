@@ -14,8 +14,12 @@
 #define BOOST_GEOMETRY_SRS_PROJECTION_HPP
 
 
+#include <cmath>
+#include <cstddef>
+#include <iterator>
 #include <string>
 #include <type_traits>
+#include <utility>
 
 #include <boost/smart_ptr/shared_ptr.hpp>
 #include <boost/throw_exception.hpp>
@@ -23,7 +27,10 @@
 #include <boost/geometry/algorithms/convert.hpp>
 #include <boost/geometry/algorithms/detail/convert_point_to_point.hpp>
 
+#include <boost/geometry/core/closure.hpp>
 #include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/point_order.hpp>
+#include <boost/geometry/core/radian_access.hpp>
 #include <boost/geometry/core/static_assert.hpp>
 
 #include <boost/geometry/srs/projections/dpar.hpp>
@@ -36,6 +43,8 @@
 #include <boost/geometry/srs/projections/proj4.hpp>
 #include <boost/geometry/srs/projections/spar.hpp>
 
+#include <boost/geometry/util/range.hpp>
+
 #include <boost/geometry/views/detail/indexed_point_view.hpp>
 
 
@@ -89,6 +98,16 @@ inline void copy_higher_dimensions(Point1 const& point1, Point2 & point2)
 }
 
 
+// The calculation type of the internal projection
+template <typename Proj>
+struct proj_calc_type
+{
+    typedef typename std::decay_t
+        <
+            decltype(std::declval<Proj const&>().params())
+        >::type type;
+};
+
 struct forward_point_projection_policy
 {
     template <typename LL, typename XY, typename Proj>
@@ -96,6 +115,26 @@ struct forward_point_projection_policy
     {
         return proj.forward(ll, xy);
     }
+
+    template <typename CT, typename Proj>
+    static inline void apply_n(CT* coords, std::size_t count, Proj const& proj)
+    {
+        proj.forward_n(coords, count);
+    }
+
+    template <typename LL, typename CT>
+    static inline void load(LL const& ll, CT* coords)
+    {
+        coords[0] = geometry::get_as_radian<0>(ll);
+        coords[1] = geometry::get_as_radian<1>(ll);
+    }
+
+    template <typename CT, typename XY>
+    static inline void store(CT const* coords, XY & xy)
+    {
+        geometry::set<0>(xy, coords[0]);
+        geometry::set<1>(xy, coords[1]);
+    }
 };
 
 struct inverse_point_projection_policy
@@ -105,6 +144,26 @@ struct inverse_point_projection_policy
     {
         return proj.inverse(xy, ll);
     }
+
+    template <typename CT, typename Proj>
+    static inline void apply_n(CT* coords, std::size_t count, Proj const& proj)
+    {
+        proj.inverse_n(coords, count);
+    }
+
+    template <typename XY, typename CT>
+    static inline void load(XY const& xy, CT* coords)
+    {
+        coords[0] = geometry::get<0>(xy);
+        coords[1] = geometry::get<1>(xy);
+    }
+
+    template <typename CT, typename LL>
+    static inline void store(CT const* coords, LL & ll)
+    {
+        geometry::set_from_radian<0>(ll, coords[0]);
+        geometry::set_from_radian<1>(ll, coords[1]);
+    }
 };
 
 template <typename PointPolicy>
@@ -128,6 +187,50 @@ struct project_point
     }
 };
 
+// Projects the points in blocks, such that the projection is called once
+// for each block, instead of once for each point
+template <typename PointPolicy>
+struct project_points
+{
+    static const std::size_t block_size = 256;
+
+    template <typename It1, typename It2, typename Proj>
+    static inline bool apply(It1 first, It1 last, It2 out, Proj const& proj)
+    {
+        typedef typename proj_calc_type<Proj>::type calc_t;
+
+        calc_t coords[2 * block_size];
+        bool result = true;
+        while (first != last)
+        {
+            It1 block_first = first;
+            std::size_t count = 0;
+            for ( ; first != last && count < block_size ; ++first, ++count)
+            {
+                PointPolicy::load(*first, coords + 2 * count);
+            }
+
+            PointPolicy::apply_n(coords, count, proj);
+
+            for (std::size_t i = 0 ; i < count ; ++i, ++block_first, ++out)
+            {
+                // As in project_point
+                projections::detail::copy_higher_dimensions<2>(*block_first, *out);
+                if (coords[2 * i] == HUGE_VAL)
+                {
+                    set_invalid_point(*out);
+                    result = false;
+                }
+                else
+                {
+                    PointPolicy::store(coords + 2 * i, *out);
+                }
+            }
+        }
+        return result;
+    }
+};
+
 template <typename PointPolicy>
 struct project_range
 {
@@ -158,6 +261,29 @@ struct project_range
 
     template <typename R1, typename R2, typename Proj>
     static inline bool apply(R1 const& r1, R2 & r2, Proj const& proj)
+    {
+        typedef std::integral_constant
+            <
+                bool,
+                geometry::point_order<R1>::value == geometry::point_order<R2>::value
+                && geometry::closure<R1>::value == geometry::closure<R2>::value
+            > same_layout;
+
+        return apply(r1, r2, proj, same_layout());
+    }
+
+private:
+    // The points can be projected in the same order
+    template <typename R1, typename R2, typename Proj>
+    static inline bool apply(R1 const& r1, R2 & r2, Proj const& proj, std::true_type)
+    {
+        range::resize(r2, boost::size(r1));
+        return project_points<PointPolicy>::apply(boost::begin(r1), boost::end(r1),
+                                                  boost::begin(r2), proj);
+    }
+
+    template <typename R1, typename R2, typename Proj>
+    static inline bool apply(R1 const& r1, R2 & r2, Proj const& proj, std::false_type)
     {
         return geometry::detail::conversion::range_to_range
             <
@@ -473,6 +599,22 @@ public:
                 >::apply(ll, xy, base_t::proj());
     }
 
+    /// Forward projection of a range of points, from Latitude-Longitude
+    /// to Cartesian, written to the points starting at out
+    template <typename LLIt, typename XYIt>
+    inline bool forward(LLIt first, LLIt last, XYIt out) const
+    {
+        typedef typename std::iterator_traits<LLIt>::value_type ll_type;
+        typedef typename std::iterator_traits<XYIt>::value_type xy_type;
+
+        concepts::check_concepts_and_equal_dimensions<ll_type const, xy_type>();
+
+        return projections::detail::project_points
+                <
+                    projections::detail::forward_point_projection_policy
+                >::apply(first, last, out, base_t::proj());
+    }
+
     /// Inverse projection, from Cartesian to Latitude-Longitude
     template <typename XY, typename LL>
     inline bool inverse(XY const& xy, LL& ll) const
@@ -490,6 +632,22 @@ public:
                     projections::detail::inverse_point_projection_policy
                 >::apply(xy, ll, base_t::proj());
     }
+
+    /// Inverse projection of a range of points, from Cartesian to
+    /// Latitude-Longitude, written to the points starting at out
+    template <typename XYIt, typename LLIt>
+    inline bool inverse(XYIt first, XYIt last, LLIt out) const
+    {
+        typedef typename std::iterator_traits<XYIt>::value_type xy_type;
+        typedef typename std::iterator_traits<LLIt>::value_type ll_type;
+
+        concepts::check_concepts_and_equal_dimensions<xy_type const, ll_type>();
+
+        return projections::detail::project_points
+                <
+                    projections::detail::inverse_point_projection_policy
+                >::apply(first, last, out, base_t::proj());
+    }
 };
 
 } // namespace projections
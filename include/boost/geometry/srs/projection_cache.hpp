@@ -0,0 +1,214 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_SRS_PROJECTION_CACHE_HPP
+#define BOOST_GEOMETRY_SRS_PROJECTION_CACHE_HPP
+
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_NO_CXX14_HDR_SHARED_MUTEX
+#error "C++14 <shared_mutex> header required."
+#endif
+
+#include <boost/geometry/srs/projection.hpp>
+#include <boost/geometry/srs/projections/epsg_params.hpp>
+#include <boost/geometry/srs/projections/esri_params.hpp>
+#include <boost/geometry/srs/projections/iau2000_params.hpp>
+#include <boost/geometry/srs/transformation.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+
+namespace boost { namespace geometry
+{
+
+namespace srs
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+// The definition of a coordinate system, a code of a database or a PROJ4
+// string which is compared literally
+struct projection_cache_key
+{
+    enum kind_type { kind_proj4, kind_epsg, kind_esri, kind_iau2000 };
+
+    projection_cache_key(kind_type k, int c)
+        : kind(k), code(c)
+    {}
+
+    explicit projection_cache_key(std::string const& s)
+        : kind(kind_proj4), code(0), str(s)
+    {}
+
+    bool operator==(projection_cache_key const& other) const
+    {
+        return kind == other.kind && code == other.code && str == other.str;
+    }
+
+    kind_type kind;
+    int code;
+    std::string str;
+};
+
+struct projection_cache_key_hash
+{
+    std::size_t operator()(projection_cache_key const& key) const
+    {
+        return key.kind == projection_cache_key::kind_proj4
+             ? std::hash<std::string>()(key.str)
+             : std::hash<int>()(key.code) * 4 + std::size_t(key.kind);
+    }
+
+    std::size_t operator()(std::pair<projection_cache_key, projection_cache_key> const& keys) const
+    {
+        std::size_t const h = operator()(keys.first);
+        return h ^ (operator()(keys.second) + 0x9e3779b9 + (h << 6) + (h >> 2));
+    }
+};
+
+inline projection_cache_key make_projection_cache_key(srs::proj4 const& params)
+{
+    return projection_cache_key(params.str());
+}
+
+inline projection_cache_key make_projection_cache_key(srs::epsg const& params)
+{
+    return projection_cache_key(projection_cache_key::kind_epsg, params.code);
+}
+
+inline projection_cache_key make_projection_cache_key(srs::esri const& params)
+{
+    return projection_cache_key(projection_cache_key::kind_esri, params.code);
+}
+
+inline projection_cache_key make_projection_cache_key(srs::iau2000 const& params)
+{
+    return projection_cache_key(projection_cache_key::kind_iau2000, params.code);
+}
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+    \brief Cache of dynamic projections and transformations
+    \details Projections and transformations are created once for each
+        srs::proj4 string or srs::epsg, srs::esri or srs::iau2000 code, or
+        pair of them, and copied from the cache afterwards. The copies share
+        the projections, so getting a projection or a transformation which
+        is already in the cache only looks up a hash table and copies
+        shared pointers. The cache can be used by several threads at once.
+        The definitions of the codes are included separately, e.g. by
+        boost/geometry/srs/epsg.hpp.
+    \ingroup srs
+    \tparam CT calculation type used internally
+*/
+template <typename CT = double>
+class projection_cache
+{
+#if defined(_MSC_FULL_VER) && (_MSC_FULL_VER >= 190023918)
+    typedef std::shared_mutex mutex_type;
+#elif !defined(BOOST_NO_CXX14_HDR_SHARED_MUTEX) && (__cplusplus > 201402L)
+    typedef std::shared_mutex mutex_type;
+#else
+    typedef std::shared_timed_mutex mutex_type;
+#endif
+
+    typedef detail::projection_cache_key key_type;
+    typedef detail::projection_cache_key_hash hash_type;
+
+public:
+    typedef srs::projection<srs::dynamic, CT> projection_type;
+    typedef srs::transformation<srs::dynamic, srs::dynamic, CT> transformation_type;
+
+    /*!
+    \brief Returns the projection defined by the parameters
+    \details Throws like the constructor of the projection if it can not be
+        created, the cache is not modified then.
+    */
+    template <typename Parameters>
+    projection_type get_projection(Parameters const& parameters)
+    {
+        return find_or_create(m_projections,
+                              detail::make_projection_cache_key(parameters),
+                              [&]() { return projection_type(parameters); });
+    }
+
+    /*!
+    \brief Returns the transformation between the coordinate systems
+        defined by the parameters
+    */
+    template <typename Parameters1, typename Parameters2>
+    transformation_type get_transformation(Parameters1 const& parameters1,
+                                           Parameters2 const& parameters2)
+    {
+        return find_or_create(m_transformations,
+                              std::make_pair(detail::make_projection_cache_key(parameters1),
+                                             detail::make_projection_cache_key(parameters2)),
+                              [&]() { return transformation_type(parameters1, parameters2); });
+    }
+
+    // Number of the cached projections and transformations
+    std::size_t size() const
+    {
+        std::shared_lock<mutex_type> lock(m_mutex);
+        return m_projections.size() + m_transformations.size();
+    }
+
+    void clear()
+    {
+        std::unique_lock<mutex_type> lock(m_mutex);
+        m_projections.clear();
+        m_transformations.clear();
+    }
+
+private:
+    template <typename Map, typename Key, typename Create>
+    typename Map::mapped_type find_or_create(Map & map, Key const& key, Create const& create)
+    {
+        {
+            std::shared_lock<mutex_type> lock(m_mutex);
+            typename Map::const_iterator it = map.find(key);
+            if (it != map.end())
+            {
+                return it->second;
+            }
+        }
+
+        // Created without the lock, the first one created by any of the
+        // threads is cached and returned
+        typename Map::mapped_type const value = create();
+
+        std::unique_lock<mutex_type> lock(m_mutex);
+        return map.emplace(key, value).first->second;
+    }
+
+    std::unordered_map<key_type, projection_type, hash_type> m_projections;
+    std::unordered_map
+        <
+            std::pair<key_type, key_type>, transformation_type, hash_type
+        > m_transformations;
+    mutable mutex_type m_mutex;
+};
+
+
+} // namespace srs
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_SRS_PROJECTION_CACHE_HPP
@@ -13,9 +13,12 @@
 #ifndef BOOST_GEOMETRY_PROJECTIONS_IMPL_BASE_DYNAMIC_HPP
 #define BOOST_GEOMETRY_PROJECTIONS_IMPL_BASE_DYNAMIC_HPP
 
+#include <cstddef>
 #include <string>
 
 #include <boost/geometry/srs/projections/exception.hpp>
+#include <boost/geometry/srs/projections/impl/pj_fwd.hpp>
+#include <boost/geometry/srs/projections/impl/pj_inv.hpp>
 #include <boost/geometry/srs/projections/impl/projects.hpp>
 
 namespace boost { namespace geometry { namespace projections
@@ -48,6 +51,12 @@ public :
     /// Inverse projection using x / y and lon / lat
     virtual void inv(P const& par, CT const& xy_x, CT const& xy_y, CT& lp_lon, CT& lp_lat) const = 0;
 
+    /// Forward projection of count points stored as lon / lat, in place
+    virtual void fwd_n(P const& par, CT* coords, std::size_t count) const = 0;
+
+    /// Inverse projection of count points stored as x / y, in place
+    virtual void inv_n(P const& par, CT* coords, std::size_t count) const = 0;
+
     /// Forward projection, from Latitude-Longitude to Cartesian
     template <typename LL, typename XY>
     inline bool forward(LL const& lp, XY& xy) const
@@ -82,6 +91,20 @@ public :
         }
     }
 
+    /// Forward projection of count points, stored as lon / lat in radians,
+    /// in place to x / y. Points which cannot be projected are set to HUGE_VAL.
+    inline void forward_n(CT* coords, std::size_t count) const
+    {
+        pj_fwd_n(*this, m_par, coords, count);
+    }
+
+    /// Inverse projection of count points, stored as x / y, in place
+    /// to lon / lat in radians. Points which cannot be projected are set to HUGE_VAL.
+    inline void inverse_n(CT* coords, std::size_t count) const
+    {
+        pj_inv_n(*this, m_par, coords, count);
+    }
+
     /// Returns name of projection
     std::string name() const { return m_par.id.name; }
 
@@ -126,6 +149,16 @@ public:
         BOOST_THROW_EXCEPTION(projection_not_invertible_exception(this->name()));
     }
 
+    virtual void fwd_n(P const& par, CT* coords, std::size_t count) const
+    {
+        projections::detail::fwd_n(prj(), par, coords, count, 0);
+    }
+
+    virtual void inv_n(P const& , CT* , std::size_t ) const
+    {
+        BOOST_THROW_EXCEPTION(projection_not_invertible_exception(this->name()));
+    }
+
 protected:
     Prj const& prj() const { return *this; }
 };
@@ -151,6 +184,11 @@ public:
     {
         this->prj().inv(par, xy_x, xy_y, lp_lon, lp_lat);
     }
+
+    virtual void inv_n(P const& par, CT* coords, std::size_t count) const
+    {
+        projections::detail::inv_n(this->prj(), par, coords, count, 0);
+    }
 };
 
 } // namespace detail
@@ -19,6 +19,7 @@
 #endif // defined(_MSC_VER)
 
 
+#include <cstddef>
 #include <string>
 
 #include <boost/geometry/core/assert.hpp>
@@ -125,6 +126,11 @@ public:
         }
     }
 
+    inline void forward_n(typename P::type* coords, std::size_t count) const
+    {
+        pj_fwd_n(*this, this->m_par, coords, count);
+    }
+
     template <typename XY, typename LL>
     inline bool inverse(XY const&, LL&) const
     {
@@ -146,6 +152,11 @@ public:
         : static_wrapper_f<Prj, P>(params, par)
     {}
 
+    inline void inverse_n(typename P::type* coords, std::size_t count) const
+    {
+        pj_inv_n(*this, this->m_par, coords, count);
+    }
+
     template <typename XY, typename LL>
     inline bool inverse(XY const& xy, LL& lp) const
     {
@@ -58,10 +58,11 @@ namespace detail
 {
 
 // Originally implemented in nad_intr.c
-template <typename CalcT>
+// The shift values are read from cvs, ct.cvs or ct.tiles
+template <typename CalcT, typename Cvs>
 inline void nad_intr(CalcT in_lon, CalcT in_lat,
                      CalcT & out_lon, CalcT & out_lat,
-                     pj_ctable const& ct)
+                     pj_ctable const& ct, Cvs const& cvs)
 {
 	pj_ctable::lp_t frct;
 	pj_ctable::ilp_t indx;
@@ -100,11 +101,11 @@ inline void nad_intr(CalcT in_lon, CalcT in_lat,
 			return;
 	}
 	boost::int32_t index = indx.phi * ct.lim.lam + indx.lam;
-	pj_ctable::flp_t const& f00 = ct.cvs[index++];
-	pj_ctable::flp_t const& f10 = ct.cvs[index];
+	pj_ctable::flp_t const& f00 = cvs[index++];
+	pj_ctable::flp_t const& f10 = cvs[index];
 	index += ct.lim.lam;
-	pj_ctable::flp_t const& f11 = ct.cvs[index--];
-	pj_ctable::flp_t const& f01 = ct.cvs[index];
+	pj_ctable::flp_t const& f11 = cvs[index--];
+	pj_ctable::flp_t const& f01 = cvs[index];
     CalcT m00, m10, m01, m11;
 	m11 = m10 = frct.lam;
 	m00 = m01 = 1. - frct.lam;
@@ -120,10 +121,10 @@ inline void nad_intr(CalcT in_lon, CalcT in_lat,
 }
 
 // Originally implemented in nad_cvt.c
-template <bool Inverse, typename CalcT>
+template <bool Inverse, typename CalcT, typename Cvs>
 inline void nad_cvt(CalcT const& in_lon, CalcT const& in_lat,
                     CalcT & out_lon, CalcT & out_lat,
-                    pj_gi const& gi)
+                    pj_gi const& gi, Cvs const& cvs)
 {
     static const int max_iterations = 10;
     static const CalcT tol = 1e-12;
@@ -151,7 +152,7 @@ inline void nad_cvt(CalcT const& in_lon, CalcT const& in_lat,
     tb.lam = adjlon (tb.lam - pi) + pi;
 
     pj_ctable::lp_t t;
-    nad_intr(tb.lam, tb.phi, t.lam, t.phi, ct);
+    nad_intr(tb.lam, tb.phi, t.lam, t.phi, ct, cvs);
     if (t.lam == HUGE_VAL)
     {
         out_lon = HUGE_VAL;
@@ -173,7 +174,7 @@ inline void nad_cvt(CalcT const& in_lon, CalcT const& in_lat,
     pj_ctable::lp_t del, dif;
     do
     {
-        nad_intr(t.lam, t.phi, del.lam, del.phi, ct);
+        nad_intr(t.lam, t.phi, del.lam, del.phi, ct, cvs);
 
         // This case used to return failure, but I have
         // changed it to return the first order approximation
@@ -210,6 +211,21 @@ inline void nad_cvt(CalcT const& in_lon, CalcT const& in_lat,
     out_lat = t.phi + ct.ll.phi;
 }
 
+template <bool Inverse, typename CalcT>
+inline void nad_cvt(CalcT const& in_lon, CalcT const& in_lat,
+                    CalcT & out_lon, CalcT & out_lat,
+                    pj_gi const& gi)
+{
+    if (gi.tiles)
+    {
+        nad_cvt<Inverse>(in_lon, in_lat, out_lon, out_lat, gi, *gi.tiles);
+    }
+    else
+    {
+        nad_cvt<Inverse>(in_lon, in_lat, out_lon, out_lat, gi, gi.ct.cvs);
+    }
+}
+
 
 /************************************************************************/
 /*                             find_grid()                              */
@@ -323,6 +339,52 @@ inline bool load_grid(StreamPolicy const& stream_policy, pj_gi_load & gi)
 }
 
 
+// Shifts the point by the grid, if the shift is defined at in_lon, in_lat
+template <bool Inverse, typename CalcT, typename Point>
+inline void apply_grid(CalcT const& in_lon, CalcT const& in_lat,
+                       Point & point, pj_gi const& gi)
+{
+    // TODO: use set_invalid_point() or similar mechanism
+    CalcT out_lon = HUGE_VAL;
+    CalcT out_lat = HUGE_VAL;
+
+    nad_cvt<Inverse>(in_lon, in_lat, out_lon, out_lat, gi);
+
+    // TODO: check differently
+    if ( out_lon != HUGE_VAL )
+    {
+        geometry::set_from_radian<0>(point, out_lon);
+        geometry::set_from_radian<1>(point, out_lat);
+    }
+}
+
+// Shifts the points of the range by the grids returned by find_loaded_grid,
+// called with the coordinates of a point and returning NULL if there is no
+// grid containing the point or if it cannot be loaded
+template <bool Inverse, typename CalcT, typename Range, typename FindLoadedGrid>
+inline void apply_grids(Range & range, FindLoadedGrid const& find_loaded_grid)
+{
+    typedef typename boost::range_size<Range>::type size_type;
+
+    size_type point_count = boost::size(range);
+
+    for (size_type i = 0 ; i < point_count ; ++i)
+    {
+        typename boost::range_reference<Range>::type
+            point = range::at(range, i);
+
+        CalcT in_lon = geometry::get_as_radian<0>(point);
+        CalcT in_lat = geometry::get_as_radian<1>(point);
+
+        pj_gi const* gip = find_loaded_grid(in_lon, in_lat);
+
+        if ( gip != NULL )
+        {
+            apply_grid<Inverse>(in_lon, in_lat, point, *gip);
+        }
+    }
+}
+
 /************************************************************************/
 /*                        pj_apply_gridshift_3()                        */
 /*                                                                      */
@@ -337,8 +399,6 @@ inline bool pj_apply_gridshift_3(StreamPolicy const& stream_policy,
                                  std::vector<std::size_t> const& gridindexes,
                                  grids_tag)
 {
-    typedef typename boost::range_size<Range>::type size_type;
-    
     // If the grids are empty the indexes are as well
     if (gridindexes.empty())
     {
@@ -347,38 +407,15 @@ inline bool pj_apply_gridshift_3(StreamPolicy const& stream_policy,
         return false;
     }
 
-    size_type point_count = boost::size(range);
-
-    for (size_type i = 0 ; i < point_count ; ++i)
+    apply_grids<Inverse, CalcT>(range, [&](CalcT const& lon, CalcT const& lat)
     {
-        typename boost::range_reference<Range>::type
-            point = range::at(range, i);
+        pj_gi * gip = find_grid(lon, lat, grids.gridinfo, gridindexes);
 
-        CalcT in_lon = geometry::get_as_radian<0>(point);
-        CalcT in_lat = geometry::get_as_radian<1>(point);
-        
-        pj_gi * gip = find_grid(in_lon, in_lat, grids.gridinfo, gridindexes);
-
-        if ( gip != NULL )
-        {
-            // load the grid shift info if we don't have it.
-            if (! gip->ct.cvs.empty() || load_grid(stream_policy, *gip))
-            {
-                // TODO: use set_invalid_point() or similar mechanism
-                CalcT out_lon = HUGE_VAL;
-                CalcT out_lat = HUGE_VAL;
-
-                nad_cvt<Inverse>(in_lon, in_lat, out_lon, out_lat, *gip);
-            
-                // TODO: check differently
-                if ( out_lon != HUGE_VAL )
-                {
-                    geometry::set_from_radian<0>(point, out_lon);
-                    geometry::set_from_radian<1>(point, out_lat);
-                }
-            }
-        }
-    }
+        // load the grid shift info if we don't have it.
+        return gip != NULL && (! gip->ct.cvs.empty() || load_grid(stream_policy, *gip))
+             ? gip
+             : NULL;
+    });
 
     return true;
 }
@@ -432,18 +469,7 @@ inline bool pj_apply_gridshift_3(StreamPolicy const& stream_policy,
                 }
                 else if (! gip->ct.cvs.empty())
                 {
-                    // TODO: use set_invalid_point() or similar mechanism
-                    CalcT out_lon = HUGE_VAL;
-                    CalcT out_lat = HUGE_VAL;
-
-                    nad_cvt<Inverse>(in_lon, in_lat, out_lon, out_lat, *gip);
-
-                    // TODO: check differently
-                    if (out_lon != HUGE_VAL)
-                    {
-                        geometry::set_from_radian<0>(point, out_lon);
-                        geometry::set_from_radian<1>(point, out_lat);
-                    }
+                    apply_grid<Inverse>(in_lon, in_lat, point, *gip);
                 }
                 else
                 {
@@ -481,6 +507,37 @@ inline bool pj_apply_gridshift_3(StreamPolicy const& stream_policy,
 }
 
 
+// Generic stream policy and mapped grids
+template <bool Inverse, typename CalcT, typename StreamPolicy, typename Range, typename MappedGrids>
+inline bool pj_apply_gridshift_3(StreamPolicy const& ,
+                                 Range & range,
+                                 MappedGrids & grids,
+                                 std::vector<std::size_t> const& gridindexes,
+                                 mapped_grids_tag)
+{
+    // If the grids are empty the indexes are as well
+    if (gridindexes.empty())
+    {
+        return false;
+    }
+
+    // The published grids are not modified anymore and the shift values
+    // are decoded lazily without locking
+    pj_gridinfo & gridinfo = grids.published_gridinfo();
+
+    apply_grids<Inverse, CalcT>(range, [&](CalcT const& lon, CalcT const& lat)
+    {
+        pj_gi * gip = find_grid(lon, lat, gridinfo, gridindexes);
+
+        return gip != NULL && (gip->tiles || ! gip->ct.cvs.empty())
+             ? gip
+             : NULL;
+    });
+
+    return true;
+}
+
+
 /************************************************************************/
 /*                        pj_apply_gridshift_2()                        */
 /*                                                                      */
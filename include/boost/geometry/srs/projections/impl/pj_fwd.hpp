@@ -39,6 +39,9 @@
 #ifndef BOOST_GEOMETRY_PROJECTIONS_IMPL_PJ_FWD_HPP
 #define BOOST_GEOMETRY_PROJECTIONS_IMPL_PJ_FWD_HPP
 
+#include <cmath>
+#include <cstddef>
+
 #include <boost/geometry/core/radian_access.hpp>
 #include <boost/geometry/util/math.hpp>
 
@@ -102,6 +105,110 @@ inline void pj_fwd(Prj const& prj, P const& par, LL const& ll, XY& xy)
     }
 }
 
+/* number of points handled at once by pj_fwd_n and pj_inv_n */
+static const std::size_t pj_block_size = 64;
+
+template <typename Prj, typename P>
+inline auto fwd_n(Prj const& prj, P const& par, typename P::type* coords,
+                  std::size_t count, int)
+    -> decltype(prj.fwd_n(par, coords, count))
+{
+    return prj.fwd_n(par, coords, count);
+}
+
+/* projections without a batched variant are called for each point */
+template <typename Prj, typename P>
+inline void fwd_n(Prj const& prj, P const& par, typename P::type* coords,
+                  std::size_t count, long)
+{
+    for (std::size_t i = 0; i < count; i++, coords += 2)
+    {
+        typename P::type x = 0;
+        typename P::type y = 0;
+        try
+        {
+            prj.fwd(par, coords[0], coords[1], x, y);
+        }
+        catch (...)
+        {
+            x = y = HUGE_VAL;
+        }
+        coords[0] = x;
+        coords[1] = y;
+    }
+}
+
+/*
+    forward projection of count points, stored as lon, lat, lon, lat, ...
+    in radians, in place to x, y, x, y, ... The points that cannot be
+    projected are set to HUGE_VAL. Projections can implement
+    fwd_n(par, coords, count) with the same contract, which is called
+    once for each block of points, instead of fwd for each point.
+*/
+template <typename Prj, typename P>
+inline void pj_fwd_n(Prj const& prj, P const& par, typename P::type* coords, std::size_t count)
+{
+    typedef typename P::type calc_t;
+    static const calc_t EPS = 1.0e-12;
+    calc_t const half_pi = geometry::math::half_pi<calc_t>();
+
+    bool valid[pj_block_size];
+
+    while (count > 0)
+    {
+        std::size_t const n = count < pj_block_size ? count : pj_block_size;
+
+        for (std::size_t i = 0; i < n; i++)
+        {
+            calc_t& lp_lon = coords[2 * i];
+            calc_t& lp_lat = coords[2 * i + 1];
+            calc_t const t = geometry::math::abs(lp_lat) - half_pi;
+
+            /* check for forward and latitude or longitude overange */
+            valid[i] = ! (t > EPS || geometry::math::abs(lp_lon) > 10.);
+            if (! valid[i])
+            {
+                lp_lon = lp_lat = 0;
+                continue;
+            }
+
+            if (geometry::math::abs(t) <= EPS)
+            {
+                lp_lat = lp_lat < 0. ? -half_pi : half_pi;
+            }
+            else if (par.geoc)
+            {
+                lp_lat = atan(par.rone_es * tan(lp_lat));
+            }
+
+            lp_lon -= par.lam0;    /* compute del lp.lam */
+            if (! par.over)
+            {
+                lp_lon = adjlon(lp_lon); /* post_forward del longitude */
+            }
+        }
+
+        fwd_n(prj, par, coords, n, 0);
+
+        std::size_t const ix = par.axis[0] == 0 ? 0 : 1;
+        for (std::size_t i = 0; i < n; i++)
+        {
+            calc_t const x = coords[2 * i];
+            calc_t const y = coords[2 * i + 1];
+            if (! valid[i] || x == HUGE_VAL || y == HUGE_VAL)
+            {
+                coords[2 * i] = coords[2 * i + 1] = HUGE_VAL;
+                continue;
+            }
+            coords[2 * i + ix] = par.sign[ix] * par.fr_meter * (par.a * x + par.x0);
+            coords[2 * i + 1 - ix] = par.sign[1 - ix] * par.fr_meter * (par.a * y + par.y0);
+        }
+
+        coords += 2 * n;
+        count -= n;
+    }
+}
+
 } // namespace detail
 }}} // namespace boost::geometry::projections
 
@@ -49,6 +49,9 @@
 #include <boost/cstdint.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -122,6 +125,8 @@ struct pj_ctable
     }
 };
 
+class pj_ctable_tiles;
+
 struct pj_gi_load
 {
     enum format_t { missing = 0, ntv1, ntv2, gtx, ctable, ctable2 };
@@ -146,6 +151,9 @@ struct pj_gi_load
 
     pj_ctable ct;
 
+    // shift values decoded lazily, used instead of ct.cvs if set
+    std::shared_ptr<pj_ctable_tiles> tiles;
+
     inline void swap(pj_gi_load & r)
     {
         gridname.swap(r.gridname);
@@ -153,6 +161,7 @@ struct pj_gi_load
         std::swap(grid_offset, r.grid_offset);
         std::swap(must_swap, r.must_swap);
         ct.swap(r.ct);
+        tiles.swap(r.tiles);
     }
 
 };
@@ -185,6 +194,12 @@ typedef std::vector<pj_gi> pj_gridinfo;
 /*      Load the data portion of a ctable formatted grid.               */
 /************************************************************************/
 
+// The size of the proj4 original CTABLE, preceding the data of the file
+static const std::size_t pj_ctable_header_size = 80
+                                               + 2 * sizeof(pj_ctable::lp_t)
+                                               + sizeof(pj_ctable::ilp_t)
+                                               + sizeof(pj_ctable::flp_t*);
+
 // Originally nad_ctable_load() defined in nad_init.c
 template <typename IStream>
 bool pj_gridinfo_load_ctable(IStream & is, pj_gi_load & gi)
@@ -192,11 +207,7 @@ bool pj_gridinfo_load_ctable(IStream & is, pj_gi_load & gi)
     pj_ctable & ct = gi.ct;
     
     // Move the input stream by the size of the proj4 original CTABLE
-    std::size_t header_size = 80
-                            + 2 * sizeof(pj_ctable::lp_t)
-                            + sizeof(pj_ctable::ilp_t)
-                            + sizeof(pj_ctable::flp_t*);
-    is.seekg(header_size);
+    is.seekg(pj_ctable_header_size);
     
     // read all the actual shift values
     std::size_t a_size = ct.lim.lam * ct.lim.phi;
@@ -261,12 +272,29 @@ bool pj_gridinfo_load_ctable2(IStream & is, pj_gi_load & gi)
 /*      reversed, and we have to be aware of byte swapping.             */
 /************************************************************************/
 
+// Converts one row of the file, east to west, swapping the bytes if needed
+inline void pj_gridinfo_convert_row_ntv1(double * row_buf, boost::int32_t lim_lam,
+                                         pj_ctable::flp_t * cvs_row)
+{
+    static const double s2r = math::d2r<double>() / 3600.0;
+
+    if (is_lsb())
+        swap_words(reinterpret_cast<char*>(row_buf), 8, (int)lim_lam * 2);
+
+    // convert seconds to radians
+    for (boost::int32_t i = 0; i < lim_lam; i++ )
+    {
+        pj_ctable::flp_t & cvs = cvs_row[lim_lam - i - 1];
+
+        cvs.phi = (float) (row_buf[i*2] * s2r);
+        cvs.lam = (float) (row_buf[i*2+1] * s2r);
+    }
+}
+
 // originally in pj_gridinfo_load() function
 template <typename IStream>
 inline bool pj_gridinfo_load_ntv1(IStream & is, pj_gi_load & gi)
 {
-    static const double s2r = math::d2r<double>() / 3600.0;
-
     std::size_t const r_size = gi.ct.lim.lam * 2;
     std::size_t const ch_size = sizeof(double) * r_size;
 
@@ -285,17 +313,8 @@ inline bool pj_gridinfo_load_ntv1(IStream & is, pj_gi_load & gi)
             return false;
         }
 
-        if (is_lsb())
-            swap_words(reinterpret_cast<char*>(&row_buf[0]), 8, (int)r_size);
-
-        // convert seconds to radians
-        for (boost::int32_t i = 0; i < gi.ct.lim.lam; i++ )
-        {
-            pj_ctable::flp_t & cvs = gi.ct.cvs[row * gi.ct.lim.lam + (gi.ct.lim.lam - i - 1)];
-
-            cvs.phi = (float) (row_buf[i*2] * s2r);
-            cvs.lam = (float) (row_buf[i*2+1] * s2r);
-        }
+        pj_gridinfo_convert_row_ntv1(&row_buf[0], gi.ct.lim.lam,
+                                     &gi.ct.cvs[row * gi.ct.lim.lam]);
     }
 
     return true;
@@ -311,12 +330,33 @@ inline bool pj_gridinfo_load_ntv1(IStream & is, pj_gi_load & gi)
 /*      reversed, and we have to be aware of byte swapping.             */
 /* -------------------------------------------------------------------- */
 
+// Converts one row of the file, east to west, swapping the bytes if needed
+inline void pj_gridinfo_convert_row_ntv2(float * row_buf, boost::int32_t lim_lam,
+                                         bool must_swap,
+                                         pj_ctable::flp_t * cvs_row)
+{
+    static const double s2r = math::d2r<double>() / 3600.0;
+
+    if (must_swap)
+    {
+        swap_words(reinterpret_cast<char*>(row_buf), 4, (int)lim_lam * 4);
+    }
+
+    // convert seconds to radians
+    for (boost::int32_t i = 0; i < lim_lam; i++ )
+    {
+        pj_ctable::flp_t & cvs = cvs_row[lim_lam - i - 1];
+
+        // skip accuracy values
+        cvs.phi = (float) (row_buf[i*4] * s2r);
+        cvs.lam = (float) (row_buf[i*4+1] * s2r);
+    }
+}
+
 // originally in pj_gridinfo_load() function
 template <typename IStream>
 inline bool pj_gridinfo_load_ntv2(IStream & is, pj_gi_load & gi)
 {
-    static const double s2r = math::d2r<double>() / 3600.0;
-
     std::size_t const r_size = gi.ct.lim.lam * 4;
     std::size_t const ch_size = sizeof(float) * r_size;
 
@@ -335,20 +375,8 @@ inline bool pj_gridinfo_load_ntv2(IStream & is, pj_gi_load & gi)
             return false;
         }
 
-        if (gi.must_swap)
-        {
-            swap_words(reinterpret_cast<char*>(&row_buf[0]), 4, (int)r_size);
-        }
-
-        // convert seconds to radians
-        for (boost::int32_t i = 0; i < gi.ct.lim.lam; i++ )
-        {
-            pj_ctable::flp_t & cvs = gi.ct.cvs[row * gi.ct.lim.lam + (gi.ct.lim.lam - i - 1)];
-
-            // skip accuracy values
-            cvs.phi = (float) (row_buf[i*4] * s2r);
-            cvs.lam = (float) (row_buf[i*4+1] * s2r);
-        }
+        pj_gridinfo_convert_row_ntv2(&row_buf[0], gi.ct.lim.lam, gi.must_swap,
+                                     &gi.ct.cvs[row * gi.ct.lim.lam]);
     }
 
     return true;
@@ -442,6 +470,189 @@ inline bool pj_gridinfo_load(IStream & is, pj_gi_load & gi)
     }
 }
 
+/************************************************************************/
+/*                           pj_ctable_tiles                            */
+/*                                                                      */
+/*      Shift values decoded lazily from the data of a grid file in     */
+/*      memory, e.g. a memory mapped file.                              */
+/************************************************************************/
+
+// Returns the offset of the data of the grid in its file
+inline std::size_t pj_gridinfo_data_offset(pj_gi_load const& gi)
+{
+    return gi.format == pj_gi_load::ctable ? pj_ctable_header_size
+         : gi.format == pj_gi_load::ctable2 ? std::size_t(160)
+         : std::size_t(gi.grid_offset);
+}
+
+// Returns the size of one row of the data of the grid in its file,
+// or 0 if the data can not be decoded by rows
+inline std::size_t pj_gridinfo_row_size(pj_gi_load const& gi)
+{
+    std::size_t const lim_lam = std::size_t(gi.ct.lim.lam);
+    return gi.format == pj_gi_load::ctable ? lim_lam * sizeof(pj_ctable::flp_t)
+         : gi.format == pj_gi_load::ctable2 ? lim_lam * sizeof(pj_ctable::flp_t)
+         : gi.format == pj_gi_load::ntv1 ? lim_lam * 2 * sizeof(double)
+         : gi.format == pj_gi_load::ntv2 ? lim_lam * 4 * sizeof(float)
+         : std::size_t(0);
+}
+
+// The rows are decoded in tiles. A decoded tile is published atomically
+// and never changed afterwards, so the values can be read by several
+// threads without locking. If two threads decode the same tile at once,
+// the tile of one of them is kept.
+class pj_ctable_tiles
+{
+public:
+    static const boost::int32_t tile_rows = 64;
+
+    // The data is kept alive by the owner
+    pj_ctable_tiles(std::shared_ptr<void const> const& owner,
+                    char const* data,
+                    pj_gi_load const& gi)
+        : m_owner(owner)
+        , m_data(data)
+        , m_format(gi.format)
+        , m_must_swap(gi.must_swap)
+        , m_lim(gi.ct.lim)
+        , m_row_size(pj_gridinfo_row_size(gi))
+        , m_tile_count((gi.ct.lim.phi + tile_rows - 1) / tile_rows)
+        , m_tiles(new std::atomic<pj_ctable::flp_t *>[m_tile_count])
+    {
+        for (std::size_t i = 0; i < m_tile_count; i++)
+        {
+            m_tiles[i].store(NULL, std::memory_order_relaxed);
+        }
+    }
+
+    ~pj_ctable_tiles()
+    {
+        for (std::size_t i = 0; i < m_tile_count; i++)
+        {
+            delete[] m_tiles[i].load(std::memory_order_relaxed);
+        }
+    }
+
+    // Same index as in pj_ctable::cvs
+    inline pj_ctable::flp_t const& operator[](boost::int32_t index) const
+    {
+        std::size_t const tile_size = std::size_t(tile_rows) * m_lim.lam;
+        std::size_t const t = std::size_t(index) / tile_size;
+        return tile(t)[std::size_t(index) - t * tile_size];
+    }
+
+private:
+    pj_ctable_tiles(pj_ctable_tiles const&);
+    pj_ctable_tiles & operator=(pj_ctable_tiles const&);
+
+    inline pj_ctable::flp_t const* tile(std::size_t t) const
+    {
+        pj_ctable::flp_t * result = m_tiles[t].load(std::memory_order_acquire);
+        if (result != NULL)
+        {
+            return result;
+        }
+
+        boost::int32_t const first_row = boost::int32_t(t) * tile_rows;
+        boost::int32_t const row_count = (std::min)(tile_rows, m_lim.phi - first_row);
+        pj_ctable::flp_t * decoded = new pj_ctable::flp_t[std::size_t(row_count) * m_lim.lam];
+        decode(first_row, row_count, decoded);
+
+        if (m_tiles[t].compare_exchange_strong(result, decoded,
+                                               std::memory_order_acq_rel,
+                                               std::memory_order_acquire))
+        {
+            return decoded;
+        }
+
+        // Decoded by another thread in the meantime
+        delete[] decoded;
+        return result;
+    }
+
+    inline void decode(boost::int32_t first_row, boost::int32_t row_count,
+                       pj_ctable::flp_t * cvs) const
+    {
+        std::vector<char> row_buf(m_row_size);
+        for (boost::int32_t row = 0; row < row_count; row++)
+        {
+            pj_ctable::flp_t * cvs_row = cvs + std::size_t(row) * m_lim.lam;
+
+            // The data is not necessarily aligned
+            std::memcpy(&row_buf[0], m_data + std::size_t(first_row + row) * m_row_size,
+                        m_row_size);
+
+            if (m_format == pj_gi_load::ntv1)
+            {
+                pj_gridinfo_convert_row_ntv1(reinterpret_cast<double*>(&row_buf[0]),
+                                             m_lim.lam, cvs_row);
+            }
+            else if (m_format == pj_gi_load::ntv2)
+            {
+                pj_gridinfo_convert_row_ntv2(reinterpret_cast<float*>(&row_buf[0]),
+                                             m_lim.lam, m_must_swap, cvs_row);
+            }
+            else
+            {
+                if (m_format == pj_gi_load::ctable2 && ! is_lsb())
+                {
+                    swap_words(&row_buf[0], 4, (int)m_lim.lam * 2);
+                }
+                std::memcpy(cvs_row, &row_buf[0], m_row_size);
+            }
+        }
+    }
+
+    std::shared_ptr<void const> m_owner;
+    char const* m_data;
+    pj_gi_load::format_t m_format;
+    bool m_must_swap;
+    pj_ctable::ilp_t m_lim;
+    std::size_t m_row_size;
+    std::size_t m_tile_count;
+    std::unique_ptr<std::atomic<pj_ctable::flp_t *>[]> m_tiles;
+};
+
+// Decodes the data of the grid and of its children lazily from the file
+// in memory. Grids which can not be decoded by rows, or of which the data
+// is not completely in memory, are left as they are.
+inline void pj_gridinfo_set_tiles(pj_gi & gi,
+                                  std::shared_ptr<void const> const& owner,
+                                  char const* file_data, std::size_t file_size)
+{
+    std::size_t const offset = pj_gridinfo_data_offset(gi);
+    std::size_t const row_size = pj_gridinfo_row_size(gi);
+    if (row_size > 0 && gi.ct.lim.phi > 0
+        && offset <= file_size
+        && std::size_t(gi.ct.lim.phi) <= (file_size - offset) / row_size)
+    {
+        gi.tiles = std::make_shared<pj_ctable_tiles>(owner, file_data + offset, gi);
+    }
+
+    for (std::size_t i = 0; i < gi.children.size(); i++)
+    {
+        pj_gridinfo_set_tiles(gi.children[i], owner, file_data, file_size);
+    }
+}
+
+// Loads the data of the grid and of its children which is not decoded
+// lazily. Grids which fail to load are left empty.
+template <typename IStream>
+inline void pj_gridinfo_load_all(IStream & is, pj_gi & gi)
+{
+    // vertical grids are not used
+    if (! gi.tiles && gi.format != pj_gi::gtx)
+    {
+        is.clear();
+        pj_gridinfo_load(is, gi);
+    }
+
+    for (std::size_t i = 0; i < gi.children.size(); i++)
+    {
+        pj_gridinfo_load_all(is, gi.children[i]);
+    }
+}
+
 /************************************************************************/
 /*                        pj_gridinfo_parent()                          */
 /*                                                                      */
@@ -178,6 +178,70 @@ inline bool pj_gridlist_merge_gridfile(std::string const& gridname,
 }
 
 
+// Generic stream policy and mapped grids
+template <typename StreamPolicy, typename MappedGrids>
+inline bool pj_gridlist_merge_gridfile(std::string const& gridname,
+                                       StreamPolicy const& stream_policy,
+                                       MappedGrids & grids,
+                                       std::vector<std::size_t> & gridindexes,
+                                       mapped_grids_tag)
+{
+    if (pj_gridlist_find_all(gridname, grids.published_gridinfo(), gridindexes))
+        return true;
+
+    // Read the headers.
+    typename StreamPolicy::stream_type is;
+    stream_policy.open(is, gridname);
+
+    pj_gridinfo new_grids;
+
+    if (! pj_gridinfo_init(gridname, is, new_grids))
+    {
+        return false;
+    }
+
+    // Decode the data lazily from the mapped file, or load it now if the
+    // file can not be mapped, such that the grids are not modified
+    // anymore when they are published.
+    typename MappedGrids::mapped_file_ptr file = grids.map_file(stream_policy, gridname);
+    for (std::size_t i = 0 ; i < new_grids.size() ; ++i)
+    {
+        if (file)
+        {
+            pj_gridinfo_set_tiles(new_grids[i], file,
+                                  MappedGrids::file_data(*file),
+                                  MappedGrids::file_size(*file));
+        }
+        pj_gridinfo_load_all(is, new_grids[i]);
+    }
+
+    std::size_t orig_size = 0;
+    std::size_t new_size = 0;
+
+    {
+        typename MappedGrids::write_locked lck_grids(grids);
+
+        // Try to find in the existing list of loaded grids again
+        // in case other thread already added it.
+        if (pj_gridlist_find_all(gridname, lck_grids.gridinfo, gridindexes))
+            return true;
+
+        orig_size = lck_grids.gridinfo.size();
+        new_size = orig_size + new_grids.size();
+
+        lck_grids.gridinfo.resize(new_size);
+        for (std::size_t i = 0 ; i < new_grids.size() ; ++ i)
+            new_grids[i].swap(lck_grids.gridinfo[i + orig_size]);
+
+        lck_grids.publish();
+    }
+
+    pj_gridlist_add_seq_inc(gridindexes, orig_size, new_size);
+
+    return true;
+}
+
+
 /************************************************************************/
 /*                     pj_gridlist_from_nadgrids()                      */
 /*                                                                      */
@@ -40,8 +40,12 @@
 #define BOOST_GEOMETRY_PROJECTIONS_PJ_INV_HPP
 
 
+#include <cmath>
+#include <cstddef>
 
+#include <boost/geometry/srs/projections/exception.hpp>
 #include <boost/geometry/srs/projections/impl/adjlon.hpp>
+#include <boost/geometry/srs/projections/impl/pj_fwd.hpp>
 #include <boost/geometry/core/radian_access.hpp>
 #include <boost/geometry/util/math.hpp>
 
@@ -88,6 +92,94 @@ inline void pj_inv(PRJ const& prj, PAR const& par, XY const& xy, LL& ll)
     geometry::set_from_radian<1>(ll, lat);
 }
 
+template <typename Prj, typename P>
+inline auto inv_n(Prj const& prj, P const& par, typename P::type* coords,
+                  std::size_t count, int)
+    -> decltype(prj.inv_n(par, coords, count))
+{
+    return prj.inv_n(par, coords, count);
+}
+
+/* projections without a batched variant are called for each point */
+template <typename Prj, typename P>
+inline void inv_n(Prj const& prj, P const& par, typename P::type* coords,
+                  std::size_t count, long)
+{
+    for (std::size_t i = 0; i < count; i++, coords += 2)
+    {
+        typename P::type lon = 0;
+        typename P::type lat = 0;
+        try
+        {
+            prj.inv(par, coords[0], coords[1], lon, lat);
+        }
+        catch (projection_not_invertible_exception &)
+        {
+            BOOST_RETHROW
+        }
+        catch (...)
+        {
+            lon = lat = HUGE_VAL;
+        }
+        coords[0] = lon;
+        coords[1] = lat;
+    }
+}
+
+/*
+    inverse projection of count points, stored as x, y, x, y, ..., in place
+    to lon, lat, lon, lat, ... in radians. The points that cannot be
+    projected are set to HUGE_VAL. Projections can implement
+    inv_n(par, coords, count) with the same contract, which is called
+    once for each block of points, instead of inv for each point.
+*/
+template <typename Prj, typename P>
+inline void pj_inv_n(Prj const& prj, P const& par, typename P::type* coords, std::size_t count)
+{
+    typedef typename P::type calc_t;
+    static const calc_t EPS = 1.0e-12;
+
+    std::size_t const ix = par.axis[0] == 1 ? 1 : 0;
+
+    /* descale and de-offset */
+    for (std::size_t i = 0; i < count; i++)
+    {
+        calc_t const c0 = coords[2 * i];
+        calc_t const c1 = coords[2 * i + 1];
+        calc_t const x = ix == 0 ? c0 : c1;
+        calc_t const y = ix == 0 ? c1 : c0;
+        coords[2 * i] = (x * par.to_meter * par.sign[ix] - par.x0) * par.ra;
+        coords[2 * i + 1] = (y * par.to_meter * par.sign[1 - ix] - par.y0) * par.ra;
+    }
+
+    while (count > 0)
+    {
+        std::size_t const n = count < pj_block_size ? count : pj_block_size;
+
+        inv_n(prj, par, coords, n, 0); /* inverse project */
+
+        for (std::size_t i = 0; i < n; i++)
+        {
+            calc_t& lon = coords[2 * i];
+            calc_t& lat = coords[2 * i + 1];
+            if (lon == HUGE_VAL || lat == HUGE_VAL)
+            {
+                lon = lat = HUGE_VAL;
+                continue;
+            }
+
+            lon += par.lam0; /* reduce from del lp.lam */
+            if (!par.over)
+                lon = adjlon(lon); /* adjust longitude to CM */
+            if (par.geoc && geometry::math::abs(geometry::math::abs(lat)-geometry::math::half_pi<calc_t>()) > EPS)
+                lat = atan(par.one_es * tan(lat));
+        }
+
+        coords += 2 * n;
+        count -= n;
+    }
+}
+
 } // namespace detail
 }}} // namespace boost::geometry::projections
 
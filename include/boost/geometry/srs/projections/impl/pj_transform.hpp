@@ -46,13 +46,17 @@
 
 #include <boost/geometry/srs/projections/impl/geocent.hpp>
 #include <boost/geometry/srs/projections/impl/pj_apply_gridshift.hpp>
+#include <boost/geometry/srs/projections/impl/pj_fwd.hpp>
+#include <boost/geometry/srs/projections/impl/pj_inv.hpp>
 #include <boost/geometry/srs/projections/impl/projects.hpp>
 #include <boost/geometry/srs/projections/invalid_point.hpp>
 
 #include <boost/geometry/util/range.hpp>
 
+#include <algorithm>
 #include <cstring>
 #include <cmath>
+#include <string>
 
 
 namespace boost { namespace geometry { namespace projections
@@ -203,6 +207,15 @@ static const int transient_error[60] = {
     /* 40 to 49 */ 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
     /* 50 to 59 */ 1, 0, 1, 0, 1, 1, 1, 1, 0, 0 };
 
+// Returns true for the errors making a point invalid, false for the errors
+// rethrown by pj_transform()
+inline bool pj_is_point_error(int code)
+{
+    return code == 33 /*EDOM*/
+        || code == 34 /*ERANGE*/
+        || (code <= 0 && code >= -44 && transient_error[-code] != 0);
+}
+
 
 template <typename T, typename Range>
 inline int pj_geocentric_to_geodetic( T const& a, T const& es,
@@ -370,11 +383,7 @@ inline bool pj_transform(SrcPrj const& srcprj, Par const& srcdefn,
                 }
                 catch(projection_exception const& e)
                 {
-                    if( (e.code() != 33 /*EDOM*/
-                        && e.code() != 34 /*ERANGE*/ )
-                        && (e.code() > 0
-                            || e.code() < -44 /*|| point_count == 1*/
-                            || transient_error[-e.code()] == 0) ) {
+                    if( ! pj_is_point_error(e.code()) /*|| point_count == 1*/ ) {
                         BOOST_RETHROW
                     } else {
                         set_invalid_point(point);
@@ -542,11 +551,7 @@ inline bool pj_transform(SrcPrj const& srcprj, Par const& srcdefn,
                     pj_fwd(dstprj, dstdefn, point, point);
                 } catch (projection_exception const& e) {
 
-                    if( (e.code() != 33 /*EDOM*/
-                         && e.code() != 34 /*ERANGE*/ )
-                        && (e.code() > 0
-                            || e.code() < -44 /*|| point_count == 1*/
-                            || transient_error[-e.code()] == 0) ) {
+                    if( ! pj_is_point_error(e.code()) /*|| point_count == 1*/ ) {
                         BOOST_RETHROW
                     } else {
                         set_invalid_point(point);
@@ -1023,6 +1028,338 @@ inline bool pj_datum_transform(Par const& srcdefn,
     return result;
 }
 
+/************************************************************************/
+/*                         pj_datum_is_wgs84()                          */
+/*                                                                      */
+/*      Returns TRUE if the datum shift to WGS84 does not change the    */
+/*      coordinates, e.g. +towgs84=0,0,0 or +nadgrids=@null.            */
+/************************************************************************/
+
+template <typename Par>
+inline bool pj_datum_is_wgs84( Par const& defn )
+{
+    if( defn.datum_type == datum_wgs84 )
+    {
+        return true;
+    }
+    else if( defn.datum_type == datum_3param )
+    {
+        return defn.datum_params[0] == 0.0
+            && defn.datum_params[1] == 0.0
+            && defn.datum_params[2] == 0.0;
+    }
+    else if( defn.datum_type == datum_gridshift )
+    {
+        for( std::size_t i = 0; i < defn.nadgrids.size(); i++ )
+        {
+            std::string const& name = defn.nadgrids[i];
+            if( name != "@null" && name != "null" )
+                return false;
+        }
+        return true;
+    }
+    else
+        return false;
+}
+
+/************************************************************************/
+/*                       pj_datum_is_identity()                         */
+/*                                                                      */
+/*      Returns TRUE if pj_datum_transform() does not change the        */
+/*      coordinates, apart from rounding errors of the conversion to    */
+/*      and from geocentric coordinates.                                */
+/************************************************************************/
+
+template <typename Par>
+inline bool pj_datum_is_identity( Par const& srcdefn, Par const& dstdefn )
+{
+    typedef typename Par::type calc_t;
+
+    // As in pj_datum_transform()
+    static const calc_t wgs84_a = 6378137.0;
+    static const calc_t wgs84_b = 6356752.3142451793;
+    static const calc_t wgs84_es = 1. - (wgs84_b * wgs84_b) / (wgs84_a * wgs84_a);
+
+    if( srcdefn.datum_type == datum_unknown
+        || dstdefn.datum_type == datum_unknown
+        || pj_compare_datums( srcdefn, dstdefn ) )
+        return true;
+
+    if( ! pj_datum_is_wgs84( srcdefn ) || ! pj_datum_is_wgs84( dstdefn ) )
+        return false;
+
+    bool const src_grid = srcdefn.datum_type == datum_gridshift;
+    bool const dst_grid = dstdefn.datum_type == datum_gridshift;
+    calc_t const src_a = src_grid ? wgs84_a : srcdefn.a_orig;
+    calc_t const src_es = src_grid ? wgs84_es : srcdefn.es_orig;
+    calc_t const dst_a = dst_grid ? wgs84_a : dstdefn.a_orig;
+    calc_t const dst_es = dst_grid ? wgs84_es : dstdefn.es_orig;
+
+    // otherwise the coordinates are converted to and from geocentric
+    // coordinates with different ellipsoids
+    return src_a == dst_a && src_es == dst_es;
+}
+
+/************************************************************************/
+/*                         pj_transform_steps                           */
+/*                                                                      */
+/*      The steps of pj_transform() needed for a pair of coordinate     */
+/*      systems, decided once instead of for each call. If neither      */
+/*      system is geocentric and the datum shift does not change the    */
+/*      coordinates, the points are transformed in blocks in a single   */
+/*      pass, with the batched pj_inv_n() and pj_fwd_n().               */
+/************************************************************************/
+
+template <typename T>
+struct pj_transform_steps
+{
+    template <typename Par>
+    pj_transform_steps(Par const& srcdefn, Par const& dstdefn)
+        : single_pass( ! srcdefn.is_geocent && ! dstdefn.is_geocent
+                       && pj_datum_is_identity( srcdefn, dstdefn ) )
+        , inverse( ! srcdefn.is_latlong )
+        , forward( ! dstdefn.is_latlong )
+        , long_wrap( dstdefn.is_latlong && dstdefn.is_long_wrap_set )
+        , prime_meridian( srcdefn.from_greenwich != 0.0
+                          || dstdefn.from_greenwich != 0.0 )
+        , vertical_units( srcdefn.vto_meter != 1.0
+                          || dstdefn.vto_meter != 1.0 )
+        , src_from_greenwich( srcdefn.from_greenwich )
+        , dst_from_greenwich( dstdefn.from_greenwich )
+        , long_wrap_center( dstdefn.long_wrap_center )
+        , src_vto_meter( srcdefn.vto_meter )
+        , dst_vfr_meter( dstdefn.vto_meter != 1.0 ? dstdefn.vfr_meter : T(1) )
+    {}
+
+    bool single_pass;
+    bool inverse;
+    bool forward;
+    bool long_wrap;
+    bool prime_meridian;
+    bool vertical_units;
+    T src_from_greenwich;
+    T dst_from_greenwich;
+    T long_wrap_center;
+    T src_vto_meter;
+    T dst_vfr_meter;
+};
+
+/************************************************************************/
+/*                        pj_transform_pipeline                         */
+/*                                                                      */
+/*      Transforms ranges of points like pj_transform() does, with      */
+/*      the steps decided in advance.                                   */
+/************************************************************************/
+
+template <typename SrcPrj, typename DstPrj, typename Par>
+class pj_transform_pipeline
+{
+public:
+    typedef typename Par::type calc_t;
+
+    pj_transform_pipeline(SrcPrj const& srcprj, Par const& srcdefn,
+                          DstPrj const& dstprj, Par const& dstdefn,
+                          pj_transform_steps<calc_t> const& steps)
+        : m_srcprj(srcprj), m_srcdefn(srcdefn)
+        , m_dstprj(dstprj), m_dstdefn(dstdefn)
+        , m_steps(steps)
+    {}
+
+    Par const& src_params() const { return m_srcdefn; }
+    Par const& dst_params() const { return m_dstdefn; }
+
+    template <typename Range, typename Grids>
+    bool apply(Range & range, Grids const& srcgrids, Grids const& dstgrids) const
+    {
+        if( ! m_steps.single_pass )
+            return pj_transform( m_srcprj, m_srcdefn, m_dstprj, m_dstdefn,
+                                 range, srcgrids, dstgrids );
+
+        std::size_t const point_count = boost::size(range);
+        bool result = true;
+
+        for( std::size_t i = 0; i < point_count; i += pj_block_size )
+        {
+            std::size_t const count = (std::min)(pj_block_size, point_count - i);
+            if( ! apply_block( range, i, count ) )
+                result = false;
+        }
+
+        apply_vertical_units( range );
+
+        return result;
+    }
+
+private:
+    template <typename Range>
+    bool apply_block(Range & range, std::size_t first, std::size_t count) const
+    {
+        typedef typename boost::range_value<Range>::type point_type;
+
+        // lon, lat or x, y of the valid points of the block
+        calc_t coords[2 * pj_block_size];
+        std::size_t indexes[pj_block_size];
+        std::size_t n = 0;
+
+        for( std::size_t i = first; i < first + count; i++ )
+        {
+            point_type const& point = range::at(range, i);
+
+            if( is_invalid_point(point) )
+                continue;
+
+            if( m_steps.inverse )
+            {
+                coords[2 * n] = get<0>(point);
+                coords[2 * n + 1] = get<1>(point);
+            }
+            else
+            {
+                coords[2 * n] = get_as_radian<0>(point);
+                coords[2 * n + 1] = get_as_radian<1>(point);
+            }
+            indexes[n++] = i;
+        }
+
+        if( m_steps.inverse )
+        {
+            pj_inv_n( m_srcprj, m_srcdefn, coords, n );
+
+            for( std::size_t j = 0; j < n; j++ )
+            {
+                if( coords[2 * j] != HUGE_VAL )
+                    continue;
+
+                point_type point = range::at(range, indexes[j]);
+                check_point_error( [&]() { pj_inv( m_srcprj, m_srcdefn, point, point ); } );
+            }
+        }
+
+        if( m_steps.prime_meridian )
+        {
+            for( std::size_t j = 0; j < n; j++ )
+            {
+                if( coords[2 * j] == HUGE_VAL )
+                    continue;
+
+                coords[2 * j] += m_steps.src_from_greenwich;
+                coords[2 * j] -= m_steps.dst_from_greenwich;
+            }
+        }
+
+        if( m_steps.forward )
+        {
+            calc_t lonlat[2 * pj_block_size];
+            std::copy( coords, coords + 2 * n, lonlat );
+
+            pj_fwd_n( m_dstprj, m_dstdefn, coords, n );
+
+            for( std::size_t j = 0; j < n; j++ )
+            {
+                if( coords[2 * j] != HUGE_VAL || lonlat[2 * j] == HUGE_VAL )
+                    continue;
+
+                point_type point = range::at(range, indexes[j]);
+                set_from_radian<0>(point, lonlat[2 * j]);
+                set_from_radian<1>(point, lonlat[2 * j + 1]);
+                check_point_error( [&]() { pj_fwd( m_dstprj, m_dstdefn, point, point ); } );
+            }
+        }
+        else if( m_steps.long_wrap )
+        {
+            calc_t const pi = math::pi<calc_t>();
+            calc_t const two_pi = math::two_pi<calc_t>();
+
+            for( std::size_t j = 0; j < n; j++ )
+            {
+                calc_t & x = coords[2 * j];
+
+                if( x == HUGE_VAL )
+                    continue;
+
+                while( x < m_steps.long_wrap_center - pi )
+                    x += two_pi;
+                while( x > m_steps.long_wrap_center + pi )
+                    x -= two_pi;
+            }
+        }
+
+        bool result = true;
+        for( std::size_t j = 0; j < n; j++ )
+        {
+            point_type & point = range::at(range, indexes[j]);
+
+            if( coords[2 * j] == HUGE_VAL )
+            {
+                set_invalid_point(point);
+                result = false;
+            }
+            else if( m_steps.forward )
+            {
+                set<0>(point, coords[2 * j]);
+                set<1>(point, coords[2 * j + 1]);
+            }
+            else
+            {
+                set_from_radian<0>(point, coords[2 * j]);
+                set_from_radian<1>(point, coords[2 * j + 1]);
+            }
+        }
+
+        return result;
+    }
+
+    // The batched projections set the points which can not be projected to
+    // HUGE_VAL. Such a point is projected again alone, to rethrow its error
+    // if pj_transform() would.
+    template <typename Project>
+    static void check_point_error(Project const& project)
+    {
+        try
+        {
+            project();
+        }
+        catch(projection_exception const& e)
+        {
+            if( ! pj_is_point_error(e.code()) )
+                BOOST_RETHROW
+        }
+    }
+
+    template <typename Range>
+    void apply_vertical_units(Range & range) const
+    {
+        typedef typename boost::range_value<Range>::type point_type;
+
+        if( geometry::dimension<point_type>::value <= 2 || ! m_steps.vertical_units )
+            return;
+
+        std::size_t const point_count = boost::size(range);
+        for( std::size_t i = 0; i < point_count; i++ )
+        {
+            point_type & point = range::at(range, i);
+            set_z(point, get_z(point) * m_steps.src_vto_meter * m_steps.dst_vfr_meter);
+        }
+    }
+
+    SrcPrj const& m_srcprj;
+    Par const& m_srcdefn;
+    DstPrj const& m_dstprj;
+    Par const& m_dstdefn;
+    pj_transform_steps<calc_t> const& m_steps;
+};
+
+template <typename SrcPrj, typename DstPrj, typename Par>
+inline pj_transform_pipeline<SrcPrj, DstPrj, Par>
+make_pj_transform_pipeline(SrcPrj const& srcprj, Par const& srcdefn,
+                           DstPrj const& dstprj, Par const& dstdefn,
+                           pj_transform_steps<typename Par::type> const& steps)
+{
+    return pj_transform_pipeline<SrcPrj, DstPrj, Par>(srcprj, srcdefn,
+                                                      dstprj, dstdefn,
+                                                      steps);
+}
+
 } // namespace detail
 
 }}} // namespace boost::geometry::projections
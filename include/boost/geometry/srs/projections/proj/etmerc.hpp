@@ -54,6 +54,8 @@
 #ifndef BOOST_GEOMETRY_PROJECTIONS_ETMERC_HPP
 #define BOOST_GEOMETRY_PROJECTIONS_ETMERC_HPP
 
+#include <cstddef>
+
 #include <boost/geometry/srs/projections/impl/base_static.hpp>
 #include <boost/geometry/srs/projections/impl/base_dynamic.hpp>
 #include <boost/geometry/srs/projections/impl/factory_entry.hpp>
@@ -171,6 +173,25 @@ namespace projections
                 // FORWARD(e_forward)  ellipsoid
                 // Project coordinates from geographic (lon, lat) to cartesian (x, y)
                 inline void fwd(Parameters const& , T const& lp_lon, T const& lp_lat, T& xy_x, T& xy_y) const
+                {
+                    if (! fwd_point(lp_lon, lp_lat, xy_x, xy_y)) {
+                        BOOST_THROW_EXCEPTION( projection_exception(error_tolerance_condition) );
+                    }
+                }
+
+                // Batched forward, as fwd but without exception
+                inline void fwd_n(Parameters const& , T* coords, std::size_t count) const
+                {
+                    for (std::size_t i = 0; i < count; i++) {
+                        T const lp_lon = coords[2 * i];
+                        T const lp_lat = coords[2 * i + 1];
+                        fwd_point(lp_lon, lp_lat, coords[2 * i], coords[2 * i + 1]);
+                    }
+                }
+
+                // Forward without exception, the point is set to HUGE_VAL
+                // if it cannot be projected
+                inline bool fwd_point(T const& lp_lon, T const& lp_lat, T& xy_x, T& xy_y) const
                 {
                     T sin_Cn, cos_Cn, cos_Ce, sin_Ce, dCn, dCe;
                     T Cn = lp_lat, Ce = lp_lon;
@@ -193,8 +214,10 @@ namespace projections
                     if (fabs(Ce) <= 2.623395162778) {
                         xy_y  = this->m_proj_parm.Qn * Cn + this->m_proj_parm.Zb;  /* Northing */
                         xy_x  = this->m_proj_parm.Qn * Ce;  /* Easting  */
-                    } else
-                        xy_x = xy_y = HUGE_VAL;
+                        return true;
+                    }
+                    xy_x = xy_y = HUGE_VAL;
+                    return false;
                 }
 
                 // INVERSE(e_inverse)  ellipsoid
@@ -228,6 +251,16 @@ namespace projections
                         lp_lat = lp_lon = HUGE_VAL;
                 }
 
+                // Batched inverse, inv does not throw
+                inline void inv_n(Parameters const& par, T* coords, std::size_t count) const
+                {
+                    for (std::size_t i = 0; i < count; i++) {
+                        T const xy_x = coords[2 * i];
+                        T const xy_y = coords[2 * i + 1];
+                        inv(par, xy_x, xy_y, coords[2 * i], coords[2 * i + 1]);
+                    }
+                }
+
                 static inline std::string get_name()
                 {
                     return "etmerc_ellipsoid";
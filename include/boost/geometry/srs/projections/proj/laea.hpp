@@ -40,6 +40,8 @@
 #ifndef BOOST_GEOMETRY_PROJECTIONS_LAEA_HPP
 #define BOOST_GEOMETRY_PROJECTIONS_LAEA_HPP
 
+#include <cstddef>
+
 #include <boost/config.hpp>
 #include <boost/geometry/util/math.hpp>
 #include <boost/math/special_functions/hypot.hpp>
@@ -150,6 +152,68 @@ namespace projections
                     }
                 }
 
+                // Batched forward, the mode is selected once for all points
+                // Points which cannot be projected are set to HUGE_VAL
+                inline void fwd_n(Parameters const& par, T* coords, std::size_t count) const
+                {
+                    switch (this->m_proj_parm.mode) {
+                    case obliq:
+                        fwd_n<obliq>(par, coords, count);
+                        break;
+                    case equit:
+                        fwd_n<equit>(par, coords, count);
+                        break;
+                    case n_pole:
+                        fwd_n<n_pole>(par, coords, count);
+                        break;
+                    case s_pole:
+                        fwd_n<s_pole>(par, coords, count);
+                        break;
+                    }
+                }
+
+                template <mode_type Mode>
+                inline void fwd_n(Parameters const& par, T* coords, std::size_t count) const
+                {
+                    static const T half_pi = detail::half_pi<T>();
+
+                    for (std::size_t i = 0; i < count; i++) {
+                        T const lp_lon = coords[2 * i];
+                        T const lp_lat = coords[2 * i + 1];
+                        T const coslam = cos(lp_lon);
+                        T const sinlam = sin(lp_lon);
+                        T const sinphi = sin(lp_lat);
+                        T q = pj_qsfn(sinphi, par.e, par.one_es);
+                        T b, xy_x, xy_y;
+
+                        if (Mode == obliq || Mode == equit) {
+                            T const sinb = q / this->m_proj_parm.qp;
+                            T const cosb = sqrt(1. - sinb * sinb);
+                            if (Mode == obliq) {
+                                b = 1. + this->m_proj_parm.sinb1 * sinb + this->m_proj_parm.cosb1 * cosb * coslam;
+                                T const bs = sqrt(2. / b);
+                                xy_y = this->m_proj_parm.ymf * bs * (this->m_proj_parm.cosb1 * sinb - this->m_proj_parm.sinb1 * cosb * coslam);
+                                xy_x = this->m_proj_parm.xmf * bs * cosb * sinlam;
+                            } else {
+                                b = 1. + cosb * coslam;
+                                T const bs = sqrt(2. / (1. + cosb * coslam));
+                                xy_y = bs * sinb * this->m_proj_parm.ymf;
+                                xy_x = this->m_proj_parm.xmf * bs * cosb * sinlam;
+                            }
+                        } else {
+                            b = Mode == n_pole ? half_pi + lp_lat : lp_lat - half_pi;
+                            q = Mode == n_pole ? this->m_proj_parm.qp - q : this->m_proj_parm.qp + q;
+                            T const bs = sqrt(q);
+                            xy_x = q >= 0. ? bs * sinlam : 0.;
+                            xy_y = q >= 0. ? coslam * (Mode == s_pole ? bs : -bs) : 0.;
+                        }
+
+                        bool const valid = ! (fabs(b) < epsilon10);
+                        coords[2 * i] = valid ? xy_x : HUGE_VAL;
+                        coords[2 * i + 1] = valid ? xy_y : HUGE_VAL;
+                    }
+                }
+
                 // INVERSE(e_inverse)  ellipsoid
                 // Project coordinates from cartesian (x, y) to geographic (lon, lat)
                 inline void inv(Parameters const& par, T xy_x, T xy_y, T& lp_lon, T& lp_lat) const
@@ -251,6 +315,62 @@ namespace projections
                     }
                 }
 
+                // Batched forward, the mode is selected once for all points
+                // Points which cannot be projected are set to HUGE_VAL
+                inline void fwd_n(Parameters const& par, T* coords, std::size_t count) const
+                {
+                    switch (this->m_proj_parm.mode) {
+                    case obliq:
+                        fwd_n<obliq>(par, coords, count);
+                        break;
+                    case equit:
+                        fwd_n<equit>(par, coords, count);
+                        break;
+                    case n_pole:
+                        fwd_n<n_pole>(par, coords, count);
+                        break;
+                    case s_pole:
+                        fwd_n<s_pole>(par, coords, count);
+                        break;
+                    }
+                }
+
+                template <mode_type Mode>
+                inline void fwd_n(Parameters const& par, T* coords, std::size_t count) const
+                {
+                    static const T fourth_pi = detail::fourth_pi<T>();
+
+                    for (std::size_t i = 0; i < count; i++) {
+                        T const lp_lon = coords[2 * i];
+                        T const lp_lat = coords[2 * i + 1];
+                        T const sinphi = sin(lp_lat);
+                        T const cosphi = cos(lp_lat);
+                        T const coslam = cos(lp_lon);
+                        T xy_x, xy_y;
+                        bool valid;
+
+                        if (Mode == obliq || Mode == equit) {
+                            xy_y = Mode == equit
+                                 ? 1. + cosphi * coslam
+                                 : 1. + this->m_proj_parm.sinb1 * sinphi + this->m_proj_parm.cosb1 * cosphi * coslam;
+                            valid = ! (xy_y <= epsilon10);
+                            xy_y = sqrt(2. / xy_y);
+                            xy_x = xy_y * cosphi * sin(lp_lon);
+                            xy_y *= Mode == equit ? sinphi :
+                               this->m_proj_parm.cosb1 * sinphi - this->m_proj_parm.sinb1 * cosphi * coslam;
+                        } else {
+                            valid = ! (fabs(lp_lat + par.phi0) < epsilon10);
+                            xy_y = fourth_pi - lp_lat * .5;
+                            xy_y = 2. * (Mode == s_pole ? cos(xy_y) : sin(xy_y));
+                            xy_x = xy_y * sin(lp_lon);
+                            xy_y *= Mode == n_pole ? -coslam : coslam;
+                        }
+
+                        coords[2 * i] = valid ? xy_x : HUGE_VAL;
+                        coords[2 * i + 1] = valid ? xy_y : HUGE_VAL;
+                    }
+                }
+
                 // INVERSE(s_inverse)  spheroid
                 // Project coordinates from cartesian (x, y) to geographic (lon, lat)
                 inline void inv(Parameters const& par, T xy_x, T xy_y, T& lp_lon, T& lp_lat) const
@@ -40,6 +40,8 @@
 #ifndef BOOST_GEOMETRY_PROJECTIONS_LCC_HPP
 #define BOOST_GEOMETRY_PROJECTIONS_LCC_HPP
 
+#include <cstddef>
+
 #include <boost/geometry/srs/projections/impl/base_static.hpp>
 #include <boost/geometry/srs/projections/impl/base_dynamic.hpp>
 #include <boost/geometry/srs/projections/impl/factory_entry.hpp>
@@ -103,6 +105,37 @@ namespace projections
                     xy_y = par.k0 * (this->m_proj_parm.rho0 - rho * cos(lp_lon) );
                 }
 
+                // Batched forward, without exceptions in the loops
+                // Points which cannot be projected are set to HUGE_VAL
+                inline void fwd_n(Parameters const& par, T* coords, std::size_t count) const
+                {
+                    if (this->m_proj_parm.ellips) {
+                        fwd_n<true>(par, coords, count);
+                    } else {
+                        fwd_n<false>(par, coords, count);
+                    }
+                }
+
+                template <bool Ellips>
+                inline void fwd_n(Parameters const& par, T* coords, std::size_t count) const
+                {
+                    static const T fourth_pi = detail::fourth_pi<T>();
+                    static const T half_pi = detail::half_pi<T>();
+
+                    for (std::size_t i = 0; i < count; i++) {
+                        T const lp_lon = coords[2 * i] * this->m_proj_parm.n;
+                        T const lp_lat = coords[2 * i + 1];
+
+                        bool const at_pole = fabs(fabs(lp_lat) - half_pi) < epsilon10;
+                        bool const valid = ! at_pole || (lp_lat * this->m_proj_parm.n) > 0.;
+                        T const rho = at_pole ? T(0) : this->m_proj_parm.c * (Ellips
+                            ? math::pow(pj_tsfn(lp_lat, sin(lp_lat), par.e), this->m_proj_parm.n)
+                            : math::pow(tan(fourth_pi + T(0.5) * lp_lat), -this->m_proj_parm.n));
+                        coords[2 * i] = valid ? par.k0 * (rho * sin( lp_lon) ) : HUGE_VAL;
+                        coords[2 * i + 1] = valid ? par.k0 * (this->m_proj_parm.rho0 - rho * cos(lp_lon) ) : HUGE_VAL;
+                    }
+                }
+
                 // INVERSE(e_inverse)  ellipsoid & spheroid
                 // Project coordinates from cartesian (x, y) to geographic (lon, lat)
                 inline void inv(Parameters const& par, T xy_x, T xy_y, T& lp_lon, T& lp_lat) const
@@ -41,6 +41,8 @@
 #ifndef BOOST_GEOMETRY_PROJECTIONS_MERC_HPP
 #define BOOST_GEOMETRY_PROJECTIONS_MERC_HPP
 
+#include <cstddef>
+
 #include <boost/geometry/srs/projections/impl/base_static.hpp>
 #include <boost/geometry/srs/projections/impl/base_dynamic.hpp>
 #include <boost/geometry/srs/projections/impl/factory_entry.hpp>
@@ -79,6 +81,23 @@ namespace projections
                     xy_y = - par.k0 * log(pj_tsfn(lp_lat, sin(lp_lat), par.e));
                 }
 
+                // Batched forward, without branches or exceptions in the loop
+                // Points which cannot be projected are set to HUGE_VAL
+                inline void fwd_n(Parameters const& par, T* coords, std::size_t count) const
+                {
+                    static const T half_pi = detail::half_pi<T>();
+
+                    for (std::size_t i = 0; i < count; i++)
+                    {
+                        T const lp_lon = coords[2 * i];
+                        T const lp_lat = coords[2 * i + 1];
+                        bool const valid = fabs(fabs(lp_lat) - half_pi) > epsilon10;
+                        T const xy_y = - par.k0 * log(pj_tsfn(lp_lat, sin(lp_lat), par.e));
+                        coords[2 * i] = valid ? par.k0 * lp_lon : HUGE_VAL;
+                        coords[2 * i + 1] = valid ? xy_y : HUGE_VAL;
+                    }
+                }
+
                 // INVERSE(e_inverse)  ellipsoid
                 // Project coordinates from cartesian (x, y) to geographic (lon, lat)
                 inline void inv(Parameters const& par, T const& xy_x, T const& xy_y, T& lp_lon, T& lp_lat) const
@@ -113,6 +132,24 @@ namespace projections
                     xy_y = par.k0 * log(tan(fourth_pi + .5 * lp_lat));
                 }
 
+                // Batched forward, without branches or exceptions in the loop
+                // Points which cannot be projected are set to HUGE_VAL
+                inline void fwd_n(Parameters const& par, T* coords, std::size_t count) const
+                {
+                    static const T half_pi = detail::half_pi<T>();
+                    static const T fourth_pi = detail::fourth_pi<T>();
+
+                    for (std::size_t i = 0; i < count; i++)
+                    {
+                        T const lp_lon = coords[2 * i];
+                        T const lp_lat = coords[2 * i + 1];
+                        bool const valid = fabs(fabs(lp_lat) - half_pi) > epsilon10;
+                        T const xy_y = par.k0 * log(tan(fourth_pi + .5 * lp_lat));
+                        coords[2 * i] = valid ? par.k0 * lp_lon : HUGE_VAL;
+                        coords[2 * i + 1] = valid ? xy_y : HUGE_VAL;
+                    }
+                }
+
                 // INVERSE(s_inverse)  spheroid
                 // Project coordinates from cartesian (x, y) to geographic (lon, lat)
                 inline void inv(Parameters const& par, T const& xy_x, T const& xy_y, T& lp_lon, T& lp_lat) const
@@ -123,6 +160,20 @@ namespace projections
                     lp_lon = xy_x / par.k0;
                 }
 
+                // Batched inverse
+                inline void inv_n(Parameters const& par, T* coords, std::size_t count) const
+                {
+                    static const T half_pi = detail::half_pi<T>();
+
+                    for (std::size_t i = 0; i < count; i++)
+                    {
+                        T const xy_x = coords[2 * i];
+                        T const xy_y = coords[2 * i + 1];
+                        coords[2 * i] = xy_x / par.k0;
+                        coords[2 * i + 1] = half_pi - 2. * atan(exp(-xy_y / par.k0));
+                    }
+                }
+
                 static inline std::string get_name()
                 {
                     return "merc_spheroid";
@@ -41,6 +41,8 @@
 #ifndef BOOST_GEOMETRY_PROJECTIONS_TMERC_HPP
 #define BOOST_GEOMETRY_PROJECTIONS_TMERC_HPP
 
+#include <cstddef>
+
 #include <boost/geometry/util/math.hpp>
 
 #include <boost/geometry/srs/projections/impl/base_static.hpp>
@@ -291,10 +293,29 @@ namespace projections
 
             /* Ellipsoidal, forward */
             //static PJ_XY exact_e_fwd (PJ_LP lp, PJ *P)
-            inline void fwd(Parameters const& par, 
+            inline void fwd(Parameters const& , 
                             T const& lp_lon, 
                             T const& lp_lat, 
                             T& xy_x, T& xy_y) const 
+            {
+                if (! fwd_point(lp_lon, lp_lat, xy_x, xy_y)) {
+                    BOOST_THROW_EXCEPTION( projection_exception(error_tolerance_condition) );
+                }
+            }
+
+            /* Ellipsoidal, forward, batched */
+            inline void fwd_n(Parameters const& , T* coords, std::size_t count) const
+            {
+                for (std::size_t i = 0; i < count; i++) {
+                    T const lp_lon = coords[2 * i];
+                    T const lp_lat = coords[2 * i + 1];
+                    fwd_point(lp_lon, lp_lat, coords[2 * i], coords[2 * i + 1]);
+                }
+            }
+
+            /* Ellipsoidal, forward, without exception, the point is set */
+            /* to HUGE_VAL if it cannot be projected */
+            inline bool fwd_point(T const& lp_lon, T const& lp_lat, T& xy_x, T& xy_y) const
             {
                 //PJ_XY xy = {0.0,0.0};
                 //const auto *Q = &(static_cast<struct tmerc_data*>(par.opaque)->exact);
@@ -371,22 +392,38 @@ namespace projections
                             sin_arg_r, cos_arg_r, sinh_arg_i, cosh_arg_i,
                             &dCn, &dCe);
                 Ce += dCe;
-                if (fabs (Ce) <= 2.623395162778) {
-                    xy_y  = this->m_proj_parm.Qn * Cn + this->m_proj_parm.Zb;  /* Northing */
-                    xy_x  = this->m_proj_parm.Qn * Ce;          /* Easting  */
-                } else {
-                    BOOST_THROW_EXCEPTION( projection_exception(error_tolerance_condition) );
-                    xy_x = xy_y = HUGE_VAL;
-                }
+                bool const valid = fabs (Ce) <= 2.623395162778;
+                xy_y  = valid ? this->m_proj_parm.Qn * Cn + this->m_proj_parm.Zb : HUGE_VAL;  /* Northing */
+                xy_x  = valid ? this->m_proj_parm.Qn * Ce : HUGE_VAL;          /* Easting  */
+                return valid;
             }
 
 
             /* Ellipsoidal, inverse */
-            inline void inv(Parameters const& par, 
+            inline void inv(Parameters const& , 
                             T const& xy_x, 
                             T const& xy_y, 
                             T& lp_lon, 
                             T& lp_lat) const
+            {
+                if (! inv_point(xy_x, xy_y, lp_lon, lp_lat)) {
+                    BOOST_THROW_EXCEPTION( projection_exception(error_tolerance_condition) );
+                }
+            }
+
+            /* Ellipsoidal, inverse, batched */
+            inline void inv_n(Parameters const& , T* coords, std::size_t count) const
+            {
+                for (std::size_t i = 0; i < count; i++) {
+                    T const xy_x = coords[2 * i];
+                    T const xy_y = coords[2 * i + 1];
+                    inv_point(xy_x, xy_y, coords[2 * i], coords[2 * i + 1]);
+                }
+            }
+
+            /* Ellipsoidal, inverse, without exception, the point is set */
+            /* to HUGE_VAL if it cannot be projected */
+            inline bool inv_point(T const& xy_x, T const& xy_y, T& lp_lon, T& lp_lat) const
             {
                 //PJ_LP lp = {0.0,0.0};
                 //const auto *Q = &(static_cast<struct tmerc_data*>(par.opaque)->exact);
@@ -453,10 +490,11 @@ namespace projections
 
                     lp_lat = gatg (this->m_proj_parm.cgb,  proj_etmerc_order, Cn, cos_2_Cn, sin_2_Cn);
                     lp_lon = Ce;
+                    return true;
                 }
                 else {
-                    BOOST_THROW_EXCEPTION( projection_exception(error_tolerance_condition) );
                     lp_lat = lp_lon = HUGE_VAL;
+                    return false;
                 }
             }
 
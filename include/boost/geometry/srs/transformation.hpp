@@ -11,12 +11,16 @@
 #define BOOST_GEOMETRY_SRS_TRANSFORMATION_HPP
 
 
+#include <algorithm>
+#include <cstddef>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 #include <boost/throw_exception.hpp>
 
 #include <boost/geometry/algorithms/convert.hpp>
+#include <boost/geometry/algorithms/num_points.hpp>
 
 #include <boost/geometry/core/coordinate_dimension.hpp>
 #include <boost/geometry/core/static_assert.hpp>
@@ -31,6 +35,9 @@
 #include <boost/geometry/srs/projections/grids.hpp>
 #include <boost/geometry/srs/projections/impl/pj_transform.hpp>
 
+#include <boost/geometry/util/parallel_for.hpp>
+#include <boost/geometry/util/range.hpp>
+
 #include <boost/geometry/views/detail/indexed_point_view.hpp>
 
 
@@ -285,39 +292,63 @@ private:
     OutGeometry & m_out;
 };
 
+template <typename Pipeline, typename Range, typename Grids>
+inline bool transform_points(Pipeline const& pipeline,
+                             Range & range,
+                             Grids const& grids1, Grids const& grids2)
+{
+    bool res = true;
+    try
+    {
+        res = pipeline.apply(range, grids1, grids2);
+    }
+    catch (projection_exception const&)
+    {
+        res = false;
+    }
+    catch(...)
+    {
+        BOOST_RETHROW
+    }
+    return res;
+}
+
+// The steps of pj_transform() in both directions, decided when the
+// transformation is created
+template <typename T>
+struct transformation_steps
+{
+    template <typename Par>
+    transformation_steps(Par const& par1, Par const& par2)
+        : forward(par1, par2)
+        , inverse(par2, par1)
+    {}
+
+    pj_transform_steps<T> forward;
+    pj_transform_steps<T> inverse;
+};
+
 template <typename CT>
 struct transform_range
 {
     template
     <
-        typename Proj1, typename Par1,
-        typename Proj2, typename Par2,
+        typename Pipeline,
         typename RangeIn, typename RangeOut,
         typename Grids
     >
-    static inline bool apply(Proj1 const& proj1, Par1 const& par1,
-                             Proj2 const& proj2, Par2 const& par2,
+    static inline bool apply(Pipeline const& pipeline,
                              RangeIn const& in, RangeOut & out,
                              Grids const& grids1, Grids const& grids2)
     {
         // NOTE: this has to be consistent with pj_transform()
-        bool const input_angles = !par1.is_geocent && par1.is_latlong;
+        bool const input_angles = !pipeline.src_params().is_geocent
+                                && pipeline.src_params().is_latlong;
 
         transform_geometry_wrapper<RangeOut, CT> wrapper(in, out, input_angles);
 
-        bool res = true;
-        try
-        {
-            res = pj_transform(proj1, par1, proj2, par2, wrapper.get(), grids1, grids2);
-        }
-        catch (projection_exception const&)
-        {
-            res = false;
-        }
-        catch(...)
-        {
-            BOOST_RETHROW
-        }
+        bool const res = transform_points(pipeline,
+                                          wrapper.get(), grids1, grids2);
 
         wrapper.finish();
 
@@ -330,20 +361,18 @@ struct transform_multi
 {
     template
     <
-        typename Proj1, typename Par1,
-        typename Proj2, typename Par2,
+        typename Pipeline,
         typename MultiIn, typename MultiOut,
         typename Grids
     >
-    static inline bool apply(Proj1 const& proj1, Par1 const& par1,
-                             Proj2 const& proj2, Par2 const& par2,
+    static inline bool apply(Pipeline const& pipeline,
                              MultiIn const& in, MultiOut & out,
                              Grids const& grids1, Grids const& grids2)
     {
         if (! same_object(in, out))
             range::resize(out, boost::size(in));
 
-        return apply(proj1, par1, proj2, par2,
+        return apply(pipeline,
                      boost::begin(in), boost::end(in),
                      boost::begin(out),
                      grids1, grids2);
@@ -352,20 +381,18 @@ struct transform_multi
 private:
     template
     <
-        typename Proj1, typename Par1,
-        typename Proj2, typename Par2,
+        typename Pipeline,
         typename InIt, typename OutIt,
         typename Grids
     >
-    static inline bool apply(Proj1 const& proj1, Par1 const& par1,
-                             Proj2 const& proj2, Par2 const& par2,
+    static inline bool apply(Pipeline const& pipeline,
                              InIt in_first, InIt in_last, OutIt out_first,
                              Grids const& grids1, Grids const& grids2)
     {
         bool res = true;
         for ( ; in_first != in_last ; ++in_first, ++out_first )
         {
-            if ( ! Policy::apply(proj1, par1, proj2, par2, *in_first, *out_first, grids1, grids2) )
+            if ( ! Policy::apply(pipeline, *in_first, *out_first, grids1, grids2) )
             {
                 res = false;
             }
@@ -389,18 +416,17 @@ struct transform<Point, CT, point_tag>
 {
     template
     <
-        typename Proj1, typename Par1,
-        typename Proj2, typename Par2,
+        typename Pipeline,
         typename PointIn, typename PointOut,
         typename Grids
     >
-    static inline bool apply(Proj1 const& proj1, Par1 const& par1,
-                             Proj2 const& proj2, Par2 const& par2,
+    static inline bool apply(Pipeline const& pipeline,
                              PointIn const& in, PointOut & out,
                              Grids const& grids1, Grids const& grids2)
     {
         // NOTE: this has to be consistent with pj_transform()
-        bool const input_angles = !par1.is_geocent && par1.is_latlong;
+        bool const input_angles = !pipeline.src_params().is_geocent
+                                && pipeline.src_params().is_latlong;
 
         transform_geometry_wrapper<PointOut, CT> wrapper(in, out, input_angles);
 
@@ -409,19 +435,7 @@ struct transform<Point, CT, point_tag>
 
         std::pair<point_type *, point_type *> range = std::make_pair(ptr, ptr + 1);
 
-        bool res = true;
-        try
-        {
-            res = pj_transform(proj1, par1, proj2, par2, range, grids1, grids2);
-        }
-        catch (projection_exception const&)
-        {
-            res = false;
-        }
-        catch(...)
-        {
-            BOOST_RETHROW
-        }
+        bool const res = transform_points(pipeline, range, grids1, grids2);
 
         wrapper.finish();
 
@@ -439,18 +453,17 @@ struct transform<Segment, CT, segment_tag>
 {
     template
     <
-        typename Proj1, typename Par1,
-        typename Proj2, typename Par2,
+        typename Pipeline,
         typename SegmentIn, typename SegmentOut,
         typename Grids
     >
-    static inline bool apply(Proj1 const& proj1, Par1 const& par1,
-                             Proj2 const& proj2, Par2 const& par2,
+    static inline bool apply(Pipeline const& pipeline,
                              SegmentIn const& in, SegmentOut & out,
                              Grids const& grids1, Grids const& grids2)
     {
         // NOTE: this has to be consistent with pj_transform()
-        bool const input_angles = !par1.is_geocent && par1.is_latlong;
+        bool const input_angles = !pipeline.src_params().is_geocent
+                                && pipeline.src_params().is_latlong;
 
         transform_geometry_wrapper<SegmentOut, CT> wrapper(in, out, input_angles);
 
@@ -466,19 +479,7 @@ struct transform<Segment, CT, segment_tag>
 
         std::pair<point_type*, point_type*> range = std::make_pair(points, points + 2);
 
-        bool res = true;
-        try
-        {
-            res = pj_transform(proj1, par1, proj2, par2, range, grids1, grids2);
-        }
-        catch (projection_exception const&)
-        {
-            res = false;
-        }
-        catch(...)
-        {
-            BOOST_RETHROW
-        }
+        bool const res = transform_points(pipeline, range, grids1, grids2);
 
         geometry::detail::assign_point_to_index<0>(points[0], wrapper.get());
         geometry::detail::assign_point_to_index<1>(points[1], wrapper.get());
@@ -509,27 +510,25 @@ struct transform<Polygon, CT, polygon_tag>
 {
     template
     <
-        typename Proj1, typename Par1,
-        typename Proj2, typename Par2,
+        typename Pipeline,
         typename PolygonIn, typename PolygonOut,
         typename Grids
     >
-    static inline bool apply(Proj1 const& proj1, Par1 const& par1,
-                             Proj2 const& proj2, Par2 const& par2,
+    static inline bool apply(Pipeline const& pipeline,
                              PolygonIn const& in, PolygonOut & out,
                              Grids const& grids1, Grids const& grids2)
     {
         bool r1 = transform_range
                     <
                         CT
-                    >::apply(proj1, par1, proj2, par2,
+                    >::apply(pipeline,
                              geometry::exterior_ring(in),
                              geometry::exterior_ring(out),
                              grids1, grids2);
         bool r2 = transform_multi
                     <
                         transform_range<CT>
-                     >::apply(proj1, par1, proj2, par2,
+                     >::apply(pipeline,
                               geometry::interior_rings(in),
                               geometry::interior_rings(out),
                               grids1, grids2);
@@ -550,6 +549,250 @@ struct transform<MultiPolygon, CT, multi_polygon_tag>
         >
 {};
 
+// Ranges with fewer points are transformed by one thread
+static const std::size_t parallel_transform_min_points = 1024;
+
+// The grids are loaded lazily while points are transformed, so they can
+// be used by several threads only if they are locked by the storage, or
+// if they are mapped and decoded without modifying the grids
+template <typename GridsStorage>
+struct is_parallel_grids_storage
+    : std::integral_constant
+        <
+            bool,
+            std::is_same
+                <
+                    typename GridsStorage::grids_type::tag,
+                    shared_grids_tag
+                >::value
+         || std::is_same
+                <
+                    typename GridsStorage::grids_type::tag,
+                    mapped_grids_tag
+                >::value
+        >
+{};
+
+template <>
+struct is_parallel_grids_storage<srs::detail::empty_grids_storage>
+    : std::true_type
+{};
+
+inline bool all_of_results(std::vector<char> const& results)
+{
+    return std::find(results.begin(), results.end(), char(0)) == results.end();
+}
+
+// Splits the range into contiguous parts of at least
+// parallel_transform_min_points points, one for each thread. pj_transform()
+// handles the points independently, so the result is the same as for the
+// whole range.
+template <typename CT>
+struct parallel_transform_range
+{
+    template
+    <
+        typename Pipeline,
+        typename RangeIn, typename RangeOut,
+        typename Grids
+    >
+    static inline bool apply(Pipeline const& pipeline,
+                             RangeIn const& in, RangeOut & out,
+                             Grids const& grids1, Grids const& grids2,
+                             std::size_t thread_count)
+    {
+        // NOTE: this has to be consistent with pj_transform()
+        bool const input_angles = !pipeline.src_params().is_geocent
+                                && pipeline.src_params().is_latlong;
+
+        typedef transform_geometry_wrapper<RangeOut, CT> wrapper_type;
+        typedef typename boost::range_iterator
+            <
+                typename wrapper_type::type
+            >::type iterator_type;
+
+        wrapper_type wrapper(in, out, input_angles);
+
+        std::size_t const count = boost::size(wrapper.get());
+        std::size_t const part_count = (std::min)(thread_count,
+                                                  count / parallel_transform_min_points);
+
+        bool res = true;
+        if (part_count <= 1)
+        {
+            res = transform_points(pipeline,
+                                   wrapper.get(), grids1, grids2);
+        }
+        else
+        {
+            iterator_type const first = boost::begin(wrapper.get());
+            std::vector<char> results(part_count, 1);
+            geometry::detail::parallel_for(part_count, part_count,
+                [&](std::size_t i)
+                {
+                    std::pair<iterator_type, iterator_type> part(
+                        first + i * count / part_count,
+                        first + (i + 1) * count / part_count);
+                    results[i] = transform_points(pipeline,
+                                                  part, grids1, grids2);
+                });
+            res = all_of_results(results);
+        }
+
+        wrapper.finish();
+
+        return res;
+    }
+};
+
+// Distributes the elements over the threads if there are enough of them,
+// otherwise transforms the elements one by one, each using all threads
+template <typename Policy, typename ParallelPolicy>
+struct parallel_transform_multi
+{
+    template
+    <
+        typename Pipeline,
+        typename MultiIn, typename MultiOut,
+        typename Grids
+    >
+    static inline bool apply(Pipeline const& pipeline,
+                             MultiIn const& in, MultiOut & out,
+                             Grids const& grids1, Grids const& grids2,
+                             std::size_t thread_count)
+    {
+        if (! same_object(in, out))
+            range::resize(out, boost::size(in));
+
+        std::size_t const count = boost::size(in);
+
+        if (count >= thread_count)
+        {
+            std::vector<char> results(count, 1);
+            geometry::detail::parallel_for(count, thread_count,
+                [&](std::size_t i)
+                {
+                    results[i] = Policy::apply(pipeline,
+                                               range::at(in, i), range::at(out, i),
+                                               grids1, grids2);
+                });
+            return all_of_results(results);
+        }
+
+        bool res = true;
+        for (std::size_t i = 0 ; i < count ; ++i)
+        {
+            if ( ! ParallelPolicy::apply(pipeline,
+                                         range::at(in, i), range::at(out, i),
+                                         grids1, grids2, thread_count) )
+            {
+                res = false;
+            }
+        }
+        return res;
+    }
+};
+
+template
+<
+    typename Geometry,
+    typename CT,
+    typename Tag = typename geometry::tag<Geometry>::type
+>
+struct parallel_transform
+{
+    template
+    <
+        typename Pipeline,
+        typename GeometryIn, typename GeometryOut,
+        typename Grids
+    >
+    static inline bool apply(Pipeline const& pipeline,
+                             GeometryIn const& in, GeometryOut & out,
+                             Grids const& grids1, Grids const& grids2,
+                             std::size_t /*thread_count*/)
+    {
+        return transform<Geometry, CT, Tag>::apply(pipeline,
+                                                   in, out, grids1, grids2);
+    }
+};
+
+template <typename MultiPoint, typename CT>
+struct parallel_transform<MultiPoint, CT, multi_point_tag>
+    : parallel_transform_range<CT>
+{};
+
+template <typename Linestring, typename CT>
+struct parallel_transform<Linestring, CT, linestring_tag>
+    : parallel_transform_range<CT>
+{};
+
+template <typename MultiLinestring, typename CT>
+struct parallel_transform<MultiLinestring, CT, multi_linestring_tag>
+    : parallel_transform_multi
+        <
+            transform_range<CT>,
+            parallel_transform_range<CT>
+        >
+{};
+
+template <typename Ring, typename CT>
+struct parallel_transform<Ring, CT, ring_tag>
+    : parallel_transform_range<CT>
+{};
+
+template <typename Polygon, typename CT>
+struct parallel_transform<Polygon, CT, polygon_tag>
+{
+    template
+    <
+        typename Pipeline,
+        typename PolygonIn, typename PolygonOut,
+        typename Grids
+    >
+    static inline bool apply(Pipeline const& pipeline,
+                             PolygonIn const& in, PolygonOut & out,
+                             Grids const& grids1, Grids const& grids2,
+                             std::size_t thread_count)
+    {
+        bool r1 = parallel_transform_range
+                    <
+                        CT
+                    >::apply(pipeline,
+                             geometry::exterior_ring(in),
+                             geometry::exterior_ring(out),
+                             grids1, grids2, thread_count);
+        bool r2 = parallel_transform_multi
+                    <
+                        transform_range<CT>,
+                        parallel_transform_range<CT>
+                    >::apply(pipeline,
+                             geometry::interior_rings(in),
+                             geometry::interior_rings(out),
+                             grids1, grids2, thread_count);
+        return r1 && r2;
+    }
+};
+
+template <typename MultiPolygon, typename CT>
+struct parallel_transform<MultiPolygon, CT, multi_polygon_tag>
+    : parallel_transform_multi
+        <
+            transform
+                <
+                    typename boost::range_value<MultiPolygon>::type,
+                    CT,
+                    polygon_tag
+                >,
+            parallel_transform
+                <
+                    typename boost::range_value<MultiPolygon>::type,
+                    CT,
+                    polygon_tag
+                >
+        >
+{};
+
 
 }} // namespace projections::detail
     
@@ -578,6 +821,7 @@ class transformation
 public:
     // Both static and default constructed
     transformation()
+        : m_steps(m_proj1.proj().params(), m_proj2.proj().params())
     {}
 
     // First dynamic, second static and default constructed
@@ -593,11 +837,13 @@ public:
     >
     explicit transformation(Parameters1 const& parameters1)
         : m_proj1(parameters1)
+        , m_steps(m_proj1.proj().params(), m_proj2.proj().params())
     {}
 
     // First static, second static and default constructed
     explicit transformation(Proj1 const& parameters1)
         : m_proj1(parameters1)
+        , m_steps(m_proj1.proj().params(), m_proj2.proj().params())
     {}
 
     // Both dynamic
@@ -617,6 +863,7 @@ public:
                    Parameters2 const& parameters2)
         : m_proj1(parameters1)
         , m_proj2(parameters2)
+        , m_steps(m_proj1.proj().params(), m_proj2.proj().params())
     {}
 
     // First dynamic, second static
@@ -634,6 +881,7 @@ public:
                    Proj2 const& parameters2)
         : m_proj1(parameters1)
         , m_proj2(parameters2)
+        , m_steps(m_proj1.proj().params(), m_proj2.proj().params())
     {}
 
     // First static, second dynamic
@@ -651,6 +899,7 @@ public:
                    Parameters2 const& parameters2)
         : m_proj1(parameters1)
         , m_proj2(parameters2)
+        , m_steps(m_proj1.proj().params(), m_proj2.proj().params())
     {}
 
     // Both static
@@ -658,6 +907,7 @@ public:
                    Proj2 const& parameters2)
         : m_proj1(parameters1)
         , m_proj2(parameters2)
+        , m_steps(m_proj1.proj().params(), m_proj2.proj().params())
     {}
 
     template <typename GeometryIn, typename GeometryOut>
@@ -685,8 +935,7 @@ public:
                 <
                     GeometryOut,
                     calc_t
-                >::apply(m_proj1.proj(), m_proj1.proj().params(),
-                         m_proj2.proj(), m_proj2.proj().params(),
+                >::apply(forward_pipeline(),
                          in, out,
                          grids.src_grids,
                          grids.dst_grids);
@@ -705,13 +954,103 @@ public:
                 <
                     GeometryOut,
                     calc_t
-                >::apply(m_proj2.proj(), m_proj2.proj().params(),
-                         m_proj1.proj(), m_proj1.proj().params(),
+                >::apply(inverse_pipeline(),
                          in, out,
                          grids.dst_grids,
                          grids.src_grids);
     }
 
+    /*!
+    \brief Transforms the geometry using up to thread_count threads
+    \details Large ranges are split into contiguous parts and the elements of
+        multi-geometries are distributed over the threads. Each point is
+        transformed as by the serial forward(), so the output does not depend
+        on the number of threads. Small geometries are transformed by the
+        calling thread.
+    */
+    template <typename GeometryIn, typename GeometryOut>
+    bool forward(GeometryIn const& in, GeometryOut & out,
+                 std::size_t thread_count) const
+    {
+        return forward(in, out, transformation_grids<detail::empty_grids_storage>(),
+                       thread_count);
+    }
+
+    /*!
+    \brief Inverse transforms the geometry using up to thread_count threads
+    \details See forward()
+    */
+    template <typename GeometryIn, typename GeometryOut>
+    bool inverse(GeometryIn const& in, GeometryOut & out,
+                 std::size_t thread_count) const
+    {
+        return inverse(in, out, transformation_grids<detail::empty_grids_storage>(),
+                       thread_count);
+    }
+
+    /*!
+    \brief Transforms the geometry using up to thread_count threads
+    \details The grids are shared by the threads if they are stored in
+        shared_grids_std, shared_grids_boost or mapped_grids. Other grids
+        are loaded lazily without locking, so the geometry is then
+        transformed serially.
+    */
+    template <typename GeometryIn, typename GeometryOut, typename GridsStorage>
+    bool forward(GeometryIn const& in, GeometryOut & out,
+                 transformation_grids<GridsStorage> const& grids,
+                 std::size_t thread_count) const
+    {
+        BOOST_GEOMETRY_STATIC_ASSERT(
+            (projections::detail::same_tags<GeometryIn, GeometryOut>::value),
+            "Not supported combination of Geometries.",
+            GeometryIn, GeometryOut);
+
+        if (! use_threads<GridsStorage>(in, thread_count))
+        {
+            return forward(in, out, grids);
+        }
+
+        return projections::detail::parallel_transform
+                <
+                    GeometryOut,
+                    calc_t
+                >::apply(forward_pipeline(),
+                         in, out,
+                         grids.src_grids,
+                         grids.dst_grids,
+                         thread_count);
+    }
+
+    /*!
+    \brief Inverse transforms the geometry using up to thread_count threads
+    \details See forward()
+    */
+    template <typename GeometryIn, typename GeometryOut, typename GridsStorage>
+    bool inverse(GeometryIn const& in, GeometryOut & out,
+                 transformation_grids<GridsStorage> const& grids,
+                 std::size_t thread_count) const
+    {
+        BOOST_GEOMETRY_STATIC_ASSERT(
+            (projections::detail::same_tags<GeometryIn, GeometryOut>::value),
+            "Not supported combination of Geometries.",
+            GeometryIn, GeometryOut);
+
+        if (! use_threads<GridsStorage>(in, thread_count))
+        {
+            return inverse(in, out, grids);
+        }
+
+        return projections::detail::parallel_transform
+                <
+                    GeometryOut,
+                    calc_t
+                >::apply(inverse_pipeline(),
+                         in, out,
+                         grids.dst_grids,
+                         grids.src_grids,
+                         thread_count);
+    }
+
     template <typename GridsStorage>
     inline transformation_grids<GridsStorage> initialize_grids(GridsStorage & grids_storage) const
     {
@@ -727,8 +1066,34 @@ public:
     }
 
 private:
+    auto forward_pipeline() const
+    {
+        return projections::detail::make_pj_transform_pipeline(
+                    m_proj1.proj(), m_proj1.proj().params(),
+                    m_proj2.proj(), m_proj2.proj().params(),
+                    m_steps.forward);
+    }
+
+    auto inverse_pipeline() const
+    {
+        return projections::detail::make_pj_transform_pipeline(
+                    m_proj2.proj(), m_proj2.proj().params(),
+                    m_proj1.proj(), m_proj1.proj().params(),
+                    m_steps.inverse);
+    }
+
+    template <typename GridsStorage, typename Geometry>
+    static inline bool use_threads(Geometry const& geometry, std::size_t thread_count)
+    {
+        return thread_count > 1
+            && projections::detail::is_parallel_grids_storage<GridsStorage>::value
+            && geometry::num_points(geometry)
+                >= projections::detail::parallel_transform_min_points;
+    }
+
     projections::proj_wrapper<Proj1, CT> m_proj1;
     projections::proj_wrapper<Proj2, CT> m_proj2;
+    projections::detail::transformation_steps<calc_t> m_steps;
 };
 
 
@@ -18,6 +18,7 @@
 
 #include <algorithm>
 
+#include <boost/geometry/core/coordinate_promotion.hpp>
 #include <boost/geometry/core/exception.hpp>
 
 #include <boost/geometry/geometries/concepts/point_concept.hpp>
@@ -31,7 +32,6 @@
 #include <boost/geometry/algorithms/detail/recalculate.hpp>
 
 #include <boost/geometry/util/math.hpp>
-#include <boost/geometry/util/promote_integral.hpp>
 #include <boost/geometry/util/select_calculation_type.hpp>
 
 #include <boost/geometry/strategy/cartesian/area.hpp>
@@ -172,9 +172,15 @@ struct cartesian_segments
             // Calculate the intersection point based on segment_ratio
             // The division, postponed until here, is done now. In case of integer this
             // results in an integer which rounds to the nearest integer.
+            // For integers, the multiplication is done in a type having twice
+            // the number of bits of the ratio, because the numerator is
+            // a product itself.
             BOOST_GEOMETRY_ASSERT(ratio.denominator() != typename SegmentRatio::int_type(0));
 
-            typedef typename promote_integral<CoordinateType>::type calc_type;
+            typedef typename geometry::detail::promoted_to_exact_integral
+                <
+                    typename SegmentRatio::int_type
+                >::type calc_type;
 
             calc_type const numerator
                 = boost::numeric_cast<calc_type>(ratio.numerator());
@@ -344,7 +350,15 @@ struct cartesian_segments
                 typename geometry::coordinate_type<typename ModelledUniqueSubRange1::point_type>::type
             >::type modelled_coordinate_type;
 
-        typedef segment_ratio<modelled_coordinate_type> ratio_type;
+        // For signed integral coordinates the ratio is kept in a type having
+        // twice the number of bits, such that it is exact
+        typedef segment_ratio
+            <
+                typename geometry::detail::promoted_to_exact_integral
+                    <
+                        modelled_coordinate_type
+                    >::type
+            > ratio_type;
         segment_intersection_info
             <
                 typename select_calculation_type<point1_type, point2_type, CalculationType>::type,
@@ -472,8 +486,11 @@ struct cartesian_segments
         // (only calculated for non-collinear segments)
         if (! collinear)
         {
-            coordinate_type denominator_a, nominator_a;
-            coordinate_type denominator_b, nominator_b;
+            // For integral coordinates, the ratio type is promoted
+            typedef typename RatioType::int_type ratio_int_type;
+
+            ratio_int_type denominator_a, nominator_a;
+            ratio_int_type denominator_b, nominator_b;
 
             cramers_rule(dx_p, dy_p, dx_q, dy_q,
                 get<0>(p1) - get<0>(q1),
@@ -485,10 +502,10 @@ struct cartesian_segments
                 get<1>(q1) - get<1>(p1),
                 nominator_b, denominator_b);
 
-            math::detail::equals_factor_policy<coordinate_type>
+            math::detail::equals_factor_policy<ratio_int_type>
                 policy(dx_p, dy_p, dx_q, dy_q);
 
-            coordinate_type const zero = 0;
+            ratio_int_type const zero = 0;
             if (math::detail::equals_by_policy(denominator_a, zero, policy)
              || math::detail::equals_by_policy(denominator_b, zero, policy))
             {
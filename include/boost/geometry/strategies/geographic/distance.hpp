@@ -17,6 +17,8 @@
 #define BOOST_GEOMETRY_STRATEGIES_GEOGRAPHIC_DISTANCE_HPP
 
 
+#include <type_traits>
+
 #include <boost/geometry/core/coordinate_promotion.hpp>
 #include <boost/geometry/core/coordinate_type.hpp>
 #include <boost/geometry/core/radian_access.hpp>
@@ -64,6 +66,22 @@ template
 >
 class geographic
 {
+    // The terms of the formula depending only on the spheroid are calculated
+    // once, in the calculation type or in the type of the radius
+    typedef strategy_detail::formula_model
+        <
+            FormulaPolicy,
+            std::conditional_t
+                <
+                    std::is_void<CalculationType>::value,
+                    typename promote_floating_point
+                        <
+                            typename geometry::radius_type<Spheroid>::type
+                        >::type,
+                    CalculationType
+                >
+        > formula_model_type;
+
 public :
     template <typename Point1, typename Point2>
     struct calculation_type
@@ -82,33 +100,19 @@ public :
 
     inline geographic()
         : m_spheroid()
+        , m_formula_model(m_spheroid)
     {}
 
     explicit inline geographic(Spheroid const& spheroid)
         : m_spheroid(spheroid)
+        , m_formula_model(m_spheroid)
     {}
 
     template <typename CT>
     static inline CT apply(CT lon1, CT lat1, CT lon2, CT lat2,
                            Spheroid const& spheroid)
     {
-        typedef typename formula::meridian_inverse
-                <
-                CT, strategy::default_order<FormulaPolicy>::value
-                > meridian_inverse;
-
-        typename meridian_inverse::result res =
-                 meridian_inverse::apply(lon1, lat1, lon2, lat2, spheroid);
-
-        if (res.meridian)
-        {
-            return res.distance;
-        }
-
-        return FormulaPolicy::template inverse
-                <
-                    CT, true, false, false, false, false
-                >::apply(lon1, lat1, lon2, lat2, spheroid).distance;
+        return apply(lon1, lat1, lon2, lat2, spheroid, spheroid);
     }
 
     template <typename Point1, typename Point2>
@@ -122,7 +126,8 @@ public :
         CT lon2 = get_as_radian<0>(point2);
         CT lat2 = get_as_radian<1>(point2);
 
-        return apply(lon1, lat1, lon2, lat2, m_spheroid);
+        return apply(lon1, lat1, lon2, lat2, m_spheroid,
+                     m_formula_model.get(m_spheroid));
     }
 
     inline Spheroid const& model() const
@@ -131,7 +136,32 @@ public :
     }
 
 private :
+    template <typename CT, typename FormulaModel>
+    static inline CT apply(CT lon1, CT lat1, CT lon2, CT lat2,
+                           Spheroid const& spheroid,
+                           FormulaModel const& formula_model)
+    {
+        typedef typename formula::meridian_inverse
+                <
+                CT, strategy::default_order<FormulaPolicy>::value
+                > meridian_inverse;
+
+        typename meridian_inverse::result res =
+                 meridian_inverse::apply(lon1, lat1, lon2, lat2, spheroid);
+
+        if (res.meridian)
+        {
+            return res.distance;
+        }
+
+        return FormulaPolicy::template inverse
+                <
+                    CT, true, false, false, false, false
+                >::apply(lon1, lat1, lon2, lat2, formula_model).distance;
+    }
+
     Spheroid m_spheroid;
+    formula_model_type m_formula_model;
 };
 
 
@@ -18,6 +18,7 @@
 #include <boost/geometry/formulas/thomas_inverse.hpp>
 #include <boost/geometry/formulas/vincenty_direct.hpp>
 #include <boost/geometry/formulas/vincenty_inverse.hpp>
+#include <boost/geometry/formulas/karney_constants.hpp>
 #include <boost/geometry/formulas/karney_direct.hpp>
 #include <boost/geometry/formulas/karney_inverse.hpp>
 
@@ -207,4 +208,53 @@ struct default_order<karney>
 }}} // namespace boost::geometry::strategy
 
 
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace strategy_detail
+{
+
+// The model passed to the formulas of FormulaPolicy in place of the spheroid,
+// constructed once by the geographic strategies. By default it's the spheroid
+// itself. The formulas of karney take the coefficients of the series
+// expansions depending only on the spheroid, calculated in CT.
+template <typename FormulaPolicy, typename CT>
+struct formula_model
+{
+    template <typename Spheroid>
+    explicit inline formula_model(Spheroid const& )
+    {}
+
+    template <typename Spheroid>
+    static inline Spheroid const& get(Spheroid const& spheroid)
+    {
+        return spheroid;
+    }
+};
+
+template <typename CT>
+struct formula_model<strategy::karney, CT>
+{
+    template <typename Spheroid>
+    explicit inline formula_model(Spheroid const& spheroid)
+        : m_constants(spheroid)
+    {}
+
+    template <typename Spheroid>
+    inline formula::karney_constants<CT> const& get(Spheroid const& ) const
+    {
+        return m_constants;
+    }
+
+private:
+    formula::karney_constants<CT> m_constants;
+};
+
+} // namespace strategy_detail
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+
 #endif // BOOST_GEOMETRY_STRATEGIES_GEOGRAPHIC_PARAMETERS_HPP
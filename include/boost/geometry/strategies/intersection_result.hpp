@@ -57,7 +57,13 @@ struct fraction_type
 template
 <
     typename Point,
-    typename SegmentRatio = segment_ratio<typename coordinate_type<Point>::type>
+    typename SegmentRatio = segment_ratio
+        <
+            typename detail::promoted_to_exact_integral
+                <
+                    typename coordinate_type<Point>::type
+                >::type
+        >
 >
 struct segment_intersection_points
 {
@@ -0,0 +1,54 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_STRATEGIES_SIMPLIFY_VISVALINGAM_WHYATT_HPP
+#define BOOST_GEOMETRY_STRATEGIES_SIMPLIFY_VISVALINGAM_WHYATT_HPP
+
+
+#include <type_traits>
+
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/static_assert.hpp>
+
+#include <boost/geometry/strategies/simplify/cartesian.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+namespace strategies { namespace simplify
+{
+
+/*!
+\brief Umbrella strategy selecting the Visvalingam-Whyatt algorithm
+\ingroup strategies
+\details Passed to simplify, points are removed in order of their
+    effective area (the area of the triangle with their neighbours), as long
+    as that area is not larger than the square of the specified distance.
+    All other strategies are taken from the wrapped umbrella strategy.
+\tparam Strategies the cartesian umbrella strategy to be wrapped
+*/
+template <typename Strategies = strategies::simplify::cartesian<> >
+struct visvalingam_whyatt
+    : public Strategies
+{
+    BOOST_GEOMETRY_STATIC_ASSERT(
+        (std::is_same<typename Strategies::cs_tag, cartesian_tag>::value),
+        "Visvalingam-Whyatt is only implemented for cartesian coordinate systems.",
+        Strategies);
+
+    visvalingam_whyatt() = default;
+
+    explicit visvalingam_whyatt(Strategies const& strategies)
+        : Strategies(strategies)
+    {}
+};
+
+}} // namespace strategies::simplify
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_STRATEGIES_SIMPLIFY_VISVALINGAM_WHYATT_HPP
@@ -10,10 +10,16 @@
 #ifndef BOOST_GEOMETRY_STRATEGY_CARTESIAN_ENVELOPE_RANGE_HPP
 #define BOOST_GEOMETRY_STRATEGY_CARTESIAN_ENVELOPE_RANGE_HPP
 
+#include <type_traits>
+
 #include <boost/range/begin.hpp>
 #include <boost/range/end.hpp>
+#include <boost/range/size.hpp>
 
 #include <boost/geometry/algorithms/detail/envelope/initialize.hpp>
+#include <boost/geometry/algorithms/detail/range_kernels.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
 #include <boost/geometry/strategy/cartesian/envelope_point.hpp>
 #include <boost/geometry/strategy/cartesian/expand_point.hpp>
 
@@ -28,6 +34,41 @@ class cartesian_range
 public:
     template <typename Range, typename Box>
     static inline void apply(Range const& range, Box& mbr)
+    {
+        // Coordinates stored as x, y, x, y, ... are handled by a
+        // vectorized kernel
+        typedef std::integral_constant
+            <
+                bool,
+                geometry::detail::range_kernels::is_contiguous_xy<Range>::value
+                && dimension<Box>::value == 2
+            > use_range_kernel;
+
+        apply(range, mbr, use_range_kernel());
+    }
+
+private:
+    template <typename Range, typename Box>
+    static inline void apply(Range const& range, Box& mbr, std::true_type)
+    {
+        std::size_t const count = boost::size(range);
+        if (count == 0)
+        {
+            geometry::detail::envelope::initialize<Box>::apply(mbr);
+            return;
+        }
+
+        double result[4];
+        geometry::detail::range_kernels::minmax(
+            geometry::detail::range_kernels::coordinates(range), count, result);
+        set<min_corner, 0>(mbr, result[0]);
+        set<min_corner, 1>(mbr, result[1]);
+        set<max_corner, 0>(mbr, result[2]);
+        set<max_corner, 1>(mbr, result[3]);
+    }
+
+    template <typename Range, typename Box>
+    static inline void apply(Range const& range, Box& mbr, std::false_type)
     {
         auto it = boost::begin(range);
         auto const end = boost::end(range);
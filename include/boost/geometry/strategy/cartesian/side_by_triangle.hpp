@@ -22,9 +22,11 @@
 #define BOOST_GEOMETRY_STRATEGY_CARTESIAN_SIDE_BY_TRIANGLE_HPP
 
 
+#include <limits>
 #include <type_traits>
 
 #include <boost/geometry/core/config.hpp>
+#include <boost/geometry/core/coordinate_promotion.hpp>
 #include <boost/geometry/arithmetic/determinant.hpp>
 
 #include <boost/geometry/core/access.hpp>
@@ -33,6 +35,7 @@
 #include <boost/geometry/strategies/compare.hpp>
 #include <boost/geometry/strategies/side.hpp>
 
+#include <boost/geometry/util/precise_math.hpp>
 #include <boost/geometry/util/select_calculation_type.hpp>
 #include <boost/geometry/util/select_most_precise.hpp>
 
@@ -80,6 +83,10 @@ public :
     // Types can be all three different. Therefore it is
     // not implemented (anymore) as "segment"
 
+    // Version for floating point types. The determinant is evaluated
+    // adaptively: first in plain floating point, and only if its sign cannot
+    // be guaranteed by the error bound, more precisely with the expansions
+    // of precise_math (see side_robust)
     template
     <
         typename CoordinateType,
@@ -87,7 +94,38 @@ public :
         typename P1,
         typename P2,
         typename P,
-        typename EpsPolicy
+        typename EpsPolicy,
+        std::enable_if_t<std::is_floating_point<PromotedType>::value, int> = 0
+    >
+    static inline
+    PromotedType side_value(P1 const& p1, P2 const& p2, P const& p, EpsPolicy & eps_policy)
+    {
+        PromotedType const x = CoordinateType(get<0>(p));
+        PromotedType const y = CoordinateType(get<1>(p));
+
+        PromotedType const sx1 = CoordinateType(get<0>(p1));
+        PromotedType const sy1 = CoordinateType(get<1>(p1));
+        PromotedType const sx2 = CoordinateType(get<0>(p2));
+        PromotedType const sy2 = CoordinateType(get<1>(p2));
+
+        // Arranged such that the determinant is (p2 - p1) x (p - p1).
+        // The first stage of orient2d is the plain evaluation.
+        using vec2d = geometry::detail::precise_math::vec2d<PromotedType>;
+        return geometry::detail::precise_math::orient2d
+            <
+                PromotedType, 3
+            >(vec2d{sx2, sy2}, vec2d{x, y}, vec2d{sx1, sy1}, eps_policy);
+    }
+
+    template
+    <
+        typename CoordinateType,
+        typename PromotedType,
+        typename P1,
+        typename P2,
+        typename P,
+        typename EpsPolicy,
+        std::enable_if_t<! std::is_floating_point<PromotedType>::value, int> = 0
     >
     static inline
     PromotedType side_value(P1 const& p1, P2 const& p2, P const& p, EpsPolicy & eps_policy)
@@ -202,11 +240,88 @@ public :
     };
 
 
+    // Calculates the sign of the determinant exactly, in ExactType,
+    // without any epsilon. The differences are taken in ExactType too.
+    template <typename ExactType, typename P1, typename P2, typename P>
+    static inline int exact_side(P1 const& p1, P2 const& p2, P const& p)
+    {
+        ExactType const dx = ExactType(get<0>(p2)) - ExactType(get<0>(p1));
+        ExactType const dy = ExactType(get<1>(p2)) - ExactType(get<1>(p1));
+        ExactType const dpx = ExactType(get<0>(p)) - ExactType(get<0>(p1));
+        ExactType const dpy = ExactType(get<1>(p)) - ExactType(get<1>(p1));
+
+        ExactType const s = geometry::detail::determinant<ExactType>(dx, dy, dpx, dpy);
+
+        ExactType const zero = ExactType(0);
+        return s > zero ? 1 : s < zero ? -1 : 0;
+    }
+
+    // Version for signed integral coordinates. There is no floating point
+    // involved: if all coordinates are smaller than 2^(n/2-1) (for example
+    // 2^30 for int64) the determinant fits in the coordinate type itself.
+    // Otherwise it is calculated in an integral type having twice the
+    // number of bits (which is exact for coordinates smaller than 2^(n-2)).
+    template <typename CoordinateType, typename P1, typename P2, typename P>
+    static inline int apply_integral(P1 const& p1, P2 const& p2, P const& p)
+    {
+        static CoordinateType const limit = CoordinateType(1)
+            << (std::numeric_limits<CoordinateType>::digits / 2 - 1);
+
+        auto const is_small = [](CoordinateType const& c)
+        {
+            return c > -limit && c < limit;
+        };
+
+        if (is_small(get<0>(p1)) && is_small(get<1>(p1))
+            && is_small(get<0>(p2)) && is_small(get<1>(p2))
+            && is_small(get<0>(p)) && is_small(get<1>(p)))
+        {
+            return exact_side<CoordinateType>(p1, p2, p);
+        }
+
+        return exact_side
+            <
+                typename geometry::detail::promoted_to_exact_integral
+                    <
+                        CoordinateType
+                    >::type
+            >(p1, p2, p);
+    }
+
     template <typename P1, typename P2, typename P>
     static inline int apply(P1 const& p1, P2 const& p2, P const& p)
     {
         using coor_t = typename select_calculation_type_alt<CalculationType, P1, P2, P>::type;
 
+        bool const are_all_integral_coordinates =
+            std::is_integral<typename coordinate_type<P1>::type>::value
+            && std::is_integral<typename coordinate_type<P2>::type>::value
+            && std::is_integral<typename coordinate_type<P>::type>::value;
+
+        return apply<coor_t>(p1, p2, p,
+            std::integral_constant
+                <
+                    bool,
+                    are_all_integral_coordinates
+                    && std::is_integral<coor_t>::value
+                    && std::is_signed<coor_t>::value
+                >());
+    }
+
+private:
+    template <typename CoordinateType, typename P1, typename P2, typename P>
+    static inline int apply(P1 const& p1, P2 const& p2, P const& p,
+                            std::true_type /*exact*/)
+    {
+        return apply_integral<CoordinateType>(p1, p2, p);
+    }
+
+    template <typename CoordinateType, typename P1, typename P2, typename P>
+    static inline int apply(P1 const& p1, P2 const& p2, P const& p,
+                            std::false_type /*exact*/)
+    {
+        using coor_t = CoordinateType;
+
         // Promote float->double, small int->int
         using promoted_t = typename select_most_precise<coor_t, double>::type;
 
@@ -227,7 +342,6 @@ public :
             : -1;
     }
 
-private:
     template <typename P1, typename P2>
     static inline bool equals_point_point(P1 const& p1, P2 const& p2)
     {
@@ -32,6 +32,44 @@ namespace boost { namespace geometry
 namespace strategy { namespace area
 {
 
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+// Gives the algorithms calculating the terms of many segments at once, e.g.
+// bulk_area(), the constants of a geographic strategy and the area of a ring
+// from the sums of the terms of its segments, as the strategy calculates them
+struct geographic_access
+{
+    template <typename Strategy, typename CT>
+    struct area_formulas
+    {
+        typedef geometry::formula::area_formulas
+            <
+                CT, Strategy::SeriesOrderNorm, Strategy::ExpandEpsN
+            > type;
+    };
+
+    template <typename Strategy>
+    static inline auto const& constants(Strategy const& strategy)
+    {
+        return strategy.m_spheroid_constants;
+    }
+
+    template <typename Strategy, typename T>
+    static inline T ring_area(Strategy const& strategy,
+                              T const& excess_sum, T const& correction_sum,
+                              std::size_t crosses_prime_meridian)
+    {
+        return Strategy::area(excess_sum, correction_sum,
+                              crosses_prime_meridian,
+                              strategy.m_spheroid_constants);
+    }
+};
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
 /*!
 \brief Geographic area calculation
 \ingroup strategies
@@ -97,6 +135,8 @@ protected :
         calc_t const m_c2;  // squared authalic radius
         calc_t const m_f;   // the flattening
         calc_t m_coeffs_var[((SeriesOrderNorm+2)*(SeriesOrderNorm+1))/2];
+        // passed to the inverse formula in place of the spheroid
+        strategy_detail::formula_model<FormulaPolicy, calc_t> const m_formula_model;
 
         inline spheroid_constants(Spheroid const& spheroid)
             : m_spheroid(spheroid)
@@ -109,6 +149,7 @@ protected :
                         calc_t, Spheroid, srs_spheroid_tag
                     >::apply(m_a2, m_e2))
             , m_f(formula::flattening<calc_t>(spheroid))
+            , m_formula_model(spheroid)
         {
             typedef geometry::formula::area_formulas
                 <
@@ -123,6 +164,53 @@ protected :
         }
     };
 
+private :
+    friend struct detail::geographic_access;
+
+    // The area of a ring given the sums of the terms of its segments and the
+    // number of its segments crossing the prime meridian
+    template <typename T>
+    static inline T area(T const& excess_sum, T const& correction_sum,
+                         std::size_t crosses_prime_meridian,
+                         spheroid_constants const& spheroid_const)
+    {
+        T result;
+
+        T const spherical_term = spheroid_const.m_c2 * excess_sum;
+        T const ellipsoidal_term = spheroid_const.m_e2
+            * spheroid_const.m_a2 * correction_sum;
+
+        // ignore ellipsoidal term if is large (probably from an azimuth
+        // inaccuracy)
+        T sum = math::abs(ellipsoidal_term/spherical_term) > 0.01
+            ? spherical_term : spherical_term + ellipsoidal_term;
+
+        // If encircles some pole
+        if (crosses_prime_meridian % 2 == 1)
+        {
+            std::size_t times_crosses_prime_meridian
+                    = 1 + (crosses_prime_meridian / 2);
+
+            result = T(2.0)
+                     * geometry::math::pi<T>()
+                     * spheroid_const.m_c2
+                     * T(times_crosses_prime_meridian)
+                     - geometry::math::abs(sum);
+
+            if (geometry::math::sign<T>(sum) == 1)
+            {
+                result = - result;
+            }
+
+        }
+        else
+        {
+            result = sum;
+        }
+
+        return result;
+    }
+
 public:
     template <typename Geometry>
     class state
@@ -141,41 +229,8 @@ public:
     private:
         inline return_type area(spheroid_constants const& spheroid_const) const
         {
-            return_type result;
-
-            return_type const spherical_term = spheroid_const.m_c2 * m_excess_sum;
-            return_type const ellipsoidal_term = spheroid_const.m_e2
-                * spheroid_const.m_a2 * m_correction_sum;
-
-            // ignore ellipsoidal term if is large (probably from an azimuth
-            // inaccuracy)
-            return_type sum = math::abs(ellipsoidal_term/spherical_term) > 0.01
-                ? spherical_term : spherical_term + ellipsoidal_term;
-
-            // If encircles some pole
-            if (m_crosses_prime_meridian % 2 == 1)
-            {
-                std::size_t times_crosses_prime_meridian
-                        = 1 + (m_crosses_prime_meridian / 2);
-
-                result = return_type(2.0)
-                         * geometry::math::pi<return_type>()
-                         * spheroid_const.m_c2
-                         * return_type(times_crosses_prime_meridian)
-                         - geometry::math::abs(sum);
-
-                if (geometry::math::sign<return_type>(sum) == 1)
-                {
-                    result = - result;
-                }
-
-            }
-            else
-            {
-                result = sum;
-            }
-
-            return result;
+            return geographic::area(m_excess_sum, m_correction_sum,
+                                    m_crosses_prime_meridian, spheroid_const);
         }
 
         return_type m_excess_sum;
@@ -525,7 +525,9 @@ struct rounding_cast<Result, Source, true, false>
     }
 };
 
-template <typename T, bool IsIntegral = std::is_integral<T>::value>
+// Integers of Boost.Multiprecision, used as promoted integral types,
+// are rounded too
+template <typename T, bool IsIntegral = std::numeric_limits<T>::is_integer>
 struct divide
 {
     static inline T apply(T const& n, T const& d)
@@ -759,7 +761,7 @@ inline T hav(T const& theta)
 \return The squared value
 */
 template <typename T>
-inline T sqr(T const& value)
+constexpr inline T sqr(T const& value)
 {
     return value * value;
 }
@@ -912,9 +914,9 @@ inline T round_angle(T const& x) {
 // TODO: adl1995 - Merge these functions with formulas/area_formulas.hpp
 // i.e. place them in one file.
 template <typename NT, typename IteratorType>
-inline NT horner_evaluate(NT const& x,
-                          IteratorType begin,
-                          IteratorType end)
+constexpr inline NT horner_evaluate(NT const& x,
+                                    IteratorType begin,
+                                    IteratorType end)
 {
     NT result(0);
     IteratorType it = end;
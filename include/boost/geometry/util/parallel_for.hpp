@@ -0,0 +1,109 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_UTIL_PARALLEL_FOR_HPP
+#define BOOST_GEOMETRY_UTIL_PARALLEL_FOR_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+// Calls function(i) for i in [0, count), distributed over thread_count
+// threads. Each thread handles a contiguous block of indices, so the
+// function should only write to data belonging to its own index.
+// With a thread_count of 0 or 1 everything is done in the calling thread.
+// The first exception thrown by any of the threads is rethrown, as is
+// the exception thrown if a thread cannot be started.
+template <typename Function>
+inline void parallel_for(std::size_t count, std::size_t thread_count,
+                         Function const& function)
+{
+    if (thread_count > count)
+    {
+        thread_count = count;
+    }
+
+    if (thread_count <= 1)
+    {
+        for (std::size_t i = 0; i < count; i++)
+        {
+            function(i);
+        }
+        return;
+    }
+
+    std::vector<std::exception_ptr> errors(thread_count);
+    std::vector<std::thread> threads;
+    threads.reserve(thread_count);
+
+    auto const join_all = [&threads]()
+    {
+        for (auto& thread : threads)
+        {
+            if (thread.joinable())
+            {
+                thread.join();
+            }
+        }
+    };
+
+    std::size_t const block_size = (count + thread_count - 1) / thread_count;
+    try
+    {
+        for (std::size_t t = 0; t < thread_count; t++)
+        {
+            threads.emplace_back([&function, &errors, t, block_size, count]()
+            {
+                std::size_t const first = t * block_size;
+                std::size_t const last = (std::min)(first + block_size, count);
+                try
+                {
+                    for (std::size_t i = first; i < last; i++)
+                    {
+                        function(i);
+                    }
+                }
+                catch (...)
+                {
+                    errors[t] = std::current_exception();
+                }
+            });
+        }
+    }
+    catch (...)
+    {
+        // A thread could not be started. The threads already running
+        // are joined before rethrowing, destructing them would terminate.
+        join_all();
+        throw;
+    }
+
+    join_all();
+
+    for (auto const& error : errors)
+    {
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_UTIL_PARALLEL_FOR_HPP
@@ -152,7 +152,7 @@ namespace boost { namespace geometry { namespace series_expansion {
      geometry/doc/other/maxima/geod.mac
     */
     template <typename Coeffs, typename CT>
-    inline void evaluate_coeffs_A3(Coeffs &c, CT const& n)
+    constexpr inline void evaluate_coeffs_A3(Coeffs &c, CT const& n)
     {
         switch (int(Coeffs::static_size))
         {
@@ -222,7 +222,7 @@ namespace boost { namespace geometry { namespace series_expansion {
      geometry/doc/other/maxima/geod.mac
     */
     template <typename Coeffs, typename CT>
-    inline void evaluate_coeffs_C1(Coeffs &c, CT const& eps)
+    constexpr inline void evaluate_coeffs_C1(Coeffs &c, CT const& eps)
     {
         CT eps2 = math::sqr(eps);
         CT d = eps;
@@ -322,7 +322,7 @@ namespace boost { namespace geometry { namespace series_expansion {
      geometry/doc/other/maxima/geod.mac
     */
     template <typename Coeffs, typename CT>
-    inline void evaluate_coeffs_C1p(Coeffs& c, CT const& eps)
+    constexpr inline void evaluate_coeffs_C1p(Coeffs& c, CT const& eps)
     {
         CT const eps2 = math::sqr(eps);
         CT d = eps;
@@ -422,7 +422,7 @@ namespace boost { namespace geometry { namespace series_expansion {
      geometry/doc/other/maxima/geod.mac
     */
     template <typename Coeffs, typename CT>
-    inline void evaluate_coeffs_C2(Coeffs& c, CT const& eps)
+    constexpr inline void evaluate_coeffs_C2(Coeffs& c, CT const& eps)
     {
         CT const eps2 = math::sqr(eps);
         CT d = eps;
@@ -522,7 +522,7 @@ namespace boost { namespace geometry { namespace series_expansion {
      geometry/doc/other/maxima/geod.mac
     */
     template <size_t SeriesOrder, typename Coeffs, typename CT>
-    inline void evaluate_coeffs_C3x(Coeffs &c, CT const& n) {
+    constexpr inline void evaluate_coeffs_C3x(Coeffs &c, CT const& n) {
         BOOST_GEOMETRY_ASSERT((Coeffs::static_size == (SeriesOrder * (SeriesOrder - 1)) / 2));
 
         CT const n2 = math::sqr(n);
@@ -640,7 +640,7 @@ namespace boost { namespace geometry { namespace series_expansion {
       Elements coeffs1[1] through coeffs1[SeriesOrder - 1] are set.
     */
     template <typename Coeffs1, typename Coeffs2, typename CT>
-    inline void evaluate_coeffs_C3(Coeffs1 &coeffs1, Coeffs2 &coeffs2, CT const& eps)
+    constexpr inline void evaluate_coeffs_C3(Coeffs1 &coeffs1, Coeffs2 const& coeffs2, CT const& eps)
     {
         CT mult = 1;
         size_t offset = 0;
@@ -692,61 +692,110 @@ namespace boost { namespace geometry { namespace series_expansion {
         return 2 * sinx * cosx * k0;
     }
 
+    /*
+     The array of the coefficients. Unlike boost::array it can be filled in
+     constant expressions, so the coefficients depending only on the
+     spheroid can be calculated at compile time.
+    */
+    template <typename CT, size_t Size>
+    struct coeffs_array
+    {
+        static const size_t static_size = Size;
+
+        typedef CT value_type;
+        typedef CT const* const_iterator;
+
+        constexpr coeffs_array()
+            : m_values()
+        {}
+
+        constexpr CT& operator[](size_t i)
+        {
+            return m_values[i];
+        }
+
+        constexpr CT const& operator[](size_t i) const
+        {
+            return m_values[i];
+        }
+
+        constexpr const_iterator begin() const
+        {
+            return m_values;
+        }
+
+        constexpr const_iterator end() const
+        {
+            return m_values + Size;
+        }
+
+    private:
+        CT m_values[Size > 0 ? Size : 1];
+    };
+
     /*
      The coefficient containers for the series expansions.
      These structs allow the caller to only know the series order.
     */
     template <size_t SeriesOrder, typename CT>
-    struct coeffs_C1 : boost::array<CT, SeriesOrder + 1>
+    struct coeffs_C1 : coeffs_array<CT, SeriesOrder + 1>
     {
-        coeffs_C1(CT const& epsilon)
+        constexpr coeffs_C1(CT const& epsilon)
         {
             evaluate_coeffs_C1(*this, epsilon);
         }
     };
 
     template <size_t SeriesOrder, typename CT>
-    struct coeffs_C1p : boost::array<CT, SeriesOrder + 1>
+    struct coeffs_C1p : coeffs_array<CT, SeriesOrder + 1>
     {
-        coeffs_C1p(CT const& epsilon)
+        constexpr coeffs_C1p(CT const& epsilon)
         {
             evaluate_coeffs_C1p(*this, epsilon);
         }
     };
 
     template <size_t SeriesOrder, typename CT>
-    struct coeffs_C2 : boost::array<CT, SeriesOrder + 1>
+    struct coeffs_C2 : coeffs_array<CT, SeriesOrder + 1>
     {
-        coeffs_C2(CT const& epsilon)
+        constexpr coeffs_C2(CT const& epsilon)
         {
             evaluate_coeffs_C2(*this, epsilon);
         }
     };
 
     template <size_t SeriesOrder, typename CT>
-    struct coeffs_C3x : boost::array<CT, (SeriesOrder * (SeriesOrder - 1)) / 2>
+    struct coeffs_C3x : coeffs_array<CT, (SeriesOrder * (SeriesOrder - 1)) / 2>
     {
-        coeffs_C3x(CT const& n)
+        constexpr coeffs_C3x(CT const& n)
         {
             evaluate_coeffs_C3x<SeriesOrder>(*this, n);
         }
     };
 
     template <size_t SeriesOrder, typename CT>
-    struct coeffs_C3 : boost::array<CT, SeriesOrder>
+    struct coeffs_C3 : coeffs_array<CT, SeriesOrder>
     {
-        coeffs_C3(CT const& n, CT const& epsilon)
+        constexpr coeffs_C3(CT const& n, CT const& epsilon)
         {
-            coeffs_C3x<SeriesOrder, CT> coeffs_C3x(n);
+            coeffs_C3x<SeriesOrder, CT> const coeffs_C3x(n);
+
+            evaluate_coeffs_C3(*this, coeffs_C3x, epsilon);
+        }
 
+        // The coefficients depending on n calculated once, e.g. by
+        // formula::karney_constants
+        constexpr coeffs_C3(coeffs_C3x<SeriesOrder, CT> const& coeffs_C3x,
+                            CT const& epsilon)
+        {
             evaluate_coeffs_C3(*this, coeffs_C3x, epsilon);
         }
     };
 
     template <size_t SeriesOrder, typename CT>
-    struct coeffs_A3 : boost::array<CT, SeriesOrder>
+    struct coeffs_A3 : coeffs_array<CT, SeriesOrder>
     {
-        coeffs_A3(CT const& n)
+        constexpr coeffs_A3(CT const& n)
         {
             evaluate_coeffs_A3(*this, n);
         }
@@ -0,0 +1,133 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <deque>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/equals.hpp>
+#include <boost/geometry/algorithms/length.hpp>
+#include <boost/geometry/algorithms/detail/range_kernels.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+
+
+using point_t = bg::model::point<double, 2, bg::cs::cartesian>;
+using box_t = bg::model::box<point_t>;
+
+// The kernels are used for a std::vector, and compared with a std::deque
+BOOST_STATIC_ASSERT(bg::detail::range_kernels::is_contiguous_xy<bg::model::ring<point_t> >::value);
+BOOST_STATIC_ASSERT(bg::detail::range_kernels::is_contiguous_xy<bg::model::linestring<point_t> >::value);
+BOOST_STATIC_ASSERT(! bg::detail::range_kernels::is_contiguous_xy<bg::model::linestring<point_t, std::deque> >::value);
+BOOST_STATIC_ASSERT(! bg::detail::range_kernels::is_contiguous_xy<bg::model::linestring<bg::model::point<float, 2, bg::cs::cartesian> > >::value);
+BOOST_STATIC_ASSERT(! bg::detail::range_kernels::is_contiguous_xy<bg::model::linestring<bg::model::point<double, 3, bg::cs::cartesian> > >::value);
+
+
+// Star shaped ring with count points, irregular such that there are no
+// cancellations in the sums
+template <typename Range>
+Range make_range(std::size_t count, bool clockwise)
+{
+    Range range;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        double const angle = (clockwise ? -2.0 : 2.0) * bg::math::pi<double>() * double(i) / double(count);
+        double const radius = 10.0 + double((i * 7919) % 13);
+        bg::range::push_back(range, point_t(100.0 + radius * std::cos(angle),
+                                            -50.0 + radius * std::sin(angle)));
+    }
+    if (count > 0 && bg::closure<Range>::value == bg::closed)
+    {
+        bg::range::push_back(range, range.front());
+    }
+    return range;
+}
+
+template <bool ClockWise, bool Closed>
+void test_ring(std::size_t count)
+{
+    using vector_ring = bg::model::ring<point_t, ClockWise, Closed>;
+    using deque_ring = bg::model::ring<point_t, ClockWise, Closed, std::deque>;
+
+    vector_ring const ring = make_range<vector_ring>(count, ClockWise);
+    deque_ring const expected = make_range<deque_ring>(count, ClockWise);
+
+    double const area = bg::area(ring);
+    BOOST_CHECK_CLOSE(area, bg::area(expected), 1.0e-10);
+    if (count >= 4)
+    {
+        BOOST_CHECK(area > 0);
+    }
+
+    // Reversed orientation
+    BOOST_CHECK_CLOSE(bg::area(make_range<vector_ring>(count, ! ClockWise)),
+                      bg::area(make_range<deque_ring>(count, ! ClockWise)), 1.0e-10);
+
+    box_t box, expected_box;
+    bg::envelope(ring, box);
+    bg::envelope(expected, expected_box);
+    BOOST_CHECK(bg::equals(box, expected_box) || count == 0);
+}
+
+void test_linestring(std::size_t count)
+{
+    using vector_linestring = bg::model::linestring<point_t>;
+    using deque_linestring = bg::model::linestring<point_t, std::deque>;
+
+    vector_linestring const linestring = make_range<vector_linestring>(count, true);
+    deque_linestring const expected = make_range<deque_linestring>(count, true);
+
+    BOOST_CHECK_CLOSE(bg::length(linestring), bg::length(expected), 1.0e-10);
+
+    box_t box, expected_box;
+    bg::envelope(linestring, box);
+    bg::envelope(expected, expected_box);
+    if (count > 0)
+    {
+        BOOST_CHECK(bg::equals(box, expected_box));
+    }
+    else
+    {
+        // Inverse box
+        BOOST_CHECK(bg::get<0>(box.min_corner()) > bg::get<0>(box.max_corner()));
+    }
+}
+
+void test_nan()
+{
+    double const nan = std::numeric_limits<double>::quiet_NaN();
+    bg::model::linestring<point_t> linestring{{0, 0}, {nan, 5}, {2, nan}, {1, 1}, {3, 2}};
+    box_t box;
+    bg::envelope(linestring, box);
+    BOOST_CHECK_EQUAL(bg::get<0>(box.min_corner()), 0.0);
+    BOOST_CHECK_EQUAL(bg::get<1>(box.min_corner()), 0.0);
+    BOOST_CHECK_EQUAL(bg::get<0>(box.max_corner()), 3.0);
+    BOOST_CHECK_EQUAL(bg::get<1>(box.max_corner()), 5.0);
+}
+
+int test_main(int, char* [])
+{
+    for (std::size_t count = 0; count < 12; count++)
+    {
+        test_ring<true, true>(count);
+        test_ring<true, false>(count);
+        test_ring<false, true>(count);
+        test_ring<false, false>(count);
+        test_linestring(count);
+    }
+
+    test_ring<true, true>(1001);
+    test_ring<false, false>(1000);
+    test_linestring(999);
+
+    test_nan();
+
+    return 0;
+}
@@ -11,6 +11,9 @@
 // http://www.boost.org/LICENSE_1_0.txt)
 
 
+#include <sstream>
+#include <string>
+
 #include "test_relate.hpp"
 
 
@@ -411,12 +414,48 @@ void test_multi_polygon_multi_polygon()
                                 "212FF1FF2");
 }
 
+// A grid of count x count squares, the lower left corners spaced by 4
+inline std::string grid_wkt(int count, int offset, int size, std::string const& extra = "")
+{
+    std::ostringstream out;
+    out << "MULTIPOLYGON(";
+    for (int i = 0; i < count * count; i++)
+    {
+        int const x = 4 * (i % count) + offset;
+        int const y = 4 * (i / count) + offset;
+        out << (i > 0 ? "," : "") << "((" << x << " " << y << "," << x << " " << y + size
+            << "," << x + size << " " << y + size << "," << x + size << " " << y
+            << "," << x << " " << y << "))";
+    }
+    out << extra << ")";
+    return out.str();
+}
+
+template <typename P>
+void test_multi_polygon_multi_polygon_many()
+{
+    typedef bg::model::polygon<P> poly;
+    typedef bg::model::multi_polygon<poly> mpoly;
+
+    // Many polygons for which no turns are generated, each inside another one
+    test_geometry<mpoly, mpoly>(grid_wkt(20, 0, 3), grid_wkt(20, 1, 1),
+                                "212FF1FF2");
+    // and one outside all
+    test_geometry<mpoly, mpoly>(grid_wkt(20, 0, 3), grid_wkt(20, 1, 1, ",((-5 -5,-5 -4,-4 -4,-4 -5,-5 -5))"),
+                                "212FF1212");
+    // and one in the hole of a polygon
+    test_geometry<mpoly, mpoly>(grid_wkt(20, 0, 3, ",((-10 -10,-10 -3,-3 -3,-3 -10,-10 -10),(-8 -8,-5 -8,-5 -5,-8 -5,-8 -8))"),
+                                grid_wkt(20, 1, 1, ",((-7 -7,-7 -6,-6 -6,-6 -7,-7 -7))"),
+                                "212FF1212");
+}
+
 template <typename P>
 void test_all()
 {
     test_polygon_polygon<P>();
     test_polygon_multi_polygon<P>();
     test_multi_polygon_multi_polygon<P>();
+    test_multi_polygon_multi_polygon_many<P>();
 }
 
 int test_main( int , char* [] )
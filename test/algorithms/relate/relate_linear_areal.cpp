@@ -12,6 +12,8 @@
 // Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
 // http://www.boost.org/LICENSE_1_0.txt)
 
+#include <sstream>
+
 #include "test_relate.hpp"
 #include "nan_cases.hpp"
 
@@ -512,6 +514,37 @@ void test_multi_linestring_multi_polygon()
                               "101000212");
 }
 
+template <typename P>
+void test_multi_linestring_multi_polygon_many()
+{
+    typedef bg::model::linestring<P> ls;
+    typedef bg::model::polygon<P> poly;
+    typedef bg::model::multi_linestring<ls> mls;
+    typedef bg::model::multi_polygon<poly> mpoly;
+
+    // Many linestrings for which no turns are generated, each inside one of
+    // many polygons
+    int const count = 20;
+    std::ostringstream mls_wkt, mpoly_wkt;
+    mls_wkt << "MULTILINESTRING(";
+    mpoly_wkt << "MULTIPOLYGON(";
+    for (int i = 0; i < count * count; i++)
+    {
+        int const x = 4 * (i % count);
+        int const y = 4 * (i / count);
+        mls_wkt << (i > 0 ? "," : "") << "(" << x + 1 << " " << y + 1 << ","
+                << x + 2 << " " << y + 2 << ")";
+        mpoly_wkt << (i > 0 ? "," : "") << "((" << x << " " << y << "," << x << " " << y + 3
+                  << "," << x + 3 << " " << y + 3 << "," << x + 3 << " " << y
+                  << "," << x << " " << y << "))";
+    }
+    mpoly_wkt << ")";
+
+    test_geometry<mls, mpoly>(mls_wkt.str() + ")", mpoly_wkt.str(), "1FF0FF212");
+    // and one outside all
+    test_geometry<mls, mpoly>(mls_wkt.str() + ",(-5 -5,-4 -4))", mpoly_wkt.str(), "1F10F0212");
+}
+
 template <typename P>
 void test_all()
 {
@@ -519,6 +552,7 @@ void test_all()
     test_linestring_multi_polygon<P>();
     test_multi_linestring_polygon<P>();
     test_multi_linestring_multi_polygon<P>();
+    test_multi_linestring_multi_polygon_many<P>();
 }
 
 int test_main( int , char* [] )
@@ -16,6 +16,7 @@
 // Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
 // http://www.boost.org/LICENSE_1_0.txt)
 
+#include <algorithm>
 #include <iterator>
 #include <vector>
 
@@ -288,6 +289,66 @@ void test_zigzag()
 }
 
 
+template <typename Geometry>
+void test_visvalingam_whyatt(std::string const& wkt,
+        std::string const& expected_wkt,
+        double distance)
+{
+    Geometry geometry, expected;
+    bg::read_wkt(wkt, geometry);
+    bg::read_wkt(expected_wkt, expected);
+    bg::correct_closure(geometry);
+    bg::correct_closure(expected);
+
+    check_geometry(geometry, expected, distance,
+                   bg::strategies::simplify::visvalingam_whyatt<>());
+}
+
+template <typename P>
+void test_visvalingam_whyatt()
+{
+    test_visvalingam_whyatt<bg::model::linestring<P> >(
+        "LINESTRING(0 0,5 5,10 10)",
+        "LINESTRING(0 0,10 10)", 1.0);
+
+    // Effective areas 0.1, 1.55 and 3, after removing the first point 3, 3
+    // and after removing the second point 6
+    test_visvalingam_whyatt<bg::model::linestring<P> >(
+        "LINESTRING(0 0,1 0.1,2 0,3 3,4 0)",
+        "LINESTRING(0 0,2 0,3 3,4 0)", 1.0);
+    test_visvalingam_whyatt<bg::model::linestring<P> >(
+        "LINESTRING(0 0,1 0.1,2 0,3 3,4 0)",
+        "LINESTRING(0 0,3 3,4 0)", 2.0);
+
+    test_visvalingam_whyatt<bg::model::polygon<P> >(
+        "POLYGON((4 0,8 2,8 7,4 9,0 7,0 2,2 1,4 0))",
+        "POLYGON((4 0,8 2,8 7,4 9,0 7,0 2,4 0))", 1.0);
+}
+
+template <typename P>
+void test_workspace()
+{
+    // The same workspace can be reused, also for a smaller range
+    bg::model::linestring<P> zigzag, small;
+    bg::read_wkt("LINESTRING(0 10,1 7,1 9,2 6,2 7,3 4,3 5,5 3,4 5,6 2,6 3,9 1,7 3,10 1)", zigzag);
+    bg::read_wkt("LINESTRING(0 0,5 5,10 10)", small);
+
+    bg::detail::simplify::douglas_peucker_workspace workspace;
+    bg::strategies::simplify::cartesian<> const strategy;
+    for (auto const* line : {&zigzag, &small, &zigzag})
+    {
+        std::vector<P> expected, result;
+        bg::detail::simplify::douglas_peucker::apply(*line,
+            std::back_inserter(expected), 1.0, strategy);
+        bg::detail::simplify::douglas_peucker::apply(*line,
+            std::back_inserter(result), 1.0, strategy, workspace);
+        BOOST_CHECK_EQUAL(result.size(), expected.size());
+        BOOST_CHECK(std::equal(result.begin(), result.end(), expected.begin(),
+                               [](P const& a, P const& b) { return bg::equals(a, b); }));
+    }
+}
+
+
 template <typename P>
 void test_3d()
 {
@@ -375,6 +436,10 @@ int test_main(int, char* [])
 
     test_zigzag<bg::model::d2::point_xy<double> >();
 
+    test_visvalingam_whyatt<bg::model::d2::point_xy<double> >();
+
+    test_workspace<bg::model::d2::point_xy<double> >();
+
     test_different_types();
 
     return 0;
@@ -0,0 +1,103 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "test_formula.hpp"
+#include "inverse_cases.hpp"
+#include "inverse_cases_antipodal.hpp"
+
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_real_distribution.hpp>
+
+#include <boost/geometry/formulas/andoyer_inverse.hpp>
+#include <boost/geometry/formulas/inverse_batch.hpp>
+#include <boost/geometry/formulas/karney_inverse.hpp>
+#include <boost/geometry/formulas/thomas_inverse.hpp>
+#include <boost/geometry/formulas/vincenty_inverse.hpp>
+
+#include <boost/geometry/srs/spheroid.hpp>
+
+
+struct pairs
+{
+    void push_back(double lon1_deg, double lat1_deg, double lon2_deg, double lat2_deg)
+    {
+        double const d2r = bg::math::d2r<double>();
+        lon1.push_back(lon1_deg * d2r);
+        lat1.push_back(lat1_deg * d2r);
+        lon2.push_back(lon2_deg * d2r);
+        lat2.push_back(lat2_deg * d2r);
+    }
+
+    std::vector<double> lon1, lat1, lon2, lat2;
+};
+
+template <typename Inverse>
+void test_formula(std::string const& name, pairs const& p)
+{
+    // WGS84
+    bg::srs::spheroid<double> const spheroid(6378137.0, 6356752.3142451793);
+
+    std::size_t const count = p.lon1.size();
+    std::vector<double> distances(count);
+    bg::formula::inverse_batch<Inverse>::apply(p.lon1.data(), p.lat1.data(),
+                                               p.lon2.data(), p.lat2.data(),
+                                               count, spheroid, distances.data());
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        double const expected = Inverse::apply(p.lon1[i], p.lat1[i], p.lon2[i], p.lat2[i],
+                                               spheroid).distance;
+        std::ostringstream id;
+        id << name << " " << i;
+        check_one(id.str(), distances[i], expected);
+    }
+}
+
+int test_main(int, char*[])
+{
+    pairs p;
+    for (std::size_t i = 0; i < expected_size; ++i)
+    {
+        p.push_back(expected[i].p1.lon, expected[i].p1.lat,
+                    expected[i].p2.lon, expected[i].p2.lat);
+    }
+    for (std::size_t i = 0; i < expected_size_antipodal; ++i)
+    {
+        p.push_back(expected_antipodal[i].p1.lon, expected_antipodal[i].p1.lat,
+                    expected_antipodal[i].p2.lon, expected_antipodal[i].p2.lat);
+    }
+
+    // The same points and the poles
+    p.push_back(10, 20, 10, 20);
+    p.push_back(0, 90, 0, -90);
+    p.push_back(30, 90, 40, 10);
+    p.push_back(30, -90, -40, -90);
+
+    boost::random::mt19937 generator(12345);
+    boost::random::uniform_real_distribution<double> lon(-180, 180), lat(-90, 90);
+    for (int i = 0; i < 1000; ++i)
+    {
+        p.push_back(lon(generator), lat(generator), lon(generator), lat(generator));
+    }
+    for (int i = 0; i < 100; ++i)
+    {
+        double const lo = lon(generator), la = lat(generator);
+        p.push_back(lo, la, lo, la);
+    }
+
+    test_formula<bg::formula::andoyer_inverse<double, true, false> >("andoyer", p);
+    test_formula<bg::formula::thomas_inverse<double, true, false> >("thomas", p);
+    test_formula<bg::formula::vincenty_inverse<double, true, false> >("vincenty", p);
+    test_formula<bg::formula::karney_inverse<double, true, false> >("karney", p);
+
+    return 0;
+}
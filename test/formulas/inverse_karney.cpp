@@ -15,6 +15,8 @@
 // http://www.boost.org/LICENSE_1_0.txt)
 
 
+#include <cmath>
+#include <limits>
 #include <sstream>
 
 #include "test_formula.hpp"
@@ -22,6 +24,7 @@
 #include "inverse_cases_antipodal.hpp"
 #include "inverse_cases_small_angles.hpp"
 
+#include <boost/geometry/formulas/karney_constants.hpp>
 #include <boost/geometry/formulas/karney_inverse.hpp>
 
 #include <boost/geometry/srs/spheroid.hpp>
@@ -47,6 +50,12 @@ void test_all(expected_results const& results)
     check_inverse("karney", results, result_k, results.vincenty, results.reference, 0.0000001);
 }
 
+// WGS84, calculated at compile time
+constexpr bg::formula::karney_constants<double> wgs84
+    = bg::formula::karney_constants_wgs84<double>();
+static_assert(wgs84.m_coeffs_A3[0] == 1.0, "constant expression");
+static_assert(wgs84.m_b == 6356752.3142451793, "constant expression");
+
 template <typename ExpectedResults>
 void test_karney(ExpectedResults const& results)
 {
@@ -66,10 +75,70 @@ void test_karney(ExpectedResults const& results)
     result.azimuth *= bg::math::r2d<double>();
     result.reverse_azimuth *= bg::math::r2d<double>();
     check_inverse("karney", results, result, results.karney, results.karney, 0.0000001);
+
+    // The distance only, calculated with the constants of the spheroid
+    // calculated once
+    typedef bg::formula::karney_inverse<double, true, false> kd_t;
+    double const distance = kd_t::apply(lon1d, lat1d, lon2d, lat2d, wgs84).distance;
+    check_one("karney distance", distance, result.distance, result.distance, 0.000000001);
+}
+
+// The derivative of lambda12 used by the Newton's method is calculated from
+// the reduced length, also if the formula does not return it
+template <typename Inverse>
+double lambda12(double beta1, double beta2, double lam12, double alpha1,
+                double& diff_lam12)
+{
+    double const f = wgs84.m_f;
+    double const ep2 = wgs84.m_ep2;
+    double const tiny = std::sqrt((std::numeric_limits<double>::min)());
+
+    double const sin_beta1 = sin(beta1), cos_beta1 = cos(beta1);
+    double const sin_beta2 = sin(beta2), cos_beta2 = cos(beta2);
+    double const dn1 = sqrt(1 + ep2 * bg::math::sqr(sin_beta1));
+    double const dn2 = sqrt(1 + ep2 * bg::math::sqr(sin_beta2));
+
+    double sin_alpha2, cos_alpha2, sigma12;
+    double sin_sigma1, cos_sigma1, sin_sigma2, cos_sigma2;
+    double eps, diff_omega12;
+    diff_lam12 = 0;
+    return Inverse::lambda12(sin_beta1, cos_beta1, dn1,
+                             sin_beta2, cos_beta2, dn2,
+                             sin(alpha1), cos(alpha1),
+                             sin(lam12), cos(lam12),
+                             sin_alpha2, cos_alpha2, sigma12,
+                             sin_sigma1, cos_sigma1, sin_sigma2, cos_sigma2,
+                             eps, diff_omega12, true, diff_lam12,
+                             f, ep2, tiny, wgs84.m_coeffs_A3, wgs84.m_coeffs_C3x);
+}
+
+template <typename Inverse>
+void test_lambda12_derivative(double beta1, double beta2, double lam12, double alpha1)
+{
+    double const d2r = bg::math::d2r<double>();
+    double const h = 1e-6;
+
+    double diff_lam12, dummy;
+    lambda12<Inverse>(beta1 * d2r, beta2 * d2r, lam12 * d2r, alpha1 * d2r, diff_lam12);
+    double const v1 = lambda12<Inverse>(beta1 * d2r, beta2 * d2r, lam12 * d2r,
+                                        alpha1 * d2r - h, dummy);
+    double const v2 = lambda12<Inverse>(beta1 * d2r, beta2 * d2r, lam12 * d2r,
+                                        alpha1 * d2r + h, dummy);
+
+    BOOST_CHECK_CLOSE(diff_lam12, (v2 - v1) / (2 * h), 0.0001);
 }
 
 int test_main(int, char*[])
 {
+    typedef bg::formula::karney_inverse<double, true, false> kd_t;
+    typedef bg::formula::karney_inverse<double, true, true, true, true, true> ka_t;
+    test_lambda12_derivative<kd_t>(-30, 29.5, 179, 100);
+    test_lambda12_derivative<ka_t>(-30, 29.5, 179, 100);
+    test_lambda12_derivative<kd_t>(-0.5, 0.4, 178, 120);
+    test_lambda12_derivative<ka_t>(-0.5, 0.4, 178, 120);
+    test_lambda12_derivative<kd_t>(-60, 10, 60, 45);
+
+
     for (size_t i = 0; i < expected_size; ++i)
     {
         test_all(expected[i]);
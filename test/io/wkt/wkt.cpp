@@ -20,6 +20,7 @@
 #include <sstream>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 #include <boost/algorithm/string.hpp>
 
@@ -270,6 +271,142 @@ void test_precise_to_wkt()
     check_precise_to_wkt(polygon,"POLYGON((0 0,0 4,4 4,4 0,0 0))",3);
 }
 
+template <typename T>
+void test_wkt_reader()
+{
+    using point_type = bg::model::point<T, 2, bg::cs::cartesian>;
+    using polygon_type = bg::model::polygon<point_type>;
+
+    std::string const buffer = "POLYGON((0 0,0 5,5 5,5 0,0 0))\n"
+        "POLYGON((0 0,0 +2,2 2,2 0,0 0),(1 1,2 1,1 2,1 1))\r\n"
+        "\tPOLYGON EMPTY\n"
+        "POLYGON((0 0,0 1,1 1,1 0,0 0))\n\n";
+
+    // The buffer is not copied, so it cannot be a temporary
+    BOOST_STATIC_ASSERT((! std::is_constructible
+        <
+            bg::wkt_reader<polygon_type>, std::string&&
+        >::value));
+
+    {
+        bg::wkt_reader<polygon_type> reader(buffer);
+        polygon_type polygon;
+        std::vector<std::string> wkts;
+        while (reader.read(polygon))
+        {
+            wkts.push_back(bg::to_wkt(polygon));
+        }
+        BOOST_CHECK_EQUAL(wkts.size(), 4u);
+        if (wkts.size() == 4u)
+        {
+            BOOST_CHECK_EQUAL(wkts[0], "POLYGON((0 0,0 5,5 5,5 0,0 0))");
+            BOOST_CHECK_EQUAL(wkts[1], "POLYGON((0 0,0 2,2 2,2 0,0 0),(1 1,2 1,1 2,1 1))");
+            BOOST_CHECK_EQUAL(wkts[2], "POLYGON()");
+            BOOST_CHECK_EQUAL(wkts[3], "POLYGON((0 0,0 1,1 1,1 0,0 0))");
+        }
+    }
+
+    {
+        // From a stream, into a dynamic geometry
+        std::istringstream stream("POINT(1 2) LINESTRING(0 0,1 1)");
+        using variant_type = boost::variant<point_type, bg::model::linestring<point_type> >;
+        bg::wkt_reader<variant_type> reader(stream);
+        variant_type geometry;
+        BOOST_CHECK(reader.read(geometry));
+        BOOST_CHECK_EQUAL(bg::to_wkt(geometry), "POINT(1 2)");
+        BOOST_CHECK(reader.read(geometry));
+        BOOST_CHECK_EQUAL(bg::to_wkt(geometry), "LINESTRING(0 0,1 1)");
+        BOOST_CHECK(! reader.read(geometry));
+    }
+
+    {
+        // Errors mention the token
+        std::string const wrong = "POLYGON((0 0,0 1,1 1,0 0)) POINT(1 1)";
+        bg::wkt_reader<polygon_type> reader(wrong);
+        polygon_type polygon;
+        BOOST_CHECK(reader.read(polygon));
+        std::string e("no exception");
+        try
+        {
+            reader.read(polygon);
+        }
+        catch (bg::read_wkt_exception const& ex)
+        {
+            e = ex.what();
+        }
+        BOOST_CHECK_MESSAGE(boost::starts_with(e, "Should start with 'POLYGON'"), e);
+    }
+}
+
+template <typename G>
+void test_append_wkt(std::string const& wkt)
+{
+    // Same as streaming, for coordinates streamed without loss
+    G const geometry = bg::from_wkt<G>(wkt);
+    std::string output = "prefix ";
+    bg::append_wkt(output, geometry);
+    BOOST_CHECK_EQUAL(output, "prefix " + bg::to_wkt(geometry));
+}
+
+void test_append_wkt_precision()
+{
+    using point_type = bg::model::point<double, 2, bg::cs::cartesian>;
+
+    point_type const p1(0.1, -1.0 / 3.0);
+    point_type const p2(1.0e-300, 123456789012.5);
+    bg::model::linestring<point_type> const line{p1, p2};
+
+    std::string output;
+    bg::append_wkt(output, p1);
+    BOOST_CHECK_EQUAL(output.substr(0, 10), "POINT(0.1 ");
+
+    // Shortest representation which reads back the same
+    output.clear();
+    bg::append_wkt(output, line);
+    auto const result = bg::from_wkt<bg::model::linestring<point_type> >(output);
+    BOOST_CHECK_EQUAL(result.size(), 2u);
+    if (result.size() == 2u)
+    {
+        BOOST_CHECK(bg::get<1>(result[0]) == bg::get<1>(p1));
+        BOOST_CHECK(bg::get<0>(result[1]) == bg::get<0>(p2));
+        BOOST_CHECK(bg::get<1>(result[1]) == bg::get<1>(p2));
+    }
+
+    // Bulk, read back by the wkt_reader
+    std::vector<bg::model::linestring<point_type> > lines(3, line);
+    output.clear();
+    bg::append_wkt_all(output, lines);
+    bg::wkt_reader<bg::model::linestring<point_type> > reader(output);
+    bg::model::linestring<point_type> read;
+    std::size_t count = 0;
+    while (reader.read(read))
+    {
+        std::string again;
+        bg::append_wkt(again, read);
+        BOOST_CHECK_EQUAL(again + "\n", output.substr(0, again.size() + 1));
+        count++;
+    }
+    BOOST_CHECK_EQUAL(count, 3u);
+}
+
+template <typename T>
+void test_append_wkt_all_types()
+{
+    using P = bg::model::point<T, 2, bg::cs::cartesian>;
+
+    test_append_wkt<P>("POINT(1 -2)");
+    test_append_wkt<bg::model::linestring<P> >("LINESTRING(1 1,2 2,3 3)");
+    test_append_wkt<bg::model::polygon<P> >("POLYGON((0 0,0 4,4 4,4 0,0 0),(1 1,2 1,2 2,1 2,1 1))");
+    test_append_wkt<bg::model::polygon<P, true, false> >("POLYGON((0 0,0 4,4 4,4 0))");
+    test_append_wkt<bg::model::ring<P, true, false> >("POLYGON((0 0,0 4,4 4,4 0))");
+    test_append_wkt<bg::model::multi_point<P> >("MULTIPOINT((1 2),(3 4))");
+    test_append_wkt<bg::model::multi_polygon<bg::model::polygon<P> > >(
+        "MULTIPOLYGON(((0 0,0 4,4 4,4 0,0 0)),((5 5,5 6,6 6,6 5,5 5)))");
+    test_append_wkt<bg::model::box<P> >("BOX(0 0,2 3)");
+    test_append_wkt<bg::model::segment<P> >("LINESTRING(0 0,2 3)");
+    test_append_wkt<bg::model::linestring<P> >("LINESTRING EMPTY");
+}
+
 #ifndef GEOMETRY_TEST_MULTI
 template <typename T>
 void test_order_closure()
@@ -390,6 +527,11 @@ int test_main(int, char* [])
     test_all<double>();
     test_all<int>();
     test_precise_to_wkt();
+    test_wkt_reader<double>();
+    test_wkt_reader<int>();
+    test_append_wkt_all_types<double>();
+    test_append_wkt_all_types<int>();
+    test_append_wkt_precision();
 
 #if defined(HAVE_TTMATH)
     test_all<ttmath_big>();
@@ -0,0 +1,128 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Robustness Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares the performance of side strategies: the default (adaptive)
+// side_by_triangle, and a plain determinant promoted to long double or to a
+// multiprecision floating point type.
+// Half of the points are nearly collinear, such that the adaptive strategy
+// has to use its precise evaluation for part of them.
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#include <boost/program_options.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_real_distribution.hpp>
+
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/strategy/cartesian/side_by_triangle.hpp>
+#include <boost/geometry/strategy/cartesian/side_non_robust.hpp>
+#include <boost/geometry/strategy/cartesian/side_robust.hpp>
+
+namespace bg = boost::geometry;
+
+using point_type = bg::model::d2::point_xy<double>;
+
+template <typename Strategy>
+void test_side(std::string const& name, std::vector<point_type> const& points,
+               int count)
+{
+    auto const t0 = std::chrono::high_resolution_clock::now();
+
+    long sum = 0;
+    for (int c = 0; c < count; c++)
+    {
+        for (std::size_t i = 0; i + 2 < points.size(); i += 3)
+        {
+            sum += Strategy::apply(points[i], points[i + 1], points[i + 2]);
+        }
+    }
+
+    auto const t = std::chrono::high_resolution_clock::now();
+    auto const elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(t - t0).count();
+    std::cout << " strategy: " << name
+        << " sum: " << sum
+        << " time: " << elapsed_ms / 1000.0 << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        namespace po = boost::program_options;
+        po::options_description description("=== side_performance ===\nAllowed options");
+
+        int count = 10;
+        int triangle_count = 100000;
+        bool multiprecision = true;
+
+        description.add_options()
+            ("help", "Help message")
+            ("count", po::value<int>(&count)->default_value(10), "Number of runs")
+            ("triangles", po::value<int>(&triangle_count)->default_value(100000), "Number of triangles")
+            ("mp", po::value<bool>(&multiprecision)->default_value(true), "Include multiprecision")
+        ;
+
+        po::variables_map varmap;
+        po::store(po::parse_command_line(argc, argv, description), varmap);
+        po::notify(varmap);
+
+        if (varmap.count("help"))
+        {
+            std::cout << description << std::endl;
+            return 1;
+        }
+
+        boost::random::mt19937 generator(12345);
+        boost::random::uniform_real_distribution<double> distribution(-100.0, 100.0);
+
+        std::vector<point_type> points;
+        for (int i = 0; i < triangle_count; i++)
+        {
+            point_type const p1(distribution(generator), distribution(generator));
+            point_type const p2(distribution(generator), distribution(generator));
+            points.push_back(p1);
+            points.push_back(p2);
+            if (i % 2 == 0)
+            {
+                points.emplace_back(distribution(generator), distribution(generator));
+            }
+            else
+            {
+                // Nearly collinear
+                double const f = (distribution(generator) + 100.0) / 200.0;
+                points.emplace_back(p1.x() + f * (p2.x() - p1.x()),
+                                    p1.y() + f * (p2.y() - p1.y()));
+            }
+        }
+
+        namespace bs = bg::strategy::side;
+        using mp_type = boost::multiprecision::cpp_bin_float_50;
+
+        test_side<bs::side_by_triangle<>>("side_by_triangle (adaptive)", points, count);
+        test_side<bs::side_robust<>>("side_robust", points, count);
+        test_side<bs::side_non_robust<>>("side_non_robust", points, count);
+        test_side<bs::side_non_robust<long double>>("side_non_robust<long double>", points, count);
+        if (multiprecision)
+        {
+            test_side<bs::side_non_robust<mp_type>>("side_non_robust<cpp_bin_float_50>", points, count);
+        }
+    }
+    catch(std::exception const& e)
+    {
+        std::cout << "Exception " << e.what() << std::endl;
+    }
+    catch(...)
+    {
+        std::cout << "Other exception" << std::endl;
+    }
+
+    return 0;
+}
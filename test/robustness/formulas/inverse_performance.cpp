@@ -0,0 +1,155 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Robustness Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares the accuracy and the throughput of the inverse formulas, applied
+// to each pair of points and by formula::inverse_batch. The errors are the
+// differences from karney_inverse.
+// The batch kernels of andoyer and thomas are vectorized by GCC with glibc
+// if compiled with -O3 -ffast-math.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/program_options.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_real_distribution.hpp>
+
+#include <boost/geometry/formulas/andoyer_inverse.hpp>
+#include <boost/geometry/formulas/inverse_batch.hpp>
+#include <boost/geometry/formulas/karney_inverse.hpp>
+#include <boost/geometry/formulas/thomas_inverse.hpp>
+#include <boost/geometry/formulas/vincenty_inverse.hpp>
+#include <boost/geometry/srs/spheroid.hpp>
+
+namespace bg = boost::geometry;
+
+struct pairs
+{
+    std::vector<double> lon1, lat1, lon2, lat2;
+};
+
+template <typename Function>
+double measure(Function const& function)
+{
+    auto const t0 = std::chrono::high_resolution_clock::now();
+    function();
+    auto const t = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double>(t - t0).count();
+}
+
+template <typename Inverse>
+void test_formula(std::string const& name, pairs const& p, std::vector<double> const& reference)
+{
+    bg::srs::spheroid<double> const spheroid;
+    std::size_t const count = p.lon1.size();
+
+    std::vector<double> single(count), batch(count);
+
+    double const time_single = measure([&]()
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            single[i] = Inverse::apply(p.lon1[i], p.lat1[i], p.lon2[i], p.lat2[i], spheroid).distance;
+        }
+    });
+
+    double const time_batch = measure([&]()
+    {
+        bg::formula::inverse_batch<Inverse>::apply(p.lon1.data(), p.lat1.data(),
+                                                   p.lon2.data(), p.lat2.data(),
+                                                   count, spheroid, batch.data());
+    });
+
+    double max_error = 0, sum_error = 0, max_difference = 0;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        double const error = std::abs(batch[i] - reference[i]);
+        max_error = (std::max)(max_error, error);
+        sum_error += error;
+        max_difference = (std::max)(max_difference, std::abs(batch[i] - single[i]));
+    }
+
+    std::cout << name
+        << " single: " << count / time_single / 1e6 << " Mpairs/s"
+        << " batch: " << count / time_batch / 1e6 << " Mpairs/s"
+        << " max error: " << max_error << " m"
+        << " mean error: " << sum_error / count << " m"
+        << " max difference from single: " << max_difference << " m"
+        << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        namespace po = boost::program_options;
+        po::options_description description("=== inverse_performance ===\nAllowed options");
+
+        int count = 1000000;
+        double max_distance = 180;
+
+        description.add_options()
+            ("help", "Help message")
+            ("count", po::value<int>(&count)->default_value(1000000), "Number of pairs")
+            ("max_distance", po::value<double>(&max_distance)->default_value(180),
+                "Maximum difference of coordinates of a pair, in degrees")
+        ;
+
+        po::variables_map varmap;
+        po::store(po::parse_command_line(argc, argv, description), varmap);
+        po::notify(varmap);
+
+        if (varmap.count("help"))
+        {
+            std::cout << description << std::endl;
+            return 1;
+        }
+
+        double const d2r = bg::math::d2r<double>();
+        boost::random::mt19937 generator(12345);
+        boost::random::uniform_real_distribution<double> lon(-180, 180), lat(-89, 89),
+            delta(-max_distance, max_distance);
+
+        pairs p;
+        for (int i = 0; i < count; ++i)
+        {
+            double const lon1 = lon(generator), lat1 = lat(generator);
+            double const lat2 = (std::max)(-89.0, (std::min)(89.0, lat1 + delta(generator) / 2));
+            p.lon1.push_back(lon1 * d2r);
+            p.lat1.push_back(lat1 * d2r);
+            p.lon2.push_back((lon1 + delta(generator)) * d2r);
+            p.lat2.push_back(lat2 * d2r);
+        }
+
+        bg::srs::spheroid<double> const spheroid;
+        std::vector<double> reference(count);
+        bg::formula::inverse_batch
+            <
+                bg::formula::karney_inverse<double, true, false>
+            >::apply(p.lon1.data(), p.lat1.data(), p.lon2.data(), p.lat2.data(),
+                     count, spheroid, reference.data());
+
+        test_formula<bg::formula::andoyer_inverse<double, true, false> >("andoyer", p, reference);
+        test_formula<bg::formula::thomas_inverse<double, true, false> >("thomas", p, reference);
+        test_formula<bg::formula::vincenty_inverse<double, true, false> >("vincenty", p, reference);
+        test_formula<bg::formula::karney_inverse<double, true, false> >("karney", p, reference);
+    }
+    catch(std::exception const& e)
+    {
+        std::cout << "Exception " << e.what() << std::endl;
+    }
+    catch(...)
+    {
+        std::cout << "Other exception" << std::endl;
+    }
+
+    return 0;
+}
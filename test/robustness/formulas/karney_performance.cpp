@@ -0,0 +1,166 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Robustness Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Measures the throughput of the geographic distance and area strategies
+// using karney_inverse, with the strategy constructed once and for each
+// call. The sums of the results are printed to compare the versions.
+
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/program_options.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_real_distribution.hpp>
+
+#include <boost/geometry.hpp>
+
+namespace bg = boost::geometry;
+
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_type;
+typedef bg::model::polygon<point_type> polygon_type;
+
+template <typename Function>
+double measure(Function const& function)
+{
+    auto const t0 = std::chrono::high_resolution_clock::now();
+    function();
+    auto const t = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double>(t - t0).count();
+}
+
+template <typename Strategy>
+void test_distance(std::string const& name, std::vector<point_type> const& points)
+{
+    std::size_t const count = points.size() / 2;
+    Strategy const strategy;
+
+    double sum_once = 0, sum_each = 0;
+    double const time_once = measure([&]()
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            sum_once += bg::distance(points[2 * i], points[2 * i + 1], strategy);
+        }
+    });
+    double const time_each = measure([&]()
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            sum_each += bg::distance(points[2 * i], points[2 * i + 1], Strategy());
+        }
+    });
+
+    std::cout << std::setprecision(17) << name
+        << " strategy once: " << count / time_once / 1e6 << " Mpairs/s"
+        << " strategy per call: " << count / time_each / 1e6 << " Mpairs/s"
+        << " sum: " << sum_once << " " << sum_each
+        << std::endl;
+}
+
+template <typename Strategy>
+void test_area(std::string const& name, std::vector<polygon_type> const& polygons)
+{
+    std::size_t const count = polygons.size();
+    Strategy const strategy;
+
+    double sum_once = 0, sum_each = 0;
+    double const time_once = measure([&]()
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            sum_once += bg::area(polygons[i], strategy);
+        }
+    });
+    double const time_each = measure([&]()
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            sum_each += bg::area(polygons[i], Strategy());
+        }
+    });
+
+    std::cout << std::setprecision(17) << name
+        << " strategy once: " << count / time_once / 1e3 << " kpolygons/s"
+        << " strategy per call: " << count / time_each / 1e3 << " kpolygons/s"
+        << " sum: " << sum_once << " " << sum_each
+        << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        namespace po = boost::program_options;
+        po::options_description description("=== karney_performance ===\nAllowed options");
+
+        int count = 200000;
+        int polygon_count = 20000;
+        int polygon_size = 8;
+
+        description.add_options()
+            ("help", "Help message")
+            ("count", po::value<int>(&count)->default_value(200000), "Number of pairs")
+            ("polygon_count", po::value<int>(&polygon_count)->default_value(20000),
+                "Number of polygons")
+            ("polygon_size", po::value<int>(&polygon_size)->default_value(8),
+                "Number of vertices of a polygon")
+        ;
+
+        po::variables_map varmap;
+        po::store(po::parse_command_line(argc, argv, description), varmap);
+        po::notify(varmap);
+
+        if (varmap.count("help"))
+        {
+            std::cout << description << std::endl;
+            return 1;
+        }
+
+        boost::random::mt19937 generator(12345);
+        boost::random::uniform_real_distribution<double> lon(-180, 180), lat(-89, 89),
+            radius(0.01, 5);
+
+        std::vector<point_type> points;
+        for (int i = 0; i < 2 * count; ++i)
+        {
+            points.push_back(point_type(lon(generator), lat(generator)));
+        }
+
+        // Convex polygons around random centers, clockwise
+        double const pi = bg::math::pi<double>();
+        std::vector<polygon_type> polygons(polygon_count);
+        for (int i = 0; i < polygon_count; ++i)
+        {
+            double const x = lon(generator), y = lat(generator) * 0.9, r = radius(generator);
+            for (int j = 0; j < polygon_size; ++j)
+            {
+                double const angle = -2 * pi * j / polygon_size;
+                bg::append(polygons[i], point_type(x + r * std::cos(angle), y + r * std::sin(angle)));
+            }
+            bg::append(polygons[i], polygons[i].outer().front());
+        }
+
+        test_distance<bg::strategy::distance::karney<> >("distance karney", points);
+        test_distance<bg::strategy::distance::geographic<> >("distance andoyer", points);
+        test_area<bg::strategy::area::geographic<bg::strategy::karney> >("area karney", polygons);
+        test_area<bg::strategy::area::geographic<> >("area andoyer", polygons);
+    }
+    catch(std::exception const& e)
+    {
+        std::cout << "Exception " << e.what() << std::endl;
+    }
+    catch(...)
+    {
+        std::cout << "Other exception" << std::endl;
+    }
+
+    return 0;
+}
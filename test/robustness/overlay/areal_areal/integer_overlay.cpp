@@ -0,0 +1,128 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Robustness Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares the performance of overlays of polygons with coordinates snapped
+// to a grid, using double and using int64 coordinates (with the same values).
+// For int64 all predicates are calculated exactly, in integer arithmetic.
+// NOTE: there is no randomness here. Count is to measure performance
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+
+namespace bg = boost::geometry;
+
+// Creates a star around a center, snapped to a grid with the specified
+// resolution. The stars of the two inputs have (nearly) collinear edges.
+template <typename Polygon>
+inline void make_star(Polygon& polygon, int point_count,
+                      double cx, double cy, double radius, double rotation,
+                      double resolution)
+{
+    typedef typename bg::point_type<Polygon>::type point_type;
+    typedef typename bg::coordinate_type<Polygon>::type coordinate_type;
+
+    double const delta = 2.0 * bg::math::pi<double>() / point_count;
+    for (int i = 0; i < point_count; i++)
+    {
+        double const angle = -(rotation + i * delta);
+        double const r = i % 2 == 0 ? radius : radius * 0.6;
+        double const x = std::round((cx + r * std::cos(angle)) * resolution);
+        double const y = std::round((cy + r * std::sin(angle)) * resolution);
+        bg::exterior_ring(polygon).push_back(point_type(
+            static_cast<coordinate_type>(x), static_cast<coordinate_type>(y)));
+    }
+    bg::exterior_ring(polygon).push_back(bg::exterior_ring(polygon).front());
+}
+
+template <typename T>
+void test_overlay(int count, int point_count, double resolution)
+{
+    typedef bg::model::polygon<bg::model::d2::point_xy<T> > polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    std::vector<polygon> p(count), q(count);
+    for (int i = 0; i < count; i++)
+    {
+        double const offset = i * 0.001;
+        make_star(p[i], point_count, 25.0, 25.0, 20.0, 0.0, resolution);
+        make_star(q[i], point_count, 25.0 + offset, 25.0 - offset, 20.0,
+                  bg::math::pi<double>() / point_count + offset, resolution);
+    }
+
+    auto const t0 = std::chrono::high_resolution_clock::now();
+
+    double area = 0.0;
+    std::size_t polygon_count = 0;
+    for (int i = 0; i < count; i++)
+    {
+        multi_polygon intersection, union_output;
+        bg::intersection(p[i], q[i], intersection);
+        bg::union_(p[i], q[i], union_output);
+        area += bg::area(intersection) + bg::area(union_output);
+        polygon_count += intersection.size() + union_output.size();
+    }
+
+    auto const t = std::chrono::high_resolution_clock::now();
+    auto const elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(t - t0).count();
+    std::cout
+        << " type: " << (std::is_integral<T>::value ? "int64" : "double")
+        << " polygons: " << polygon_count
+        << " area: " << area / (resolution * resolution)
+        << " time: " << elapsed_ms / 1000.0 << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        namespace po = boost::program_options;
+        po::options_description description("=== integer_overlay ===\nAllowed options");
+
+        int count = 100;
+        int point_count = 500;
+        double resolution = 1.0e6;
+
+        description.add_options()
+            ("help", "Help message")
+            ("count", po::value<int>(&count)->default_value(100), "Number of tests")
+            ("points", po::value<int>(&point_count)->default_value(500), "Number of points of each star")
+            ("resolution", po::value<double>(&resolution)->default_value(1.0e6), "Grid resolution (coordinates up to 50 times this value)")
+        ;
+
+        po::variables_map varmap;
+        po::store(po::parse_command_line(argc, argv, description), varmap);
+        po::notify(varmap);
+
+        if (varmap.count("help"))
+        {
+            std::cout << description << std::endl;
+            return 1;
+        }
+
+        test_overlay<double>(count, point_count, resolution);
+        test_overlay<std::int64_t>(count, point_count, resolution);
+    }
+    catch(std::exception const& e)
+    {
+        std::cout << "Exception " << e.what() << std::endl;
+    }
+    catch(...)
+    {
+        std::cout << "Other exception" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,179 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Robustness Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares the performance of pj_transform(), which decides the steps of the
+// transformation for each call and transforms the points step by step, with
+// the pipeline used by srs::transformation, which decides the steps once and
+// transforms blocks of points in a single pass.
+// The coordinate systems are EPSG:4326, EPSG:3857 and EPSG:32633, defined by
+// PROJ4 strings and by static parameters.
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/program_options.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_real_distribution.hpp>
+
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/srs/transformation.hpp>
+
+namespace bg = boost::geometry;
+
+using point_ll = bg::model::point<double, 2, bg::cs::geographic<bg::degree>>;
+using point_xy = bg::model::point<double, 2, bg::cs::cartesian>;
+
+template <typename Function>
+void measure(std::string const& name, int count, Function const& function)
+{
+    auto const t0 = std::chrono::high_resolution_clock::now();
+
+    double sum = 0;
+    for (int c = 0; c < count; c++)
+    {
+        sum += function();
+    }
+
+    auto const t = std::chrono::high_resolution_clock::now();
+    auto const elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(t - t0).count();
+    std::cout << " " << name
+        << " sum: " << sum
+        << " time: " << elapsed_ms / 1000.0 << std::endl;
+}
+
+template <typename Range>
+double sum_of(Range const& range)
+{
+    double sum = 0;
+    for (auto const& p : range)
+    {
+        if (bg::get<0>(p) != HUGE_VAL)
+        {
+            sum += bg::get<0>(p) + bg::get<1>(p);
+        }
+    }
+    return sum;
+}
+
+template <typename Proj1, typename Proj2, typename Parameters1, typename Parameters2>
+void test_pair(std::string const& name, Parameters1 const& parameters1, Parameters2 const& parameters2,
+               std::vector<point_ll> const& points, int count)
+{
+    using proj1_type = bg::projections::proj_wrapper<Proj1, double>;
+    using proj2_type = bg::projections::proj_wrapper<Proj2, double>;
+    proj1_type const proj1(parameters1);
+    proj2_type const proj2(parameters2);
+
+    // The input of pj_transform(), angles in radians
+    std::vector<point_xy> radians;
+    for (point_ll const& p : points)
+    {
+        radians.emplace_back(bg::get_as_radian<0>(p), bg::get_as_radian<1>(p));
+    }
+
+    bg::srs::detail::empty_projection_grids const grids;
+
+    std::cout << name << std::endl;
+
+    measure("pj_transform", count, [&]()
+    {
+        std::vector<point_xy> range = radians;
+        bg::projections::detail::pj_transform(proj1.proj(), proj1.proj().params(),
+                                              proj2.proj(), proj2.proj().params(),
+                                              range, grids, grids);
+        return sum_of(range);
+    });
+
+    measure("pipeline", count, [&]()
+    {
+        bg::projections::detail::pj_transform_steps<double> const
+            steps(proj1.proj().params(), proj2.proj().params());
+        std::vector<point_xy> range = radians;
+        bg::projections::detail::make_pj_transform_pipeline(
+            proj1.proj(), proj1.proj().params(),
+            proj2.proj(), proj2.proj().params(),
+            steps).apply(range, grids, grids);
+        return sum_of(range);
+    });
+
+    bg::srs::transformation<Proj1, Proj2> const tr(parameters1, parameters2);
+    bg::model::multi_point<point_ll> const mpt(points.begin(), points.end());
+    measure("transformation", count, [&]()
+    {
+        bg::model::multi_point<point_xy> result;
+        tr.forward(mpt, result);
+        return sum_of(result);
+    });
+}
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        namespace po = boost::program_options;
+        po::options_description description("=== transformation_performance ===\nAllowed options");
+
+        int count = 10;
+        int point_count = 1000000;
+
+        description.add_options()
+            ("help", "Help message")
+            ("count", po::value<int>(&count)->default_value(10), "Number of runs")
+            ("points", po::value<int>(&point_count)->default_value(1000000), "Number of points")
+        ;
+
+        po::variables_map varmap;
+        po::store(po::parse_command_line(argc, argv, description), varmap);
+        po::notify(varmap);
+
+        if (varmap.count("help"))
+        {
+            std::cout << description << std::endl;
+            return 1;
+        }
+
+        // In the area of use of EPSG:32633
+        boost::random::mt19937 generator(12345);
+        boost::random::uniform_real_distribution<double> lon(12.0, 18.0);
+        boost::random::uniform_real_distribution<double> lat(0.0, 84.0);
+
+        std::vector<point_ll> points;
+        for (int i = 0; i < point_count; i++)
+        {
+            points.emplace_back(lon(generator), lat(generator));
+        }
+
+        std::string const epsg4326 = "+proj=longlat +ellps=WGS84 +datum=WGS84 +no_defs";
+        std::string const epsg3857 = "+proj=merc +a=6378137 +b=6378137 +lat_ts=0.0 +lon_0=0.0 "
+                                     "+x_0=0.0 +y_0=0 +k=1.0 +units=m +nadgrids=@null +wktext +no_defs";
+        std::string const epsg32633 = "+proj=utm +zone=33 +ellps=WGS84 +datum=WGS84 +units=m +no_defs";
+
+        using bg::srs::dynamic;
+        using bg::srs::proj4;
+        test_pair<dynamic, dynamic>("4326 -> 3857", proj4(epsg4326), proj4(epsg3857), points, count);
+        test_pair<dynamic, dynamic>("4326 -> 32633", proj4(epsg4326), proj4(epsg32633), points, count);
+
+        {
+            using namespace bg::srs::spar;
+            using wgs84_type = parameters<proj_longlat, ellps_wgs84, datum_wgs84, no_defs>;
+            using utm_type = parameters<proj_utm, zone<33>, ellps_wgs84, datum_wgs84, units_m, no_defs>;
+            test_pair<wgs84_type, utm_type>("4326 -> 32633 (static)", wgs84_type(), utm_type(), points, count);
+        }
+    }
+    catch(std::exception const& e)
+    {
+        std::cout << "Exception " << e.what() << std::endl;
+    }
+    catch(...)
+    {
+        std::cout << "Other exception" << std::endl;
+    }
+
+    return 0;
+}
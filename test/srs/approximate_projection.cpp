@@ -0,0 +1,134 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_real_distribution.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/srs/approximate_projection.hpp>
+
+
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_ll;
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_xy;
+typedef bg::model::box<point_ll> box_ll;
+
+
+double distance(point_xy const& p1, point_xy const& p2)
+{
+    return std::hypot(bg::get<0>(p1) - bg::get<0>(p2), bg::get<1>(p1) - bg::get<1>(p2));
+}
+
+template <typename Proj, typename Parameters>
+void test_error(std::string const& case_id, Parameters const& parameters,
+                box_ll const& region, double max_error)
+{
+    typedef bg::srs::approximate_projection<Proj> approximate_type;
+    typename approximate_type::projection_type const prj(parameters);
+    approximate_type const approx(prj, region, max_error);
+
+    boost::random::mt19937 generator(12345);
+    boost::random::uniform_real_distribution<double>
+        lon(bg::get<bg::min_corner, 0>(region), bg::get<bg::max_corner, 0>(region)),
+        lat(bg::get<bg::min_corner, 1>(region), bg::get<bg::max_corner, 1>(region));
+
+    std::vector<point_ll> points;
+    for (int i = 0; i < 10000; i++)
+    {
+        points.emplace_back(lon(generator), lat(generator));
+    }
+
+    std::vector<point_xy> expected(points.size()), result(points.size());
+    BOOST_CHECK(prj.forward(points.begin(), points.end(), expected.begin()));
+    BOOST_CHECK(approx.forward(points.begin(), points.end(), result.begin()));
+
+    double error = 0;
+    for (std::size_t i = 0; i < points.size(); i++)
+    {
+        error = (std::max)(error, distance(result[i], expected[i]));
+
+        point_xy single;
+        approx.forward(points[i], single);
+        BOOST_CHECK_EQUAL(bg::get<0>(single), bg::get<0>(result[i]));
+        BOOST_CHECK_EQUAL(bg::get<1>(single), bg::get<1>(result[i]));
+    }
+    BOOST_CHECK_MESSAGE(error <= max_error,
+                        case_id << " error: " << error << " max error: " << max_error);
+
+    // Outside of the region projected exactly
+    point_ll const outside(bg::get<bg::max_corner, 0>(region) + 1,
+                           bg::get<bg::max_corner, 1>(region) - 1);
+    point_xy outside_expected, outside_result;
+    prj.forward(outside, outside_expected);
+    approx.forward(outside, outside_result);
+    BOOST_CHECK_EQUAL(bg::get<0>(outside_result), bg::get<0>(outside_expected));
+    BOOST_CHECK_EQUAL(bg::get<1>(outside_result), bg::get<1>(outside_expected));
+
+    // Geometries
+    bg::model::linestring<point_ll> const ls(points.begin(), points.begin() + 100);
+    bg::model::linestring<point_xy> ls_result;
+    BOOST_CHECK(approx.forward(ls, ls_result));
+    BOOST_CHECK_EQUAL(ls_result.size(), 100u);
+    for (std::size_t i = 0; i < ls_result.size(); i++)
+    {
+        BOOST_CHECK_EQUAL(bg::get<0>(ls_result[i]), bg::get<0>(result[i]));
+    }
+
+    // Inverse projection is exact
+    point_ll inv_expected, inv_result;
+    prj.inverse(expected[0], inv_expected);
+    approx.inverse(expected[0], inv_result);
+    BOOST_CHECK_EQUAL(bg::get<0>(inv_result), bg::get<0>(inv_expected));
+    BOOST_CHECK_EQUAL(bg::get<1>(inv_result), bg::get<1>(inv_expected));
+}
+
+void test_invalid()
+{
+    // Points beyond the poles and the horizon of the orthographic projection
+    // can not be projected
+    bg::srs::projection<> const prj(bg::srs::proj4("+proj=ortho +ellps=sphere +lat_0=0 +lon_0=0"));
+    box_ll const region(point_ll(60, -10), point_ll(120, 10));
+    bg::srs::approximate_projection<> const approx(prj, region, 0.01, 6);
+
+    point_xy xy;
+    BOOST_CHECK(approx.forward(point_ll(75, 0), xy));
+    point_xy expected;
+    prj.forward(point_ll(75, 0), expected);
+    BOOST_CHECK_LE(distance(xy, expected), 0.01);
+
+    BOOST_CHECK(! approx.forward(point_ll(100, 0), xy));
+    BOOST_CHECK_EQUAL(bg::get<0>(xy), HUGE_VAL);
+}
+
+int test_main(int, char*[])
+{
+    using namespace bg::srs;
+
+    test_error<dynamic>("tmerc", proj4("+proj=tmerc +ellps=WGS84 +lon_0=15 +k=0.9996 +x_0=500000"),
+                        box_ll(point_ll(10, 45), point_ll(20, 55)), 0.01);
+    test_error<dynamic>("tmerc wide", proj4("+proj=tmerc +ellps=WGS84 +lon_0=15 +k=0.9996 +x_0=500000"),
+                        box_ll(point_ll(-15, 0), point_ll(45, 80)), 0.5);
+    test_error<dynamic>("lcc", proj4("+proj=lcc +ellps=GRS80 +lat_1=49 +lat_2=44 +lat_0=46.5 +lon_0=3 +x_0=700000 +y_0=6600000"),
+                        box_ll(point_ll(-5, 41), point_ll(10, 52)), 0.001);
+
+    {
+        using namespace bg::srs::spar;
+        typedef parameters<proj_utm, zone<33>, ellps_wgs84> utm_type;
+        test_error<utm_type>("utm static", utm_type(), box_ll(point_ll(12, 0), point_ll(18, 84)), 0.1);
+    }
+
+    test_invalid();
+
+    return 0;
+}
@@ -0,0 +1,177 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/srs/projection.hpp>
+
+
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_ll;
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_xy;
+
+
+std::vector<point_ll> test_points()
+{
+    std::vector<point_ll> result;
+    for (int i = -90; i <= 90; i += 5)
+    {
+        for (int j = -180; j <= 180; j += 7)
+        {
+            result.push_back(point_ll(j + 0.25, i));
+        }
+    }
+    // Out of range
+    result.push_back(point_ll(0, 95));
+    result.push_back(point_ll(800, 0));
+    return result;
+}
+
+// Invalid points are set to HUGE_VAL in both cases
+bool is_close(double a, double b, double tolerance)
+{
+    return a == b || std::fabs(a - b) <= tolerance * (1.0 + std::fabs(b));
+}
+
+template <typename Point>
+void check_point(Point const& p, Point const& expected)
+{
+    BOOST_CHECK_MESSAGE(is_close(bg::get<0>(p), bg::get<0>(expected), 1.0e-9)
+                        && is_close(bg::get<1>(p), bg::get<1>(expected), 1.0e-9),
+                        bg::wkt(p) << " != " << bg::wkt(expected));
+}
+
+// Projects the points one by one, and as a range, and as a linestring
+template <typename Projection>
+void test_projection(Projection const& prj, std::string const& name)
+{
+    std::vector<point_ll> const points = test_points();
+
+    std::vector<point_xy> expected(points.size());
+    bool expected_result = true;
+    for (std::size_t i = 0; i < points.size(); i++)
+    {
+        if (! prj.forward(points[i], expected[i]))
+        {
+            expected_result = false;
+        }
+    }
+
+    std::vector<point_xy> xys(points.size());
+    bool const result = prj.forward(points.begin(), points.end(), xys.begin());
+    BOOST_CHECK_MESSAGE(result == expected_result, name);
+    for (std::size_t i = 0; i < points.size(); i++)
+    {
+        check_point(xys[i], expected[i]);
+    }
+
+    bg::model::linestring<point_ll> const ls_ll(points.begin(), points.end());
+    bg::model::linestring<point_xy> ls_xy;
+    BOOST_CHECK_MESSAGE(prj.forward(ls_ll, ls_xy) == expected_result, name);
+    BOOST_CHECK_EQUAL(ls_xy.size(), points.size());
+    for (std::size_t i = 0; i < ls_xy.size(); i++)
+    {
+        check_point(ls_xy[i], expected[i]);
+    }
+
+    // Inverse of the valid points
+    std::vector<point_xy> valid;
+    for (std::size_t i = 0; i < expected.size(); i++)
+    {
+        if (bg::get<0>(expected[i]) != HUGE_VAL)
+        {
+            valid.push_back(expected[i]);
+        }
+    }
+
+    std::vector<point_ll> expected_lls(valid.size());
+    expected_result = true;
+    for (std::size_t i = 0; i < valid.size(); i++)
+    {
+        if (! prj.inverse(valid[i], expected_lls[i]))
+        {
+            expected_result = false;
+        }
+    }
+
+    std::vector<point_ll> lls(valid.size());
+    BOOST_CHECK_MESSAGE(prj.inverse(valid.begin(), valid.end(), lls.begin()) == expected_result, name);
+    for (std::size_t i = 0; i < valid.size(); i++)
+    {
+        check_point(lls[i], expected_lls[i]);
+    }
+}
+
+void test_dynamic(std::string const& proj4)
+{
+    bg::srs::projection<> prj = bg::srs::proj4(proj4);
+    test_projection(prj, proj4);
+}
+
+// A point within the latitude and longitude limits, which cannot be projected,
+// is invalid both if it is projected alone and in a range
+void test_dynamic_out_of_range(std::string const& proj4, point_ll const& ll)
+{
+    bg::srs::projection<> prj = bg::srs::proj4(proj4);
+
+    point_xy xy;
+    BOOST_CHECK_MESSAGE(! prj.forward(ll, xy), proj4);
+    BOOST_CHECK_MESSAGE(bg::get<0>(xy) == HUGE_VAL && bg::get<1>(xy) == HUGE_VAL, proj4);
+
+    std::vector<point_ll> const lls(3, ll);
+    std::vector<point_xy> xys(lls.size());
+    BOOST_CHECK_MESSAGE(! prj.forward(lls.begin(), lls.end(), xys.begin()), proj4);
+    for (std::size_t i = 0; i < xys.size(); i++)
+    {
+        check_point(xys[i], xy);
+    }
+}
+
+int test_main(int, char*[])
+{
+    test_dynamic("+proj=merc +ellps=WGS84");
+    test_dynamic("+proj=merc +R=6370997 +lat_ts=30");
+    test_dynamic("+proj=tmerc +ellps=WGS84 +lon_0=9 +k_0=0.9996 +x_0=500000");
+    test_dynamic("+proj=tmerc +R=6370997 +lat_0=20");
+    test_dynamic("+proj=etmerc +ellps=GRS80 +lon_0=15");
+    test_dynamic("+proj=lcc +ellps=WGS84 +lat_1=33 +lat_2=45 +lat_0=39 +lon_0=-96");
+    test_dynamic("+proj=lcc +R=6370997 +lat_1=20 +lat_2=60");
+    test_dynamic("+proj=lcc +ellps=GRS80 +lat_1=-30 +lat_2=-40 +lat_0=-35");
+    test_dynamic("+proj=laea +ellps=GRS80 +lat_0=52 +lon_0=10 +x_0=4321000 +y_0=3210000");
+    test_dynamic("+proj=laea +ellps=GRS80 +lat_0=90");
+    test_dynamic("+proj=laea +ellps=GRS80 +lat_0=-90");
+    test_dynamic("+proj=laea +ellps=GRS80 +lat_0=0");
+    test_dynamic("+proj=laea +R=6370997 +lat_0=45");
+    test_dynamic("+proj=laea +R=6370997 +lat_0=90");
+    test_dynamic("+proj=laea +R=6370997 +lat_0=0");
+    // Without batched variant
+    test_dynamic("+proj=robin +ellps=WGS84");
+    test_dynamic("+proj=aea +ellps=WGS84 +lat_1=29.5 +lat_2=45.5 +axis=neu");
+    test_dynamic("+proj=utm +zone=32 +ellps=WGS84 +units=km");
+
+    test_dynamic_out_of_range("+proj=etmerc +ellps=GRS80 +lon_0=15", point_ll(105, 0));
+
+    {
+        using namespace bg::srs::spar;
+        bg::srs::projection<parameters<proj_merc, ellps_wgs84> > prj;
+        test_projection(prj, "static merc");
+    }
+    {
+        using namespace bg::srs::spar;
+        bg::srs::projection<parameters<proj_laea, ellps_grs80, lat_0<>, lon_0<> > > prj
+            = parameters<proj_laea, ellps_grs80, lat_0<>, lon_0<> >(
+                proj_laea(), ellps_grs80(), lat_0<>(52), lon_0<>(10));
+        test_projection(prj, "static laea");
+    }
+
+    return 0;
+}
@@ -0,0 +1,149 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/srs/esri.hpp>
+#include <boost/geometry/srs/projection_cache.hpp>
+
+
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_ll;
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_xy;
+
+
+std::string const wgs84 = "+proj=longlat +ellps=WGS84 +datum=WGS84 +no_defs";
+std::string const utm33 = "+proj=utm +zone=33 +ellps=WGS84 +datum=WGS84 +units=m +no_defs";
+
+
+template <typename Projection>
+point_xy forward(Projection const& prj, point_ll const& ll)
+{
+    point_xy xy;
+    prj.forward(ll, xy);
+    return xy;
+}
+
+template <typename Transformation>
+point_xy transform(Transformation const& tr, point_ll const& ll)
+{
+    point_xy xy;
+    tr.forward(ll, xy);
+    return xy;
+}
+
+void test_cache()
+{
+    using namespace bg::srs;
+
+    projection_cache<> cache;
+    BOOST_CHECK_EQUAL(cache.size(), 0u);
+
+    point_ll const ll(15, 52);
+
+    // Cached once
+    point_xy const utm_expected = forward(projection<>(proj4(utm33)), ll);
+    point_xy const utm1 = forward(cache.get_projection(proj4(utm33)), ll);
+    point_xy const utm2 = forward(cache.get_projection(proj4(utm33)), ll);
+    BOOST_CHECK_EQUAL(cache.size(), 1u);
+    BOOST_CHECK_EQUAL(bg::get<0>(utm1), bg::get<0>(utm_expected));
+    BOOST_CHECK_EQUAL(bg::get<1>(utm1), bg::get<1>(utm_expected));
+    BOOST_CHECK_EQUAL(bg::get<0>(utm2), bg::get<0>(utm_expected));
+    BOOST_CHECK_EQUAL(bg::get<1>(utm2), bg::get<1>(utm_expected));
+
+    // Codes of different databases are different keys
+    point_xy const robin_expected = forward(projection<>(esri(54030)), ll);
+    point_xy const robin = forward(cache.get_projection(esri(54030)), ll);
+    cache.get_projection(esri(54030));
+    BOOST_CHECK_EQUAL(cache.size(), 2u);
+    BOOST_CHECK(! (detail::make_projection_cache_key(esri(54030))
+                   == detail::make_projection_cache_key(epsg(54030))));
+    BOOST_CHECK_EQUAL(bg::get<0>(robin), bg::get<0>(robin_expected));
+    BOOST_CHECK_EQUAL(bg::get<1>(robin), bg::get<1>(robin_expected));
+
+    // Pairs are ordered
+    transformation<> const tr_expected((proj4(wgs84)), (esri(102013)));
+    point_xy const aea_expected = transform(tr_expected, ll);
+    point_xy const aea = transform(cache.get_transformation(proj4(wgs84), esri(102013)), ll);
+    cache.get_transformation(proj4(wgs84), esri(102013));
+    BOOST_CHECK_EQUAL(cache.size(), 3u);
+    cache.get_transformation(esri(102013), proj4(wgs84));
+    BOOST_CHECK_EQUAL(cache.size(), 4u);
+    BOOST_CHECK_EQUAL(bg::get<0>(aea), bg::get<0>(aea_expected));
+    BOOST_CHECK_EQUAL(bg::get<1>(aea), bg::get<1>(aea_expected));
+
+    // Not cached if the projection can not be created
+    BOOST_CHECK_THROW(cache.get_projection(proj4("+proj=abcd")), bg::projection_exception);
+    BOOST_CHECK_EQUAL(cache.size(), 4u);
+
+    cache.clear();
+    BOOST_CHECK_EQUAL(cache.size(), 0u);
+}
+
+void test_threads()
+{
+    using namespace bg::srs;
+
+    projection_cache<> cache;
+
+    std::vector<std::string> const utms = {
+        "+proj=utm +zone=31 +ellps=WGS84",
+        "+proj=utm +zone=32 +ellps=WGS84",
+        "+proj=utm +zone=33 +ellps=WGS84",
+        "+proj=utm +zone=34 +ellps=WGS84"
+    };
+
+    point_ll const ll(15, 52);
+    std::vector<point_xy> expected;
+    for (std::string const& utm : utms)
+    {
+        expected.push_back(transform(transformation<>((proj4(wgs84)), (proj4(utm))), ll));
+    }
+
+    std::vector<char> results(8, 1);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < results.size(); t++)
+    {
+        threads.emplace_back([&, t]()
+        {
+            for (std::size_t i = 0; i < 1000; i++)
+            {
+                std::size_t const j = (i + t) % utms.size();
+                point_xy const xy = transform(cache.get_transformation(proj4(wgs84), proj4(utms[j])), ll);
+                if (bg::get<0>(xy) != bg::get<0>(expected[j])
+                    || bg::get<1>(xy) != bg::get<1>(expected[j]))
+                {
+                    results[t] = 0;
+                }
+            }
+        });
+    }
+    for (std::thread & thread : threads)
+    {
+        thread.join();
+    }
+
+    for (std::size_t t = 0; t < results.size(); t++)
+    {
+        BOOST_CHECK_MESSAGE(results[t] == 1, "thread " << t);
+    }
+    BOOST_CHECK_EQUAL(cache.size(), utms.size());
+}
+
+int test_main(int, char*[])
+{
+    test_cache();
+    test_threads();
+
+    return 0;
+}
@@ -0,0 +1,243 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/srs/mapped_grids.hpp>
+#include <boost/geometry/srs/transformation.hpp>
+
+
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_ll;
+typedef bg::model::multi_point<point_ll> multi_point_ll;
+
+
+template <typename T>
+void write_value(std::ofstream& os, T const& value)
+{
+    os.write(reinterpret_cast<char const*>(&value), sizeof(T));
+}
+
+// Writes a record of a NTv2 header, a name of 8 characters and a value
+template <typename T>
+void write_record(std::ofstream& os, char const* name, T const& value)
+{
+    char record[16] = { 0 };
+    std::memcpy(record, name, 8);
+    std::memcpy(record + 8, &value, sizeof(T));
+    os.write(record, 16);
+}
+
+void write_record(std::ofstream& os, char const* name, char const* value)
+{
+    char record[16] = { 0 };
+    std::memcpy(record, name, 8);
+    std::memcpy(record + 8, value, 8);
+    os.write(record, 16);
+}
+
+// Subgrid in degrees, with shifts depending on the row and column
+struct subgrid
+{
+    char const* name;
+    char const* parent;
+    double west, south, east, north, step;
+    float offset;
+
+    int columns() const { return int((east - west) / step + 0.5) + 1; }
+    int rows() const { return int((north - south) / step + 0.5) + 1; }
+};
+
+// NTv2, in seconds with positive longitudes to the west, in native byte order
+void write_ntv2(std::string const& filename, std::vector<subgrid> const& grids)
+{
+    std::ofstream os(filename.c_str(), std::ios::binary);
+    write_record(os, "NUM_OREC", boost::int32_t(11));
+    write_record(os, "NUM_SREC", boost::int32_t(11));
+    write_record(os, "NUM_FILE", boost::int32_t(grids.size()));
+    write_record(os, "GS_TYPE ", "SECONDS ");
+    write_record(os, "VERSION ", "NTv2.0  ");
+    write_record(os, "SYSTEM_F", "TEST    ");
+    write_record(os, "SYSTEM_T", "WGS84   ");
+    write_record(os, "MAJOR_F ", 6378137.0);
+    write_record(os, "MINOR_F ", 6356752.314);
+    write_record(os, "MAJOR_T ", 6378137.0);
+    write_record(os, "MINOR_T ", 6356752.314);
+
+    for (subgrid const& g : grids)
+    {
+        write_record(os, "SUB_NAME", g.name);
+        write_record(os, "PARENT  ", g.parent);
+        write_record(os, "CREATED ", "20260101");
+        write_record(os, "UPDATED ", "20260101");
+        write_record(os, "S_LAT   ", g.south * 3600.0);
+        write_record(os, "N_LAT   ", g.north * 3600.0);
+        write_record(os, "E_LONG  ", -g.east * 3600.0);
+        write_record(os, "W_LONG  ", -g.west * 3600.0);
+        write_record(os, "LAT_INC ", g.step * 3600.0);
+        write_record(os, "LONG_INC", g.step * 3600.0);
+        write_record(os, "GS_COUNT", boost::int32_t(g.rows() * g.columns()));
+
+        // From south to north, from east to west
+        for (int row = 0; row < g.rows(); row++)
+        {
+            for (int col = g.columns() - 1; col >= 0; col--)
+            {
+                write_value(os, float(g.offset + 0.02 * row + 0.01 * col));
+                write_value(os, float(-g.offset + 0.01 * row - 0.03 * col));
+                write_value(os, 0.0f);
+                write_value(os, 0.0f);
+            }
+        }
+    }
+}
+
+// CTABLE V2, in radians, little endian
+void write_ctable2(std::string const& filename, subgrid const& g)
+{
+    double const d2r = bg::math::d2r<double>();
+
+    std::ofstream os(filename.c_str(), std::ios::binary);
+    char header[160] = { 0 };
+    std::memcpy(header, "CTABLE V2", 9);
+    std::memcpy(header + 16, "test grid", 9);
+    double const ll_del[4] = { g.west * d2r, g.south * d2r, g.step * d2r, g.step * d2r };
+    boost::int32_t const lim[2] = { g.columns(), g.rows() };
+    std::memcpy(header + 96, ll_del, 32);
+    std::memcpy(header + 128, lim, 8);
+    os.write(header, 160);
+
+    for (int row = 0; row < g.rows(); row++)
+    {
+        for (int col = 0; col < g.columns(); col++)
+        {
+            write_value(os, float((g.offset + 0.02 * row) * d2r / 3600.0));
+            write_value(os, float((0.01 * col - g.offset) * d2r / 3600.0));
+        }
+    }
+}
+
+multi_point_ll test_points()
+{
+    multi_point_ll result;
+    for (int i = 0; i < 60; i++)
+    {
+        for (int j = 0; j < 60; j++)
+        {
+            result.push_back(point_ll(3.0 + 0.23 * i, 43.0 + 0.21 * j));
+        }
+    }
+    return result;
+}
+
+template <typename Geometry>
+bool equal_points(Geometry const& g1, Geometry const& g2)
+{
+    if (boost::size(g1) != boost::size(g2))
+    {
+        return false;
+    }
+    for (std::size_t i = 0; i < boost::size(g1); i++)
+    {
+        if (bg::get<0>(g1[i]) != bg::get<0>(g2[i])
+            || bg::get<1>(g1[i]) != bg::get<1>(g2[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Not mapped, because the grid name may not be a path
+struct other_ifstream_policy
+{
+    typedef std::ifstream stream_type;
+
+    static inline void open(stream_type & is, std::string const& gridname)
+    {
+        is.open(gridname.c_str(), std::ios::binary);
+    }
+};
+
+void test_grid(std::string const& filename)
+{
+    using namespace bg::srs;
+
+    transformation<> tr(proj4("+proj=longlat +ellps=WGS84 +nadgrids=" + filename),
+                        proj4("+proj=longlat +ellps=WGS84 +towgs84=0,0,0"));
+
+    multi_point_ll const points = test_points();
+
+    grids_storage<> storage;
+    transformation_grids<grids_storage<> > grids = tr.initialize_grids(storage);
+    multi_point_ll expected, expected_inv;
+    tr.forward(points, expected, grids);
+    tr.inverse(expected, expected_inv, grids);
+
+    // The grids are used
+    BOOST_CHECK(! equal_points(expected, points));
+
+    typedef grids_storage<ifstream_policy, mapped_grids> mapped_storage_type;
+    mapped_storage_type mapped_storage;
+    transformation_grids<mapped_storage_type> mapped = tr.initialize_grids(mapped_storage);
+    BOOST_CHECK_EQUAL(mapped_storage.hgrids.size(), storage.hgrids.size());
+
+    // Initialized again from the published grids
+    transformation_grids<mapped_storage_type> const mapped2 = tr.initialize_grids(mapped_storage);
+    BOOST_CHECK_EQUAL(mapped_storage.hgrids.size(), storage.hgrids.size());
+
+    // Decoded lazily
+    BOOST_CHECK(mapped_storage.hgrids.published_gridinfo().front().tiles);
+    BOOST_CHECK(mapped_storage.hgrids.published_gridinfo().front().ct.cvs.empty());
+
+    multi_point_ll result, result_inv;
+    tr.forward(points, result, mapped);
+    tr.inverse(result, result_inv, mapped2);
+    BOOST_CHECK_MESSAGE(equal_points(result, expected), filename);
+    BOOST_CHECK_MESSAGE(equal_points(result_inv, expected_inv), filename);
+
+    // Shared by several threads without locking
+    multi_point_ll result_parallel;
+    tr.forward(points, result_parallel, mapped, 4);
+    BOOST_CHECK_MESSAGE(equal_points(result_parallel, expected), filename);
+
+    // Loaded completely with other stream policies
+    typedef grids_storage<other_ifstream_policy, mapped_grids> other_storage_type;
+    other_storage_type other_storage;
+    transformation_grids<other_storage_type> other = tr.initialize_grids(other_storage);
+    BOOST_CHECK(! other_storage.hgrids.published_gridinfo().front().tiles);
+    BOOST_CHECK(! other_storage.hgrids.published_gridinfo().front().ct.cvs.empty());
+
+    multi_point_ll result_other;
+    tr.forward(points, result_other, other);
+    BOOST_CHECK_MESSAGE(equal_points(result_other, expected), filename);
+}
+
+int test_main(int, char*[])
+{
+    std::vector<subgrid> ntv2;
+    ntv2.push_back(subgrid{"PARENT01", "NONE    ", 5.0, 45.0, 15.0, 55.0, 0.1, 1.0f});
+    ntv2.push_back(subgrid{"CHILD001", "PARENT01", 8.0, 48.0, 10.0, 50.0, 0.025, 0.5f});
+    ntv2.push_back(subgrid{"OTHER001", "NONE    ", 1.0, 42.0, 4.0, 44.0, 0.5, 2.0f});
+    write_ntv2("transformation_mapped_grids.gsb", ntv2);
+    test_grid("transformation_mapped_grids.gsb");
+    std::remove("transformation_mapped_grids.gsb");
+
+    write_ctable2("transformation_mapped_grids.ct2", ntv2.front());
+    test_grid("transformation_mapped_grids.ct2");
+    std::remove("transformation_mapped_grids.ct2");
+
+    return 0;
+}
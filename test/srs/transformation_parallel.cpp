@@ -0,0 +1,193 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <string>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/srs/shared_grids_std.hpp>
+#include <boost/geometry/srs/transformation.hpp>
+
+
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_ll;
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_xy;
+
+
+// Points on a spiral, without duplicates such that a part of the output
+// can not accidentally be equal to another part
+template <typename Range>
+void fill(Range& range, std::size_t count, double lon, double lat)
+{
+    for (std::size_t i = 0; i < count; i++)
+    {
+        double const a = 0.01 * double(i);
+        double const r = 1.0 + 1.0e-4 * double(i);
+        bg::range::push_back(range, typename boost::range_value<Range>::type(
+            lon + r * std::cos(a), lat + r * std::sin(a)));
+    }
+}
+
+template <typename Geometry1, typename Geometry2>
+void check_equal(Geometry1 const& g1, Geometry2 const& g2, std::string const& caseid)
+{
+    std::vector<point_xy> points1, points2;
+    bg::for_each_point(g1, [&](auto const& p)
+        { points1.push_back(point_xy(bg::get<0>(p), bg::get<1>(p))); });
+    bg::for_each_point(g2, [&](auto const& p)
+        { points2.push_back(point_xy(bg::get<0>(p), bg::get<1>(p))); });
+
+    BOOST_CHECK_EQUAL(points1.size(), points2.size());
+    bool equal = points1.size() == points2.size();
+    for (std::size_t i = 0; equal && i < points1.size(); i++)
+    {
+        // The points are transformed identically, so they are bitwise equal
+        equal = bg::get<0>(points1[i]) == bg::get<0>(points2[i])
+             && bg::get<1>(points1[i]) == bg::get<1>(points2[i]);
+    }
+    BOOST_CHECK_MESSAGE(equal, caseid << " differs from the serial transformation");
+}
+
+template <typename GeometryLL, typename GeometryXY, typename Transformation, typename Grids>
+void test_geometry(Transformation const& tr, GeometryLL const& geometry,
+                   Grids const& grids, std::string const& caseid)
+{
+    GeometryXY expected;
+    bool const expected_result = tr.forward(geometry, expected, grids);
+
+    for (std::size_t thread_count = 0; thread_count <= 5; thread_count++)
+    {
+        GeometryXY result;
+        BOOST_CHECK_EQUAL(tr.forward(geometry, result, grids, thread_count), expected_result);
+        check_equal(result, expected, caseid);
+    }
+
+    GeometryLL expected_inv;
+    bool const expected_inv_result = tr.inverse(expected, expected_inv, grids);
+
+    GeometryLL result_inv;
+    BOOST_CHECK_EQUAL(tr.inverse(expected, result_inv, grids, 3), expected_inv_result);
+    check_equal(result_inv, expected_inv, caseid + " inverse");
+}
+
+template <typename Transformation, typename Grids>
+void test_all(Transformation const& tr, Grids const& grids, double lon, double lat)
+{
+    typedef bg::model::linestring<point_ll> linestring_ll;
+    typedef bg::model::linestring<point_xy> linestring_xy;
+    typedef bg::model::ring<point_ll> ring_ll;
+    typedef bg::model::polygon<point_ll> polygon_ll;
+    typedef bg::model::polygon<point_xy> polygon_xy;
+    typedef bg::model::multi_point<point_ll> multi_point_ll;
+    typedef bg::model::multi_point<point_xy> multi_point_xy;
+    typedef bg::model::multi_linestring<linestring_ll> multi_linestring_ll;
+    typedef bg::model::multi_linestring<linestring_xy> multi_linestring_xy;
+    typedef bg::model::multi_polygon<polygon_ll> multi_polygon_ll;
+    typedef bg::model::multi_polygon<polygon_xy> multi_polygon_xy;
+
+    // Small, transformed serially
+    {
+        linestring_ll ls;
+        fill(ls, 10, lon, lat);
+        test_geometry<linestring_ll, linestring_xy>(tr, ls, grids, "small linestring");
+    }
+
+    // Split into parts, 5003 points is not a multiple of the thread counts
+    {
+        linestring_ll ls;
+        fill(ls, 5003, lon, lat);
+        test_geometry<linestring_ll, linestring_xy>(tr, ls, grids, "linestring");
+
+        multi_point_ll mpt;
+        fill(mpt, 5003, lon, lat);
+        test_geometry<multi_point_ll, multi_point_xy>(tr, mpt, grids, "multi_point");
+    }
+
+    // Large exterior ring with less interior rings than threads
+    {
+        polygon_ll poly;
+        fill(poly.outer(), 4000, lon, lat);
+        poly.inners().resize(2);
+        fill(poly.inners()[0], 1500, lon, lat);
+        fill(poly.inners()[1], 10, lon, lat);
+        test_geometry<polygon_ll, polygon_xy>(tr, poly, grids, "polygon");
+    }
+
+    // Many elements, distributed over the threads
+    {
+        multi_linestring_ll mls;
+        mls.resize(50);
+        multi_polygon_ll mpoly;
+        mpoly.resize(30);
+        for (std::size_t i = 0; i < mls.size(); i++)
+        {
+            fill(mls[i], 20 + i * 7, lon + 0.1 * double(i), lat);
+        }
+        for (std::size_t i = 0; i < mpoly.size(); i++)
+        {
+            fill(mpoly[i].outer(), 40 + i * 3, lon, lat + 0.1 * double(i));
+        }
+        test_geometry<multi_linestring_ll, multi_linestring_xy>(tr, mls, grids, "multi_linestring");
+        test_geometry<multi_polygon_ll, multi_polygon_xy>(tr, mpoly, grids, "multi_polygon");
+    }
+
+    // Less elements than threads
+    {
+        multi_linestring_ll mls;
+        mls.resize(2);
+        fill(mls[0], 3000, lon, lat);
+        fill(mls[1], 1200, lon, lat);
+        test_geometry<multi_linestring_ll, multi_linestring_xy>(tr, mls, grids, "few linestrings");
+    }
+
+    // Points outside of the domain of the projection
+    {
+        ring_ll ring;
+        fill(ring, 3000, lon, lat);
+        for (std::size_t i = 0; i < ring.size(); i += 500)
+        {
+            bg::set<1>(ring[i], 95.0);
+        }
+        bg::model::ring<point_xy> result, expected;
+        BOOST_CHECK(! tr.forward(ring, expected, grids));
+        BOOST_CHECK(! tr.forward(ring, result, grids, 4));
+        check_equal(result, expected, "invalid points");
+    }
+}
+
+int test_main(int, char*[])
+{
+    using namespace bg::srs;
+
+    // Datum shift and projection
+    {
+        transformation<> tr(proj4("+proj=longlat +ellps=WGS84 +datum=WGS84 +no_defs"),
+                            proj4("+proj=tmerc +ellps=airy +towgs84=446.448,-125.157,542.06,0.15,0.247,0.842,-20.489 "
+                                  "+lat_0=49 +lon_0=-2 +k=0.9996012717 +x_0=400000 +y_0=-100000"));
+        test_all(tr, transformation_grids<detail::empty_grids_storage>(), -2.0, 53.0);
+    }
+
+    // Shared grids, @null shifts nothing but is looked up for each point
+    {
+        transformation<> tr(proj4("+proj=longlat +ellps=WGS84 +towgs84=0,0,0 +no_defs"),
+                            proj4("+proj=merc +ellps=GRS80 +nadgrids=@null"));
+        grids_storage<ifstream_policy, shared_grids_std> storage;
+        test_all(tr, tr.initialize_grids(storage), 10.0, 50.0);
+    }
+
+    // Unshared grids, transformed serially
+    {
+        transformation<> tr(proj4("+proj=longlat +ellps=WGS84 +towgs84=0,0,0 +no_defs"),
+                            proj4("+proj=merc +ellps=GRS80 +nadgrids=@null"));
+        grids_storage<> storage;
+        test_all(tr, tr.initialize_grids(storage), 10.0, 50.0);
+    }
+
+    return 0;
+}
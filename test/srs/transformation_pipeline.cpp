@@ -0,0 +1,212 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/srs/transformation.hpp>
+
+
+// Angles in radians, as passed to pj_transform() by srs::transformation
+typedef bg::model::point<double, 3, bg::cs::cartesian> point_3d;
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_ll;
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_xy;
+
+
+// More than one block of points, with invalid points
+std::vector<point_3d> test_points(double lon, double lat, double size)
+{
+    double const d2r = bg::math::d2r<double>();
+    std::vector<point_3d> result;
+    for (int i = 0; i < 150; i++)
+    {
+        result.push_back(point_3d((lon + size * std::cos(0.1 * i)) * d2r,
+                                  (lat + size * std::sin(0.1 * i)) * d2r,
+                                  10.0 * i));
+    }
+    result[3] = point_3d(HUGE_VAL, HUGE_VAL, 0.0);
+    result[70] = point_3d(lon * d2r, 95.0 * d2r, 0.0);
+    return result;
+}
+
+// EPSG:4326, EPSG:3857 and EPSG:32633
+std::string const wgs84 = "+proj=longlat +ellps=WGS84 +datum=WGS84 +no_defs";
+std::string const pseudo_mercator = "+proj=merc +a=6378137 +b=6378137 +lat_ts=0.0 +lon_0=0.0 "
+                                    "+x_0=0.0 +y_0=0 +k=1.0 +units=m +nadgrids=@null +wktext +no_defs";
+std::string const utm33 = "+proj=utm +zone=33 +ellps=WGS84 +datum=WGS84 +units=m +no_defs";
+
+// Invalid points are set to HUGE_VAL in both cases
+bool is_close(double a, double b, double tolerance)
+{
+    return a == b || std::fabs(a - b) <= tolerance * (1.0 + std::fabs(b));
+}
+
+template <typename Points>
+void test_pipeline(std::string const& src, std::string const& dst,
+                   Points const& points, bool single_pass)
+{
+    using namespace bg::projections::detail;
+
+    typedef bg::projections::proj_wrapper<bg::srs::dynamic, double> proj_type;
+    proj_type const proj1 = proj_type(bg::srs::proj4(src));
+    proj_type const proj2 = proj_type(bg::srs::proj4(dst));
+
+    pj_transform_steps<double> const steps(proj1.proj().params(), proj2.proj().params());
+    BOOST_CHECK_MESSAGE(steps.single_pass == single_pass, src << " -> " << dst);
+
+    bg::srs::detail::empty_projection_grids const grids;
+
+    Points expected = points;
+    bool const expected_result = pj_transform(proj1.proj(), proj1.proj().params(),
+                                              proj2.proj(), proj2.proj().params(),
+                                              expected, grids, grids);
+
+    Points result = points;
+    BOOST_CHECK_MESSAGE(make_pj_transform_pipeline(proj1.proj(), proj1.proj().params(),
+                                                   proj2.proj(), proj2.proj().params(),
+                                                   steps).apply(result, grids, grids)
+                            == expected_result,
+                        src << " -> " << dst);
+
+    for (std::size_t i = 0; i < points.size(); i++)
+    {
+        BOOST_CHECK_MESSAGE(is_close(bg::get<0>(result[i]), bg::get<0>(expected[i]), 1.0e-9)
+                         && is_close(bg::get<1>(result[i]), bg::get<1>(expected[i]), 1.0e-9)
+                         && is_close(bg::get<2>(result[i]), bg::get<2>(expected[i]), 1.0e-9),
+                            src << " -> " << dst << " " << i << ": "
+                            << bg::wkt(result[i]) << " != " << bg::wkt(expected[i]));
+    }
+}
+
+// Errors which are not transient are rethrown by both
+void test_pipeline_error(std::string const& src, std::string const& dst,
+                         point_3d const& point)
+{
+    using namespace bg::projections::detail;
+
+    typedef bg::projections::proj_wrapper<bg::srs::dynamic, double> proj_type;
+    proj_type const proj1 = proj_type(bg::srs::proj4(src));
+    proj_type const proj2 = proj_type(bg::srs::proj4(dst));
+
+    pj_transform_steps<double> const steps(proj1.proj().params(), proj2.proj().params());
+    BOOST_CHECK_MESSAGE(steps.single_pass, src << " -> " << dst);
+
+    bg::srs::detail::empty_projection_grids const grids;
+
+    std::vector<point_3d> points = test_points(0.0, 0.0, 10.0);
+    points[80] = point;
+
+    int expected_code = 0;
+    try
+    {
+        std::vector<point_3d> expected = points;
+        pj_transform(proj1.proj(), proj1.proj().params(),
+                     proj2.proj(), proj2.proj().params(),
+                     expected, grids, grids);
+    }
+    catch (bg::projection_exception const& e)
+    {
+        expected_code = e.code();
+    }
+    BOOST_CHECK_MESSAGE(expected_code != 0, src << " -> " << dst);
+
+    int code = 0;
+    try
+    {
+        make_pj_transform_pipeline(proj1.proj(), proj1.proj().params(),
+                                   proj2.proj(), proj2.proj().params(),
+                                   steps).apply(points, grids, grids);
+    }
+    catch (bg::projection_exception const& e)
+    {
+        code = e.code();
+    }
+    BOOST_CHECK_MESSAGE(code == expected_code, src << " -> " << dst << " "
+                        << code << " != " << expected_code);
+}
+
+void test_transformation()
+{
+    using namespace bg::srs;
+
+    transformation<> tr((proj4(wgs84)), (proj4(pseudo_mercator)));
+
+    bg::model::linestring<point_ll> ls;
+    ls.push_back(point_ll(10, 50));
+    ls.push_back(point_ll(-120, -30));
+    bg::model::linestring<point_xy> ls_xy;
+    BOOST_CHECK(tr.forward(ls, ls_xy));
+    BOOST_CHECK_CLOSE(bg::get<0>(ls_xy[0]), 1113194.9079327357, 1.0e-9);
+    BOOST_CHECK_CLOSE(bg::get<1>(ls_xy[0]), 6446275.8410171578, 1.0e-9);
+    BOOST_CHECK_CLOSE(bg::get<0>(ls_xy[1]), -13358338.895192828, 1.0e-9);
+    BOOST_CHECK_CLOSE(bg::get<1>(ls_xy[1]), -3503549.8435043753, 1.0e-9);
+
+    bg::model::linestring<point_ll> ls_ll;
+    BOOST_CHECK(tr.inverse(ls_xy, ls_ll));
+    BOOST_CHECK_CLOSE(bg::get<0>(ls_ll[1]), -120.0, 1.0e-9);
+    BOOST_CHECK_CLOSE(bg::get<1>(ls_ll[1]), -30.0, 1.0e-9);
+
+    point_xy pt_xy;
+    BOOST_CHECK(tr.forward(ls[0], pt_xy));
+    BOOST_CHECK_CLOSE(bg::get<0>(pt_xy), 1113194.9079327357, 1.0e-9);
+    BOOST_CHECK(! tr.forward(point_ll(10, 95), pt_xy));
+}
+
+int test_main(int, char*[])
+{
+    std::vector<point_3d> const points = test_points(15.0, 52.0, 3.0);
+
+    // Projected
+    test_pipeline(wgs84, pseudo_mercator, points, true);
+    test_pipeline(wgs84, utm33, points, true);
+    test_pipeline("+proj=longlat +ellps=GRS80 +towgs84=0,0,0",
+                  "+proj=laea +lat_0=52 +lon_0=10 +x_0=4321000 +y_0=3210000 +ellps=GRS80 +vunits=ft",
+                  points, true);
+    test_pipeline("+proj=longlat +ellps=bessel +pm=ferro +vto_meter=0.5",
+                  "+proj=tmerc +lon_0=15 +ellps=bessel +units=km", points, true);
+    test_pipeline("+proj=longlat +ellps=WGS84 +lon_wrap=180",
+                  "+proj=longlat +ellps=WGS84 +pm=paris +lon_wrap=180", points, true);
+
+    // Projected to projected
+    {
+        std::vector<point_3d> utm = points;
+        bg::projections::proj_wrapper<bg::srs::dynamic, double> const
+            prj = bg::projections::proj_wrapper<bg::srs::dynamic, double>(bg::srs::proj4(utm33));
+        for (std::size_t i = 0; i < utm.size(); i++)
+        {
+            if (! bg::projections::is_invalid_point(utm[i]))
+            {
+                prj.proj().forward(utm[i], utm[i]);
+            }
+        }
+        test_pipeline(utm33, "+proj=lcc +lat_1=33 +lat_2=45 +lat_0=39 +lon_0=10 +ellps=WGS84",
+                      utm, true);
+    }
+
+    // Datum shifts and geocentric coordinates are transformed by pj_transform()
+    test_pipeline(wgs84, "+proj=tmerc +ellps=airy +towgs84=446.448,-125.157,542.06,0.15,0.247,0.842,-20.489 "
+                  "+lat_0=49 +lon_0=-2 +k=0.9996012717 +x_0=400000 +y_0=-100000", points, false);
+    test_pipeline(wgs84, "+proj=longlat +ellps=clrk66 +towgs84=0,0,0", points, false);
+    test_pipeline(wgs84, "+proj=geocent +ellps=WGS84 +datum=WGS84", points, false);
+    // GRS80 and WGS84 differ slightly
+    test_pipeline("+proj=longlat +ellps=GRS80 +towgs84=0,0,0",
+                  "+proj=longlat +ellps=WGS84 +nadgrids=@null", points, false);
+
+    // Not converging
+    test_pipeline_error("+proj=natearth +ellps=WGS84", wgs84,
+                        point_3d(0.0, std::numeric_limits<double>::quiet_NaN(), 0.0));
+
+    test_transformation();
+
+    return 0;
+}
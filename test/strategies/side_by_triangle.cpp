@@ -0,0 +1,90 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cmath>
+
+#include <boost/multiprecision/cpp_int.hpp>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/strategy/cartesian/side_by_triangle.hpp>
+
+
+// Returns the exact side, calculated with rational numbers
+template <typename Point>
+int exact_side(Point const& p1, Point const& p2, Point const& p)
+{
+    using rational = boost::multiprecision::cpp_rational;
+    rational const dx = rational(bg::get<0>(p2)) - rational(bg::get<0>(p1));
+    rational const dy = rational(bg::get<1>(p2)) - rational(bg::get<1>(p1));
+    rational const dpx = rational(bg::get<0>(p)) - rational(bg::get<0>(p1));
+    rational const dpy = rational(bg::get<1>(p)) - rational(bg::get<1>(p1));
+    rational const det = dx * dpy - dy * dpx;
+    return det > 0 ? 1 : det < 0 ? -1 : 0;
+}
+
+template <typename Point>
+void test_near_collinear(std::string const& case_id,
+                         Point const& p1, Point const& p2, Point const& p,
+                         int n)
+{
+    using side = bg::strategy::side::side_by_triangle<>;
+
+    // Points are perturbed by one ulp at a time, in a grid of n x n.
+    // Collinear points might be reported as being on the segment, but
+    // a reported side should never be the wrong side.
+    int wrong = 0;
+    Point q = p;
+    for (int i = 0; i < n; i++)
+    {
+        bg::set<1>(q, bg::get<1>(p));
+        for (int j = 0; j < n; j++)
+        {
+            int const s = side::apply(p1, p2, q);
+            int const e = exact_side(p1, p2, q);
+            if (s != 0 && s != e)
+            {
+                wrong++;
+            }
+
+            // Verify cyclic permutations
+            BOOST_CHECK_EQUAL(side::apply(p2, q, p1), s);
+            BOOST_CHECK_EQUAL(side::apply(q, p1, p2), s);
+
+            bg::set<1>(q, std::nextafter(bg::get<1>(q), 1.0e10));
+        }
+        bg::set<0>(q, std::nextafter(bg::get<0>(q), 1.0e10));
+    }
+    BOOST_CHECK_MESSAGE(wrong == 0, case_id << " wrong sides: " << wrong);
+}
+
+template <typename Point>
+void test_all()
+{
+    using side = bg::strategy::side::side_by_triangle<>;
+
+    BOOST_CHECK_EQUAL(side::apply(Point(0, 0), Point(10, 10), Point(5, 6)), 1);
+    BOOST_CHECK_EQUAL(side::apply(Point(0, 0), Point(10, 10), Point(5, 4)), -1);
+    BOOST_CHECK_EQUAL(side::apply(Point(0, 0), Point(10, 10), Point(5, 5)), 0);
+
+    // Cases from "Classroom examples of robustness problems in geometric
+    // computations" (Kettner et al.)
+    test_near_collinear("kettner_1", Point(12, 12), Point(24, 24), Point(0.5, 0.5), 64);
+    test_near_collinear("kettner_2", Point(27.643564356435643, -21.881188118811881),
+                        Point(83.366336633663366, 15.544554455445542),
+                        Point(0.5, 0.5), 64);
+    test_near_collinear("large", Point(1.0e8, 1.0e8), Point(3.0e8, 3.0e8 + 1.0),
+                        Point(2.0e8, 2.0e8), 32);
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+
+    return 0;
+}
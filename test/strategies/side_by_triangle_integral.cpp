@@ -0,0 +1,130 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cstdint>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/intersection.hpp>
+#include <boost/geometry/algorithms/union.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+
+#include <boost/geometry/strategy/cartesian/side_by_triangle.hpp>
+
+
+template <typename Point>
+void test_side(std::string const& case_id, Point const& p1, Point const& p2, Point const& p,
+               int expected)
+{
+    using side = bg::strategy::side::side_by_triangle<>;
+
+    // All cyclic permutations should give the same side, and the other
+    // direction should give the opposite side
+    int const sides[6] = {
+        side::apply(p1, p2, p), side::apply(p2, p, p1), side::apply(p, p1, p2),
+        -side::apply(p2, p1, p), -side::apply(p1, p, p2), -side::apply(p, p2, p1) };
+    for (int i = 0; i < 6; i++)
+    {
+        BOOST_CHECK_MESSAGE(sides[i] == expected,
+            case_id << " [" << i << "] expected: " << expected << " detected: " << sides[i]);
+    }
+}
+
+template <typename Point, typename T>
+void test_side_integral()
+{
+    // Small coordinates, calculated in the coordinate type itself
+    test_side("small_left", Point(0, 0), Point(10, 10), Point(5, 6), 1);
+    test_side("small_right", Point(0, 0), Point(10, 10), Point(5, 4), -1);
+    test_side("small_collinear", Point(0, 0), Point(10, 10), Point(20, 20), 0);
+
+    // Large coordinates. With a floating point calculation, the determinant
+    // (which is exactly 1 or 0) cannot be distinguished from zero.
+    T const a = (T(1) << 40) + 1;
+    T const b = T(1) << 40;
+    test_side("large_left", Point(0, 0), Point(a, b), Point(2 * a + 1, 2 * b + 1), 1);
+    test_side("large_right", Point(0, 0), Point(a, b), Point(2 * a - 1, 2 * b - 1), -1);
+    test_side("large_collinear", Point(0, 0), Point(a, b), Point(2 * a, 2 * b), 0);
+
+    // Near the limit of the promoted type
+    T const c = (T(1) << 61) + 3;
+    T const d = (T(1) << 61) + 1;
+    test_side("huge_left", Point(-c, -d), Point(c, d), Point(c - 2, d - 1), 1);
+    test_side("huge_collinear", Point(-c, -d), Point(0, 0), Point(c, d), 0);
+}
+
+template <typename Point>
+void test_overlay_integral()
+{
+    using polygon = bg::model::polygon<Point>;
+    using multi_polygon = bg::model::multi_polygon<polygon>;
+
+    // Coordinates on a fine grid, up to 2^30
+    polygon p, q;
+    bg::read_wkt("POLYGON((0 0,0 1073741823,1073741823 1073741823,1073741823 0,0 0))", p);
+    bg::read_wkt("POLYGON((536870912 -5,536870912 1073741828,"
+                 "1073741828 1073741828,1073741828 -5,536870912 -5))", q);
+    bg::correct(p);
+    bg::correct(q);
+
+    double const side = 1073741823.0;
+    double const expected_intersection = 536870911.0 * side;
+
+    multi_polygon result;
+    bg::intersection(p, q, result);
+    BOOST_CHECK_EQUAL(result.size(), 1u);
+    BOOST_CHECK_CLOSE(bg::area(result), expected_intersection, 1.0e-10);
+
+    result.clear();
+    bg::union_(p, q, result);
+    BOOST_CHECK_EQUAL(result.size(), 1u);
+    BOOST_CHECK_CLOSE(bg::area(result),
+                      side * side + 536870916.0 * 1073741833.0 - expected_intersection,
+                      1.0e-10);
+}
+
+template <typename Point, typename T>
+void test_overlay_integral_large()
+{
+    using polygon = bg::model::polygon<Point>;
+    using multi_polygon = bg::model::multi_polygon<polygon>;
+
+    // A square and a diamond with coordinates far above 2^30. The numerators
+    // and denominators of the segment ratios do not fit in the coordinate type
+    T const s = T(1) << 40;
+    polygon const p{{{0, 0}, {0, s}, {s, s}, {s, 0}, {0, 0}}};
+    polygon const q{{{s / 2, -s / 4}, {-s / 4, s / 2}, {s / 2, 5 * s / 4},
+                     {5 * s / 4, s / 2}, {s / 2, -s / 4}}};
+
+    double const square_area = double(s) * double(s);
+
+    multi_polygon result;
+    bg::intersection(p, q, result);
+    BOOST_CHECK_EQUAL(result.size(), 1u);
+    BOOST_CHECK_EQUAL(boost::size(bg::exterior_ring(result.front())), 9u);
+    BOOST_CHECK_CLOSE(bg::area(result), 0.875 * square_area, 1.0e-10);
+
+    result.clear();
+    bg::union_(p, q, result);
+    BOOST_CHECK_EQUAL(result.size(), 1u);
+    BOOST_CHECK_CLOSE(bg::area(result), 1.25 * square_area, 1.0e-10);
+}
+
+int test_main(int, char* [])
+{
+    using point = bg::model::d2::point_xy<std::int64_t>;
+
+    test_side_integral<point, std::int64_t>();
+    test_overlay_integral<point>();
+    test_overlay_integral_large<point, std::int64_t>();
+
+    return 0;
+}